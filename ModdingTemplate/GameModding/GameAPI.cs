@@ -1,4 +1,5 @@
 using System;
+using System.Collections.Generic;
 
 namespace GameModding
 {
@@ -136,6 +137,56 @@ namespace GameModding
             public static int PedCount => GameImports.World_GetPedCount();
         }
         
+        /// <summary>
+        /// Task type table - read from the game once, then tasks are given by integer id
+        /// </summary>
+        public static class Tasks
+        {
+            private static readonly Dictionary<string, int> typeIds = new Dictionary<string, int>(StringComparer.OrdinalIgnoreCase);
+            private static string[] typeNames = Array.Empty<string>();
+
+            /// <summary>
+            /// All task type names, indexed by task type id
+            /// </summary>
+            public static IReadOnlyList<string> TypeNames
+            {
+                get
+                {
+                    EnsureLoaded();
+                    return typeNames;
+                }
+            }
+
+            /// <summary>
+            /// Get the id of a task type (e.g. "Turn", "MoveTowards"), or -1 if unknown
+            /// </summary>
+            public static int GetTypeId(string typeName)
+            {
+                EnsureLoaded();
+                return typeIds.TryGetValue(typeName, out int typeId) ? typeId : -1;
+            }
+
+            /// <summary>
+            /// Read the id table from the game; retried until the game module has registered its task types
+            /// </summary>
+            public static void EnsureLoaded()
+            {
+                if (typeNames.Length > 0)
+                {
+                    return;
+                }
+
+                int count = GameImports.TaskManager_GetTaskTypeCount();
+                var names = new string[count];
+                for (int typeId = 0; typeId < count; typeId++)
+                {
+                    names[typeId] = GameImports.TaskManager_GetTaskTypeName(typeId) ?? string.Empty;
+                    typeIds[names[typeId]] = typeId;
+                }
+                typeNames = names;
+            }
+        }
+        
         /// <summary>
         /// Utility math functions
         /// </summary>
@@ -208,6 +259,28 @@ namespace GameModding
             set => GameImports.Ped_SetHeading(Handle, value);
         }
 
+        /// <summary>
+        /// Give this ped a task by type id (see Game.Tasks); location drives move/jump/turn tasks
+        /// </summary>
+        public bool GiveTask(int taskTypeId, Vector3 location)
+        {
+            return GameImports.TaskManager_GiveTaskById(Handle, taskTypeId, location.X, location.Y, location.Z);
+        }
+
+        /// <summary>
+        /// Give this ped a task by type name; the name is resolved through the cached id table
+        /// </summary>
+        public bool GiveTask(string taskType, Vector3 location)
+        {
+            int taskTypeId = Game.Tasks.GetTypeId(taskType);
+            return taskTypeId >= 0 && GiveTask(taskTypeId, location);
+        }
+
+        /// <summary>
+        /// Stop the ped's current task
+        /// </summary>
+        public bool StopCurrentTask() => GameImports.TaskManager_StopCurrentTask(Handle);
+
         /// <summary>
         /// Remove this ped from the world
         /// </summary>
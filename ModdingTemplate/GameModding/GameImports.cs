@@ -204,6 +204,47 @@ namespace GameModding
             Ped_SetRotation_Native(pedHandle, new TypeConversions.FRotator(0, heading, 0));
         }
 
+        // ═══════════════════════════════════════════════════════════════
+        // TASK SYSTEM FUNCTIONS - Task types are integer ids
+        // ═══════════════════════════════════════════════════════════════
+        
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int TaskManager_GetTaskTypeCount();
+        
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl, EntryPoint = "TaskManager_GetTaskTypeName")]
+        private static extern IntPtr TaskManager_GetTaskTypeName_Native(int typeId);
+        
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static extern bool TaskManager_GiveTaskById(IntPtr pedHandle, int typeId, float x, float y, float z);
+        
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static extern bool TaskManager_StopCurrentTask(IntPtr pedHandle);
+
+        // Task handles are generation-checked; release them once the mod stops tracking the task
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int CreateOneShotTask([MarshalAs(UnmanagedType.LPStr)] string taskName, int priority);
+        
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static extern bool AssignTaskToPed(IntPtr pedHandle, int taskHandle);
+        
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void ReleaseTask(int taskHandle);
+        
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int GetTaskState(int taskHandle);
+        
+        [DllImport(GameDLL, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void GetTaskStates([In] int[] taskHandles, [Out] int[] outStates, int count);
+
+        // Safe wrapper - the native name is static storage, never freed
+        internal static string? TaskManager_GetTaskTypeName(int typeId)
+        {
+            return TypeConversions.PtrToString(TaskManager_GetTaskTypeName_Native(typeId));
+        }
+
         // ═══════════════════════════════════════════════════════════════
         // UTILITY FUNCTIONS - With proper type conversions
         // ═══════════════════════════════════════════════════════════════
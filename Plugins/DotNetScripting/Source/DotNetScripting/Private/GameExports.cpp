@@ -8,6 +8,8 @@
 #include "Materials/MaterialInterface.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/Pawn.h"
+#include "TaskSystemInterop.h"
+#include "EntityQueryInterop.h"
 
 // Forward declarations - no hard dependencies yet
 class UPedFactory;
@@ -516,19 +518,73 @@ extern "C" DOTNETSCRIPTING_API void Ped_SetHeading(void* ped, float heading)
     Ped_SetRotation_Native(ped, rotation);
 }
 
-// TASK SYSTEM (placeholder for now)
+// TASK SYSTEM - task types are dense ids; C# reads the type table once and passes ids from then on
+extern "C" DOTNETSCRIPTING_API int TaskManager_GetTaskTypeCount()
+{
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    return TaskSystem ? TaskSystem->GetTaskTypeCount() : 0;
+}
+
+extern "C" DOTNETSCRIPTING_API const char* TaskManager_GetTaskTypeName(int typeId)
+{
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    return TaskSystem ? TaskSystem->GetTaskTypeName(typeId) : nullptr;
+}
+
+extern "C" DOTNETSCRIPTING_API bool TaskManager_GiveTaskById(void* ped, int typeId, float x, float y, float z)
+{
+    if (!ped) return false;
+
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    if (!TaskSystem)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MODDING] TaskManager_GiveTaskById: task system not available"));
+        return false;
+    }
+
+    return TaskSystem->GiveTaskById(Cast<AActor>(static_cast<UObject*>(ped)), typeId, FVector(x, y, z));
+}
+
+// Name-based entry point kept for older mods; resolves the name and goes through the id path
 extern "C" DOTNETSCRIPTING_API bool TaskManager_GiveTask(void* ped, const char* taskType, float x, float y, float z)
 {
     if (!ped || !taskType) return false;
-    
-    UE_LOG(LogTemp, Log, TEXT("[MODDING] TaskManager_GiveTask: %s"), UTF8_TO_TCHAR(taskType));
-    return false; // TODO: Implement when TaskManager is available
+
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    const int TypeId = TaskSystem ? TaskSystem->FindTaskTypeId(taskType) : INDEX_NONE;
+    if (TypeId == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MODDING] TaskManager_GiveTask: unknown task type %s"), UTF8_TO_TCHAR(taskType));
+        return false;
+    }
+
+    return TaskManager_GiveTaskById(ped, TypeId, x, y, z);
 }
 
 extern "C" DOTNETSCRIPTING_API bool TaskManager_StopCurrentTask(void* ped)
 {
     if (!ped) return false;
-    
-    UE_LOG(LogTemp, Log, TEXT("[MODDING] TaskManager_StopCurrentTask called"));
-    return false; // TODO: Implement
+
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    return TaskSystem && TaskSystem->InterruptCurrentTask(Cast<AActor>(static_cast<UObject*>(ped)));
+}
+
+// ARRAYS - outPeds is caller-owned; the game fills it nearest first from its spatial index
+extern "C" DOTNETSCRIPTING_API int Array_GetPedsInRange(FVector3f_Interop center, float radius, void** outPeds, int maxCount)
+{
+    if (!outPeds || maxCount <= 0) return 0;
+
+    IEntityQueryInterop* EntityQuery = IEntityQueryInterop::Get();
+    if (!EntityQuery)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MODDING] Array_GetPedsInRange: entity queries not available"));
+        return 0;
+    }
+
+    return EntityQuery->GetPedsInRange(GetCurrentWorld(), FVector(center.X, center.Y, center.Z), radius, reinterpret_cast<AActor**>(outPeds), maxCount);
+}
+
+extern "C" DOTNETSCRIPTING_API void Array_FreePedArray(void** pedArray, int count)
+{
+    // Handles are borrowed actor pointers written into the caller's buffer; nothing to release
 }
@@ -10,6 +10,7 @@
 #include "Misc/FileHelper.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "TaskSystemInterop.h"
 
 // Forward declarations for game-specific classes
 // We'll include these when the system builds
@@ -507,101 +508,167 @@ void* FUnrealEngineAPI::FindPedByName(const char* PedName)
 }
 
 // === TASK SYSTEM API IMPLEMENTATIONS ===
+// Task handles come from the game's handle registry (ITaskSystemInterop); they are generation-checked,
+// so a stale handle fails cleanly instead of reaching another task
 
-// Global task handle counter and storage
-static int32 GTaskHandleCounter = 1;
+namespace
+{
+    ITaskSystemInterop* GetTaskSystem(const char* FunctionName)
+    {
+        ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+        if (!TaskSystem)
+        {
+            FUnrealEngineAPI::LogWarning("TaskSystem", TCHAR_TO_UTF8(*FString::Printf(TEXT("%s: game task system not loaded"), UTF8_TO_TCHAR(FunctionName))));
+        }
+        return TaskSystem;
+    }
+
+    AActor* ToActor(void* PedPtr)
+    {
+        return PedPtr ? Cast<AActor>(static_cast<UObject*>(PedPtr)) : nullptr;
+    }
+
+    int32 CreateTaskByName(const char* FunctionName, const char* TaskName, int32 Priority)
+    {
+        ITaskSystemInterop* TaskSystem = GetTaskSystem(FunctionName);
+        if (!TaskSystem || !TaskName)
+        {
+            return 0;
+        }
+
+        const int32 TypeId = TaskSystem->FindTaskTypeId(TaskName);
+        if (TypeId == INDEX_NONE)
+        {
+            FUnrealEngineAPI::LogWarning("TaskSystem", TCHAR_TO_UTF8(*FString::Printf(TEXT("%s: unknown task type '%s'"), UTF8_TO_TCHAR(FunctionName), UTF8_TO_TCHAR(TaskName))));
+            return 0;
+        }
+        return TaskSystem->CreateTask(TypeId, Priority);
+    }
+}
 
 int32 FUnrealEngineAPI::CreateOneShotTask(const char* TaskName, int32 Priority)
 {
-    LogWarning("TaskSystem", "CreateOneShotTask not yet implemented - needs game module link");
-    return 0;
+    return CreateTaskByName("CreateOneShotTask", TaskName, Priority);
 }
 
 int32 FUnrealEngineAPI::CreateComplexTask(const char* TaskName, int32 Priority, const char** SubTaskNames, int32 SubTaskCount)
 {
-    LogWarning("TaskSystem", "CreateComplexTask not yet implemented - needs game module link");
-    return 0;
+    if (SubTaskNames && SubTaskCount > 0)
+    {
+        LogWarning("TaskSystem", "CreateComplexTask: complex tasks define their own phases, sub-task names are ignored");
+    }
+    return CreateTaskByName("CreateComplexTask", TaskName, Priority);
 }
 
 int32 FUnrealEngineAPI::CreateWildComplexTask(const char* TaskName, int32 Priority, bool bAdaptive)
 {
-    LogWarning("TaskSystem", "CreateWildComplexTask not yet implemented - needs game module link");
-    return 0;
+    return CreateTaskByName("CreateWildComplexTask", TaskName, Priority);
 }
 
 bool FUnrealEngineAPI::AssignTaskToPed(void* PedPtr, int32 TaskHandle)
 {
-    LogWarning("TaskSystem", "AssignTaskToPed not yet implemented - needs game module link");
-    return false;
+    ITaskSystemInterop* TaskSystem = GetTaskSystem("AssignTaskToPed");
+    return TaskSystem && TaskSystem->AssignTask(ToActor(PedPtr), TaskHandle);
 }
 
 bool FUnrealEngineAPI::RemoveTaskFromPed(void* PedPtr, int32 TaskHandle)
 {
-    LogWarning("TaskSystem", "RemoveTaskFromPed not yet implemented - needs game module link");
-    return false;
+    ITaskSystemInterop* TaskSystem = GetTaskSystem("RemoveTaskFromPed");
+    return TaskSystem && TaskSystem->RemoveTask(ToActor(PedPtr), TaskHandle);
 }
 
 void FUnrealEngineAPI::ClearAllTasksFromPed(void* PedPtr)
 {
-    LogWarning("TaskSystem", "ClearAllTasksFromPed not yet implemented - needs game module link");
+    if (ITaskSystemInterop* TaskSystem = GetTaskSystem("ClearAllTasksFromPed"))
+    {
+        TaskSystem->ClearAllTasks(ToActor(PedPtr));
+    }
 }
 
 bool FUnrealEngineAPI::InterruptCurrentTask(void* PedPtr)
 {
-    LogWarning("TaskSystem", "InterruptCurrentTask not yet implemented - needs game module link");
-    return false;
+    ITaskSystemInterop* TaskSystem = GetTaskSystem("InterruptCurrentTask");
+    return TaskSystem && TaskSystem->InterruptCurrentTask(ToActor(PedPtr));
+}
+
+void FUnrealEngineAPI::ReleaseTask(int32 TaskHandle)
+{
+    if (ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get())
+    {
+        TaskSystem->ReleaseTask(TaskHandle);
+    }
 }
 
 int32 FUnrealEngineAPI::GetTaskState(int32 TaskHandle)
 {
-    LogWarning("TaskSystem", "GetTaskState not yet implemented - needs game module link");
-    return -1;
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    return TaskSystem ? TaskSystem->GetTaskState(TaskHandle) : (int32)EInteropTaskState::Invalid;
+}
+
+void FUnrealEngineAPI::GetTaskStates(const int32* TaskHandles, int32* OutStates, int32 Count)
+{
+    if (!TaskHandles || !OutStates || Count <= 0)
+    {
+        return;
+    }
+
+    if (ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get())
+    {
+        TaskSystem->GetTaskStates(TaskHandles, OutStates, Count);
+        return;
+    }
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        OutStates[i] = (int32)EInteropTaskState::Invalid;
+    }
 }
 
 bool FUnrealEngineAPI::IsTaskRunning(int32 TaskHandle)
 {
-    return GetTaskState(TaskHandle) == 1;
+    return GetTaskState(TaskHandle) == (int32)EInteropTaskState::Running;
 }
 
 bool FUnrealEngineAPI::IsTaskCompleted(int32 TaskHandle)
 {
-    return GetTaskState(TaskHandle) == 2;
+    return GetTaskState(TaskHandle) == (int32)EInteropTaskState::Completed;
 }
 
 const char* FUnrealEngineAPI::GetTaskName(int32 TaskHandle)
 {
-    LogWarning("TaskSystem", "GetTaskName not yet implemented - needs game module link");
-    return "";
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    const char* TypeName = TaskSystem ? TaskSystem->GetTaskTypeName(TaskSystem->GetTaskTypeId(TaskHandle)) : nullptr;
+    return TypeName ? TypeName : "";
 }
 
 int32 FUnrealEngineAPI::GetTaskPriority(int32 TaskHandle)
 {
-    LogWarning("TaskSystem", "GetTaskPriority not yet implemented - needs game module link");
-    return -1;
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    return TaskSystem ? TaskSystem->GetTaskPriority(TaskHandle) : -1;
 }
 
 int32 FUnrealEngineAPI::GetActiveTaskCount(void* PedPtr)
 {
-    LogWarning("TaskSystem", "GetActiveTaskCount not yet implemented - needs game module link");
-    return 0;
+    ITaskSystemInterop* TaskSystem = GetTaskSystem("GetActiveTaskCount");
+    return TaskSystem ? TaskSystem->GetActiveTaskCount(ToActor(PedPtr)) : 0;
 }
 
 int32 FUnrealEngineAPI::GetCurrentTask(void* PedPtr)
 {
-    LogWarning("TaskSystem", "GetCurrentTask not yet implemented - needs game module link");
-    return 0;
+    ITaskSystemInterop* TaskSystem = GetTaskSystem("GetCurrentTask");
+    return TaskSystem ? TaskSystem->GetCurrentTask(ToActor(PedPtr)) : 0;
 }
 
-void FUnrealEngineAPI::GetAllActiveTasks(void* PedPtr, int32* OutTaskHandles, int32& OutCount)
+void FUnrealEngineAPI::GetAllActiveTasks(void* PedPtr, int32* OutTaskHandles, int32 MaxCount, int32& OutCount)
 {
-    LogWarning("TaskSystem", "GetAllActiveTasks not yet implemented - needs game module link");
-    OutCount = 0;
+    ITaskSystemInterop* TaskSystem = GetTaskSystem("GetAllActiveTasks");
+    OutCount = TaskSystem ? TaskSystem->GetActiveTasks(ToActor(PedPtr), OutTaskHandles, MaxCount) : 0;
 }
 
 void* FUnrealEngineAPI::GetTaskManager(void* PedPtr)
 {
-    LogWarning("TaskSystem", "GetTaskManager not yet implemented - needs game module link");
-    return nullptr;
+    ITaskSystemInterop* TaskSystem = GetTaskSystem("GetTaskManager");
+    return TaskSystem ? TaskSystem->GetTaskManager(ToActor(PedPtr)) : nullptr;
 }
 
 // === PED CORE API IMPLEMENTATIONS ===
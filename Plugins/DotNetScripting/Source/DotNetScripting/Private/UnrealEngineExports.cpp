@@ -168,11 +168,21 @@ extern "C" {
         return FUnrealEngineAPI::InterruptCurrentTask(PedPtr);
     }
 
+    DOTNETSCRIPTING_API void ReleaseTask(int TaskHandle)
+    {
+        FUnrealEngineAPI::ReleaseTask(TaskHandle);
+    }
+
     DOTNETSCRIPTING_API int GetTaskState(int TaskHandle)
     {
         return FUnrealEngineAPI::GetTaskState(TaskHandle);
     }
 
+    DOTNETSCRIPTING_API void GetTaskStates(const int* TaskHandles, int* OutStates, int Count)
+    {
+        FUnrealEngineAPI::GetTaskStates(TaskHandles, OutStates, Count);
+    }
+
     DOTNETSCRIPTING_API bool IsTaskRunning(int TaskHandle)
     {
         return FUnrealEngineAPI::IsTaskRunning(TaskHandle);
@@ -203,11 +213,11 @@ extern "C" {
         return FUnrealEngineAPI::GetCurrentTask(PedPtr);
     }
 
-    DOTNETSCRIPTING_API void GetAllActiveTasks(void* PedPtr, int* OutTaskHandles, int* OutCount)
+    DOTNETSCRIPTING_API void GetAllActiveTasks(void* PedPtr, int* OutTaskHandles, int MaxCount, int* OutCount)
     {
-        if (OutTaskHandles && OutCount)
+        if (OutCount)
         {
-            FUnrealEngineAPI::GetAllActiveTasks(PedPtr, OutTaskHandles, *OutCount);
+            FUnrealEngineAPI::GetAllActiveTasks(PedPtr, OutTaskHandles, MaxCount, *OutCount);
         }
     }
 
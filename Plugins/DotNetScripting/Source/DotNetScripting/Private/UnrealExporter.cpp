@@ -5,6 +5,7 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
+#include "TaskSystemInterop.h"
 
 // Simple type conversion helpers with memory management
 namespace TypeConversion
@@ -251,17 +252,22 @@ extern "C" DOTNETSCRIPTING_API void* UE_SpawnPedFromFactory(const char* Characte
 
 extern "C" DOTNETSCRIPTING_API bool UE_GivePedTaskFromManager(void* Ped, const char* TaskName, float X, float Y, float Z)
 {
-    // TODO: Connect to your Source/Game/Tasks/TaskManager.cpp
-    UE_LogWarning("UnrealExporter", "UE_GivePedTaskFromManager ready for connection to your TaskManager system");
-    
-    // When ready, this will become:
-    // APed* PedActor = static_cast<APed*>(Ped);
-    // UTaskManager* TaskManager = PedActor->GetTaskManager();
-    // UBaseTask* Task = TaskFactory::CreateTask(TaskName, FVector(X,Y,Z));
-    // TaskManager->GiveTask(Task);
-    // return true;
-    
-    return false; // Placeholder
+    ITaskSystemInterop* TaskSystem = ITaskSystemInterop::Get();
+    if (!Ped || !TaskName || !TaskSystem)
+    {
+        UE_LogWarning("UnrealExporter", "UE_GivePedTaskFromManager: invalid ped/task name or task system not loaded");
+        return false;
+    }
+
+    // Resolve the name to a task type id, then take the same path as id-based callers
+    const int32 TypeId = TaskSystem->FindTaskTypeId(TaskName);
+    if (TypeId == INDEX_NONE)
+    {
+        UE_LogWarning("UnrealExporter", "UE_GivePedTaskFromManager: unknown task type");
+        return false;
+    }
+
+    return TaskSystem->GiveTaskById(Cast<AActor>(static_cast<UObject*>(Ped)), TypeId, FVector(X, Y, Z));
 }
 
 extern "C" DOTNETSCRIPTING_API int UE_GetPedTaskStateFromManager(void* Ped)
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Features/IModularFeature.h"
+#include "Features/IModularFeatures.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Entity Query Interop
+ * Proximity queries over the game's spatial entity index for the scripting layer. Registered by the
+ * game module as a modular feature, like ITaskSystemInterop; keep it header-only and free of game types.
+ */
+class IEntityQueryInterop : public IModularFeature
+{
+public:
+    virtual ~IEntityQueryInterop() {}
+
+    static FName GetModularFeatureName()
+    {
+        static const FName FeatureName(TEXT("EntityQueryInterop"));
+        return FeatureName;
+    }
+
+    /** Registered implementation, or nullptr while the game module isn't loaded */
+    static IEntityQueryInterop* Get()
+    {
+        IModularFeatures& ModularFeatures = IModularFeatures::Get();
+        if (!ModularFeatures.IsModularFeatureAvailable(GetModularFeatureName()))
+        {
+            return nullptr;
+        }
+        return &ModularFeatures.GetModularFeature<IEntityQueryInterop>(GetModularFeatureName());
+    }
+
+    /** Write up to MaxCount peds within Radius of Center, nearest first; returns the number written */
+    virtual int32 GetPedsInRange(UWorld* World, const FVector& Center, float Radius, AActor** OutPeds, int32 MaxCount) = 0;
+};
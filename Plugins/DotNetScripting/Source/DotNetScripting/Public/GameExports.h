@@ -111,6 +111,16 @@ extern "C" {
     DOTNETSCRIPTING_API void Ped_GetRotation_Native(void* pedHandle, FRotator_Interop* rotation);
     DOTNETSCRIPTING_API void Ped_SetRotation_Native(void* pedHandle, FRotator_Interop rotation);
 
+    // ═══════════════════════════════════════════════════════════════
+    // TASK SYSTEM FUNCTIONS - Integer task type ids
+    // ═══════════════════════════════════════════════════════════════
+    
+    DOTNETSCRIPTING_API int TaskManager_GetTaskTypeCount();
+    DOTNETSCRIPTING_API const char* TaskManager_GetTaskTypeName(int typeId);
+    DOTNETSCRIPTING_API bool TaskManager_GiveTaskById(void* pedHandle, int typeId, float x, float y, float z);
+    DOTNETSCRIPTING_API bool TaskManager_GiveTask(void* pedHandle, const char* taskType, float x, float y, float z);
+    DOTNETSCRIPTING_API bool TaskManager_StopCurrentTask(void* pedHandle);
+
     // ═══════════════════════════════════════════════════════════════
     // UTILITY FUNCTIONS - Type safe math
     // ═══════════════════════════════════════════════════════════════
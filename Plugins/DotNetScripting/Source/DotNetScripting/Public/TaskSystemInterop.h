@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Features/IModularFeature.h"
+#include "Features/IModularFeatures.h"
+
+class AActor;
+class UObject;
+
+/** Task states as seen through the interop layer; values match ETaskState */
+enum class EInteropTaskState : int32
+{
+    Invalid = -1,
+    Idle,
+    Starting,
+    Running,
+    Paused,
+    Completed,
+    Failed,
+    Cancelled,
+    Interrupted
+};
+
+/**
+ * Task System Interop
+ * Bridge between the scripting layer and the game's task system. The game module registers the
+ * implementation as a modular feature and only takes an include-path dependency on this plugin,
+ * so neither module links against the other. Keep it header-only and free of game types.
+ *
+ * Task types are addressed by dense integer ids. Resolve names to ids once at startup
+ * (GetTaskTypeCount/GetTaskTypeName) and pass ids from then on. Tasks are addressed by
+ * generation-checked handles; 0 is never a valid handle.
+ */
+class ITaskSystemInterop : public IModularFeature
+{
+public:
+    virtual ~ITaskSystemInterop() {}
+
+    static FName GetModularFeatureName()
+    {
+        static const FName FeatureName(TEXT("TaskSystemInterop"));
+        return FeatureName;
+    }
+
+    /** Registered implementation, or nullptr while the game module isn't loaded */
+    static ITaskSystemInterop* Get()
+    {
+        IModularFeatures& ModularFeatures = IModularFeatures::Get();
+        if (!ModularFeatures.IsModularFeatureAvailable(GetModularFeatureName()))
+        {
+            return nullptr;
+        }
+        return &ModularFeatures.GetModularFeature<ITaskSystemInterop>(GetModularFeatureName());
+    }
+
+    // === Task Types ===
+
+    /** Number of task types; valid ids are 0 .. Count-1 */
+    virtual int32 GetTaskTypeCount() const = 0;
+
+    /** UTF-8 name of a task type id, nullptr if out of range. Static storage, never freed */
+    virtual const char* GetTaskTypeName(int32 TypeId) const = 0;
+
+    /** Resolve a task type name to its id, INDEX_NONE if unknown */
+    virtual int32 FindTaskTypeId(const char* TypeName) const = 0;
+
+    // === Task Assignment ===
+
+    /** Create a task by type id and queue it on the ped's task manager; Location feeds location-driven tasks */
+    virtual bool GiveTaskById(AActor* Ped, int32 TypeId, const FVector& Location) = 0;
+
+    // === Task Handles ===
+
+    /** Create an unassigned task of the given type; returns its handle, 0 on failure */
+    virtual int32 CreateTask(int32 TypeId, int32 Priority) = 0;
+
+    /** Free a handle. Queries on it fail afterwards; the task itself keeps running */
+    virtual void ReleaseTask(int32 TaskHandle) = 0;
+
+    virtual bool AssignTask(AActor* Ped, int32 TaskHandle) = 0;
+    virtual bool RemoveTask(AActor* Ped, int32 TaskHandle) = 0;
+    virtual void ClearAllTasks(AActor* Ped) = 0;
+    virtual bool InterruptCurrentTask(AActor* Ped) = 0;
+
+    // === Task Queries ===
+
+    /** EInteropTaskState of a task, Invalid for a stale handle */
+    virtual int32 GetTaskState(int32 TaskHandle) const = 0;
+
+    /** Bulk GetTaskState; OutStates must hold Count entries */
+    virtual void GetTaskStates(const int32* TaskHandles, int32* OutStates, int32 Count) const = 0;
+
+    /** Task type id of a handle, INDEX_NONE for a stale handle */
+    virtual int32 GetTaskTypeId(int32 TaskHandle) const = 0;
+
+    /** ETaskPriority of a task, -1 once the task is gone */
+    virtual int32 GetTaskPriority(int32 TaskHandle) const = 0;
+
+    virtual int32 GetActiveTaskCount(AActor* Ped) const = 0;
+
+    /**
+     * Handle of the ped's running task, 0 if it has none. A task has at most one handle: this returns the
+     * one already handed out (by CreateTask or an earlier query) if it is still live, and registers one
+     * otherwise. Repeat queries don't add handles, but a registered handle stays until ReleaseTask
+     */
+    virtual int32 GetCurrentTask(AActor* Ped) = 0;
+
+    /** Write up to MaxCount handles (current task first, then the queue); returns the number written. Same handle rules as GetCurrentTask */
+    virtual int32 GetActiveTasks(AActor* Ped, int32* OutTaskHandles, int32 MaxCount) = 0;
+
+    virtual UObject* GetTaskManager(AActor* Ped) = 0;
+};
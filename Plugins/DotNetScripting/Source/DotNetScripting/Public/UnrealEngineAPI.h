@@ -70,7 +70,10 @@ public:
     static void ClearAllTasksFromPed(void* PedPtr);
     static bool InterruptCurrentTask(void* PedPtr);
     
+    static void ReleaseTask(int32 TaskHandle);
+    
     static int32 GetTaskState(int32 TaskHandle);
+    static void GetTaskStates(const int32* TaskHandles, int32* OutStates, int32 Count);
     static bool IsTaskRunning(int32 TaskHandle);
     static bool IsTaskCompleted(int32 TaskHandle);
     static const char* GetTaskName(int32 TaskHandle);
@@ -78,7 +81,7 @@ public:
     
     static int32 GetActiveTaskCount(void* PedPtr);
     static int32 GetCurrentTask(void* PedPtr);
-    static void GetAllActiveTasks(void* PedPtr, int32* OutTaskHandles, int32& OutCount);
+    static void GetAllActiveTasks(void* PedPtr, int32* OutTaskHandles, int32 MaxCount, int32& OutCount);
     static void* GetTaskManager(void* PedPtr);
 
     // === PED CORE API ===
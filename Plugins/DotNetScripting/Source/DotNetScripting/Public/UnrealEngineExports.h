@@ -50,15 +50,20 @@ extern "C" {
     DOTNETSCRIPTING_API void ClearAllTasksFromPed(void* PedPtr);
     DOTNETSCRIPTING_API bool InterruptCurrentTask(void* PedPtr);
     
+    DOTNETSCRIPTING_API void ReleaseTask(int TaskHandle);
+    
     DOTNETSCRIPTING_API int GetTaskState(int TaskHandle);
+    DOTNETSCRIPTING_API void GetTaskStates(const int* TaskHandles, int* OutStates, int Count);
     DOTNETSCRIPTING_API bool IsTaskRunning(int TaskHandle);
     DOTNETSCRIPTING_API bool IsTaskCompleted(int TaskHandle);
     DOTNETSCRIPTING_API const char* GetTaskName(int TaskHandle);
     DOTNETSCRIPTING_API int GetTaskPriority(int TaskHandle);
     
     DOTNETSCRIPTING_API int GetActiveTaskCount(void* PedPtr);
+    // Query handles are the task's one shared handle (repeat calls return the same value); ReleaseTask it once done
     DOTNETSCRIPTING_API int GetCurrentTask(void* PedPtr);
-    DOTNETSCRIPTING_API void GetAllActiveTasks(void* PedPtr, int* OutTaskHandles, int* OutCount);
+    // Writes up to MaxCount handles (current task first, then the queue) and the number written to OutCount
+    DOTNETSCRIPTING_API void GetAllActiveTasks(void* PedPtr, int* OutTaskHandles, int MaxCount, int* OutCount);
     DOTNETSCRIPTING_API void* GetTaskManager(void* PedPtr);
 
     // === PED CORE EXPORTS ===
@@ -2,6 +2,7 @@
 #include "Engine/Engine.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
+#include "tinyxml2.h"
 
 UAnimationGroupsLoader::UAnimationGroupsLoader()
 {
@@ -17,9 +18,9 @@ bool UAnimationGroupsLoader::LoadAnimationGroupsFromXML(const FString& XMLFilePa
         FilePath = FPaths::ProjectDir() + TEXT("Data/Animations/AnimationGroups.xml");
     }
 
-    // Read the XML file
-    FString XMLContent;
-    if (!FFileHelper::LoadFileToString(XMLContent, *FilePath))
+    // Read the raw bytes; TinyXML2 parses UTF-8 directly, so there is no widening round trip through FString
+    TArray<uint8> XMLData;
+    if (!FFileHelper::LoadFileToArray(XMLData, *FilePath))
     {
         UE_LOG(LogTemp, Error, TEXT("AnimationGroupsLoader: Failed to load XML file from %s"), *FilePath);
         return false;
@@ -27,97 +28,79 @@ bool UAnimationGroupsLoader::LoadAnimationGroupsFromXML(const FString& XMLFilePa
 
     UE_LOG(LogTemp, Log, TEXT("AnimationGroupsLoader: Successfully loaded XML file from %s"), *FilePath);
 
-    // Parse the XML content
-    return ParseXMLContent(XMLContent);
+    return LoadAnimationGroupsFromBuffer(reinterpret_cast<const ANSICHAR*>(XMLData.GetData()), XMLData.Num());
 }
 
-bool UAnimationGroupsLoader::ParseXMLContent(const FString& XMLContent)
+bool UAnimationGroupsLoader::LoadAnimationGroupsFromBuffer(const ANSICHAR* XMLData, int32 XMLLength)
 {
-    LoadedDictionaries.Empty();
+    LoadedDictionaries.Reset();
 
-    // Find all AnimationDictionary elements
-    TArray<FString> DictionaryElements = SplitXMLElements(XMLContent, TEXT("AnimationDictionary"));
-
-    for (const FString& Element : DictionaryElements)
+    tinyxml2::XMLDocument Doc;
+    if (Doc.Parse(XMLData, XMLLength) != tinyxml2::XML_SUCCESS)
     {
-        FAnimationDictionaryDefinition Definition = ParseDictionaryElement(Element);
-        if (!Definition.Name.IsEmpty())
-        {
-            LoadedDictionaries.Add(Definition);
-            UE_LOG(LogTemp, Log, TEXT("AnimationGroupsLoader: Loaded dictionary '%s' -> '%s' (%s)"), 
-                   *Definition.Name, *Definition.Path, *EntityTypeToString(Definition.EntityType));
-        }
+        UE_LOG(LogTemp, Error, TEXT("AnimationGroupsLoader: Failed to parse XML: %s"), UTF8_TO_TCHAR(Doc.ErrorStr()));
+        RebuildIndices();
+        return false;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("AnimationGroupsLoader: Loaded %d animation dictionaries"), LoadedDictionaries.Num());
-    return LoadedDictionaries.Num() > 0;
-}
+    const tinyxml2::XMLElement* Root = Doc.RootElement();
+    const tinyxml2::XMLElement* FirstElement = Root ? Root->FirstChildElement("AnimationDictionary") : nullptr;
 
-FAnimationDictionaryDefinition UAnimationGroupsLoader::ParseDictionaryElement(const FString& ElementContent)
-{
-    FAnimationDictionaryDefinition Definition;
+    // Walking the sibling links is far cheaper than growing the array, so size it up front
+    int32 ElementCount = 0;
+    for (const tinyxml2::XMLElement* Element = FirstElement; Element; Element = Element->NextSiblingElement("AnimationDictionary"))
+    {
+        ++ElementCount;
+    }
+    LoadedDictionaries.Reserve(ElementCount);
 
-    // Extract attributes
-    Definition.Name = ExtractAttributeValue(ElementContent, TEXT("Name"));
-    Definition.Path = ExtractAttributeValue(ElementContent, TEXT("Path"));
-    FString EntityTypeStr = ExtractAttributeValue(ElementContent, TEXT("EntityType"));
-    Definition.EntityType = StringToEntityType(EntityTypeStr);
+    for (const tinyxml2::XMLElement* Element = FirstElement; Element; Element = Element->NextSiblingElement("AnimationDictionary"))
+    {
+        const char* Name = Element->Attribute("Name");
+        if (!Name || !*Name)
+        {
+            continue;
+        }
 
-    // Generate description
-    Definition.Description = FString::Printf(TEXT("%s animations for %s"), 
-                                           *Definition.Name, *EntityTypeToString(Definition.EntityType));
+        const char* Path = Element->Attribute("Path");
+        const char* EntityType = Element->Attribute("EntityType");
 
-    return Definition;
-}
+        FAnimationDictionaryDefinition& Definition = LoadedDictionaries.AddDefaulted_GetRef();
+        Definition.Name = UTF8_TO_TCHAR(Name);
+        Definition.Path = Path ? FString(UTF8_TO_TCHAR(Path)) : FString();
+        Definition.EntityType = EntityType ? StringToEntityType(UTF8_TO_TCHAR(EntityType)) : EAnimationEntityType::UNKNOWN;
+        Definition.Description = FString::Printf(TEXT("%s animations for %s"),
+                                                 *Definition.Name, *EntityTypeToString(Definition.EntityType));
 
-FString UAnimationGroupsLoader::ExtractAttributeValue(const FString& ElementContent, const FString& AttributeName)
-{
-    FString SearchPattern = AttributeName + TEXT("=\"");
-    int32 StartIndex = ElementContent.Find(SearchPattern);
-    if (StartIndex == INDEX_NONE)
-    {
-        return TEXT("");
+        UE_LOG(LogTemp, Verbose, TEXT("AnimationGroupsLoader: Loaded dictionary '%s' -> '%s' (%s)"),
+               *Definition.Name, *Definition.Path, *EntityTypeToString(Definition.EntityType));
     }
 
-    StartIndex += SearchPattern.Len();
-    int32 EndIndex = ElementContent.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, StartIndex);
-    if (EndIndex == INDEX_NONE)
-    {
-        return TEXT("");
-    }
+    RebuildIndices();
 
-    return ElementContent.Mid(StartIndex, EndIndex - StartIndex);
+    UE_LOG(LogTemp, Log, TEXT("AnimationGroupsLoader: Loaded %d animation dictionaries"), LoadedDictionaries.Num());
+    return LoadedDictionaries.Num() > 0;
 }
 
-TArray<FString> UAnimationGroupsLoader::SplitXMLElements(const FString& XMLContent, const FString& ElementName)
+void UAnimationGroupsLoader::RebuildIndices()
 {
-    TArray<FString> Elements;
-    FString StartTag = TEXT("<") + ElementName;
-    FString EndTag = TEXT("/>");
+    EntityTypeIndices.Reset();
+    EntityTypeIndices.SetNum(static_cast<int32>(EAnimationEntityType::UNKNOWN) + 1);
+    DictionaryNameIndices.Reset();
+    DictionaryNameIndices.Reserve(LoadedDictionaries.Num());
 
-    int32 SearchStart = 0;
-    while (true)
+    for (int32 Index = 0; Index < LoadedDictionaries.Num(); ++Index)
     {
-        int32 StartIndex = XMLContent.Find(StartTag, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchStart);
-        if (StartIndex == INDEX_NONE)
-        {
-            break;
-        }
+        const FAnimationDictionaryDefinition& Definition = LoadedDictionaries[Index];
+        EntityTypeIndices[static_cast<int32>(Definition.EntityType)].Add(Index);
 
-        int32 EndIndex = XMLContent.Find(EndTag, ESearchCase::CaseSensitive, ESearchDir::FromStart, StartIndex);
-        if (EndIndex == INDEX_NONE)
+        // First definition wins, matching the old linear search
+        const FName Key(*Definition.Name);
+        if (!DictionaryNameIndices.Contains(Key))
         {
-            break;
+            DictionaryNameIndices.Add(Key, Index);
         }
-
-        EndIndex += EndTag.Len();
-        FString Element = XMLContent.Mid(StartIndex, EndIndex - StartIndex);
-        Elements.Add(Element);
-
-        SearchStart = EndIndex;
     }
-
-    return Elements;
 }
 
 void UAnimationGroupsLoader::SetupDictionariesFromGroups(UPedAnimationDictionary* TargetDictionary)
@@ -159,104 +142,83 @@ void UAnimationGroupsLoader::SetupContextsFromGroups(UPedAnimationDictionary* Ta
 
     UE_LOG(LogTemp, Log, TEXT("AnimationGroupsLoader: Setting up contexts from loaded groups..."));
 
-    // Get PED dictionaries
-    TArray<FAnimationDictionaryDefinition> PedDictionaries = GetDictionariesByEntityType(EAnimationEntityType::PED);
-
-    // Create OnFoot context (replaces Movement)
-    FAnimationContext OnFootContext;
+    // Create the contexts up front so each PED dictionary is classified in a single pass below
+    FAnimationContext OnFootContext; // Replaces Movement
     OnFootContext.ContextName = TEXT("OnFoot");
     OnFootContext.CurrentDictionaryName = TEXT("Move_Player");
-    for (const FAnimationDictionaryDefinition& Dict : PedDictionaries)
-    {
-        if (Dict.Name.Contains(TEXT("Move_")) && !Dict.Name.Contains(TEXT("Combat")) && !Dict.Name.Contains(TEXT("Crouch")))
-        {
-            OnFootContext.AvailableDictionaries.AddUnique(Dict.Name);
-        }
-    }
-    TargetDictionary->AddContext(OnFootContext);
 
-    // Create Crouch context
     FAnimationContext CrouchContext;
     CrouchContext.ContextName = TEXT("Crouch");
     CrouchContext.CurrentDictionaryName = TEXT("Crouch_Standard");
-    for (const FAnimationDictionaryDefinition& Dict : PedDictionaries)
-    {
-        if (Dict.Name.Contains(TEXT("Crouch")) || Dict.Name.Contains(TEXT("Stealth")))
-        {
-            CrouchContext.AvailableDictionaries.AddUnique(Dict.Name);
-        }
-    }
-    TargetDictionary->AddContext(CrouchContext);
 
-    // Create Jump context
     FAnimationContext JumpContext;
     JumpContext.ContextName = TEXT("Jump");
     JumpContext.CurrentDictionaryName = TEXT("Jump_Standard");
-    for (const FAnimationDictionaryDefinition& Dict : PedDictionaries)
-    {
-        if (Dict.Name.Contains(TEXT("Jump")) || Dict.Name.Contains(TEXT("Climb")))
-        {
-            JumpContext.AvailableDictionaries.AddUnique(Dict.Name);
-        }
-    }
-    TargetDictionary->AddContext(JumpContext);
 
-    // Create Combat context
     FAnimationContext CombatContext;
     CombatContext.ContextName = TEXT("Combat");
     CombatContext.CurrentDictionaryName = TEXT("Move_Combat_Strafe");
-    for (const FAnimationDictionaryDefinition& Dict : PedDictionaries)
-    {
-        if (Dict.Name.Contains(TEXT("Combat")) || Dict.Name.Contains(TEXT("Weapon")))
-        {
-            CombatContext.AvailableDictionaries.AddUnique(Dict.Name);
-        }
-    }
-    TargetDictionary->AddContext(CombatContext);
 
-    // Create Cover context
     FAnimationContext CoverContext;
     CoverContext.ContextName = TEXT("Cover");
     CoverContext.CurrentDictionaryName = TEXT("Ped_Combat_Cover"); // Assuming this exists
-    for (const FAnimationDictionaryDefinition& Dict : PedDictionaries)
-    {
-        if (Dict.Name.Contains(TEXT("Cover")) || Dict.Name.Contains(TEXT("Peek")))
-        {
-            CoverContext.AvailableDictionaries.AddUnique(Dict.Name);
-        }
-    }
-    TargetDictionary->AddContext(CoverContext);
 
-    // Create InVehicle context
     FAnimationContext InVehicleContext;
     InVehicleContext.ContextName = TEXT("InVehicle");
     InVehicleContext.CurrentDictionaryName = TEXT("Vehicle_Standard");
-    TArray<FAnimationDictionaryDefinition> VehicleDictionaries = GetDictionariesByEntityType(EAnimationEntityType::VEHICLE);
-    for (const FAnimationDictionaryDefinition& Dict : VehicleDictionaries)
-    {
-        InVehicleContext.AvailableDictionaries.AddUnique(Dict.Name);
-    }
-    // Also add ped vehicle animations
-    for (const FAnimationDictionaryDefinition& Dict : PedDictionaries)
-    {
-        if (Dict.Name.Contains(TEXT("Vehicle")) || Dict.Name.Contains(TEXT("Driving")))
-        {
-            InVehicleContext.AvailableDictionaries.AddUnique(Dict.Name);
-        }
-    }
-    TargetDictionary->AddContext(InVehicleContext);
 
-    // Create Interaction context
     FAnimationContext InteractionContext;
     InteractionContext.ContextName = TEXT("Interaction");
     InteractionContext.CurrentDictionaryName = TEXT("Ped_Interactions");
-    for (const FAnimationDictionaryDefinition& Dict : PedDictionaries)
+
+    // Vehicle dictionaries all belong to InVehicle, ahead of the ped vehicle animations
+    for (const int32 Index : GetDictionaryIndicesByEntityType(EAnimationEntityType::VEHICLE))
     {
-        if (Dict.Name.Contains(TEXT("Interaction")) || Dict.Name.Contains(TEXT("Emote")))
+        InVehicleContext.AvailableDictionaries.AddUnique(LoadedDictionaries[Index].Name);
+    }
+
+    for (const int32 Index : GetDictionaryIndicesByEntityType(EAnimationEntityType::PED))
+    {
+        const FString& Name = LoadedDictionaries[Index].Name;
+        const bool bCombat = Name.Contains(TEXT("Combat"));
+        const bool bCrouch = Name.Contains(TEXT("Crouch"));
+
+        if (Name.Contains(TEXT("Move_")) && !bCombat && !bCrouch)
+        {
+            OnFootContext.AvailableDictionaries.AddUnique(Name);
+        }
+        if (bCrouch || Name.Contains(TEXT("Stealth")))
         {
-            InteractionContext.AvailableDictionaries.AddUnique(Dict.Name);
+            CrouchContext.AvailableDictionaries.AddUnique(Name);
+        }
+        if (Name.Contains(TEXT("Jump")) || Name.Contains(TEXT("Climb")))
+        {
+            JumpContext.AvailableDictionaries.AddUnique(Name);
+        }
+        if (bCombat || Name.Contains(TEXT("Weapon")))
+        {
+            CombatContext.AvailableDictionaries.AddUnique(Name);
+        }
+        if (Name.Contains(TEXT("Cover")) || Name.Contains(TEXT("Peek")))
+        {
+            CoverContext.AvailableDictionaries.AddUnique(Name);
+        }
+        if (Name.Contains(TEXT("Vehicle")) || Name.Contains(TEXT("Driving")))
+        {
+            InVehicleContext.AvailableDictionaries.AddUnique(Name);
+        }
+        if (Name.Contains(TEXT("Interaction")) || Name.Contains(TEXT("Emote")))
+        {
+            InteractionContext.AvailableDictionaries.AddUnique(Name);
         }
     }
+
+    TargetDictionary->AddContext(OnFootContext);
+    TargetDictionary->AddContext(CrouchContext);
+    TargetDictionary->AddContext(JumpContext);
+    TargetDictionary->AddContext(CombatContext);
+    TargetDictionary->AddContext(CoverContext);
+    TargetDictionary->AddContext(InVehicleContext);
     TargetDictionary->AddContext(InteractionContext);
 
     UE_LOG(LogTemp, Log, TEXT("AnimationGroupsLoader: Created 7 animation contexts (OnFoot, Crouch, Jump, Combat, Cover, InVehicle, Interaction)"));
@@ -426,32 +388,27 @@ FAnimationEntry UAnimationGroupsLoader::CreateAnimEntry(const FString& AnimName,
 
 TArray<FAnimationDictionaryDefinition> UAnimationGroupsLoader::GetDictionariesByEntityType(EAnimationEntityType EntityType)
 {
+    const TConstArrayView<int32> Indices = GetDictionaryIndicesByEntityType(EntityType);
+
     TArray<FAnimationDictionaryDefinition> FilteredDictionaries;
-    for (const FAnimationDictionaryDefinition& Dict : LoadedDictionaries)
+    FilteredDictionaries.Reserve(Indices.Num());
+    for (const int32 Index : Indices)
     {
-        if (Dict.EntityType == EntityType)
-        {
-            FilteredDictionaries.Add(Dict);
-        }
+        FilteredDictionaries.Add(LoadedDictionaries[Index]);
     }
     return FilteredDictionaries;
 }
 
 FAnimationDictionaryDefinition UAnimationGroupsLoader::GetDictionaryByName(const FString& DictionaryName)
 {
-    for (const FAnimationDictionaryDefinition& Dict : LoadedDictionaries)
-    {
-        if (Dict.Name == DictionaryName)
-        {
-            return Dict;
-        }
-    }
-    return FAnimationDictionaryDefinition();
+    const int32 Index = FindDictionaryIndex(DictionaryName);
+    return Index != INDEX_NONE ? LoadedDictionaries[Index] : FAnimationDictionaryDefinition();
 }
 
 TArray<FString> UAnimationGroupsLoader::GetAllDictionaryNames()
 {
     TArray<FString> Names;
+    Names.Reserve(LoadedDictionaries.Num());
     for (const FAnimationDictionaryDefinition& Dict : LoadedDictionaries)
     {
         Names.Add(Dict.Name);
@@ -461,17 +418,36 @@ TArray<FString> UAnimationGroupsLoader::GetAllDictionaryNames()
 
 TArray<FString> UAnimationGroupsLoader::GetDictionaryNamesByEntityType(EAnimationEntityType EntityType)
 {
+    const TConstArrayView<int32> Indices = GetDictionaryIndicesByEntityType(EntityType);
+
     TArray<FString> Names;
-    for (const FAnimationDictionaryDefinition& Dict : LoadedDictionaries)
+    Names.Reserve(Indices.Num());
+    for (const int32 Index : Indices)
     {
-        if (Dict.EntityType == EntityType)
-        {
-            Names.Add(Dict.Name);
-        }
+        Names.Add(LoadedDictionaries[Index].Name);
     }
     return Names;
 }
 
+TConstArrayView<int32> UAnimationGroupsLoader::GetDictionaryIndicesByEntityType(EAnimationEntityType EntityType) const
+{
+    const int32 TypeIndex = static_cast<int32>(EntityType);
+    return EntityTypeIndices.IsValidIndex(TypeIndex) ? TConstArrayView<int32>(EntityTypeIndices[TypeIndex]) : TConstArrayView<int32>();
+}
+
+int32 UAnimationGroupsLoader::FindDictionaryIndex(const FString& DictionaryName) const
+{
+    // FNAME_Find: a name that was never interned cannot be a loaded dictionary
+    const FName Key(*DictionaryName, FNAME_Find);
+    if (Key.IsNone())
+    {
+        return INDEX_NONE;
+    }
+
+    const int32* Index = DictionaryNameIndices.Find(Key);
+    return Index ? *Index : INDEX_NONE;
+}
+
 FString UAnimationGroupsLoader::ConvertPathToUAssetPath(const FString& GamePath)
 {
     // Convert from "Game/Animations/..." to "/Game/Content/Animations/..."
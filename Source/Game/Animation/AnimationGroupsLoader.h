@@ -68,6 +68,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Animation Groups Loading")
     bool LoadAnimationGroupsFromXML(const FString& XMLFilePath = TEXT(""));
 
+    /**
+     * Parse AnimationGroups XML already in memory (UTF-8) in a single TinyXML2 pass, replacing
+     * LoadedDictionaries and rebuilding the lookup indices
+     */
+    bool LoadAnimationGroupsFromBuffer(const ANSICHAR* XMLData, int32 XMLLength);
+
     UFUNCTION(BlueprintCallable, Category = "Animation Groups Loading")
     void SetupDictionariesFromGroups(UPedAnimationDictionary* TargetDictionary);
 
@@ -87,6 +93,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Animation Groups Query")
     TArray<FString> GetDictionaryNamesByEntityType(EAnimationEntityType EntityType);
 
+    /** Indices into LoadedDictionaries of every definition of EntityType, in file order; no copies */
+    TConstArrayView<int32> GetDictionaryIndicesByEntityType(EAnimationEntityType EntityType) const;
+
+    /** Index into LoadedDictionaries of the first definition named DictionaryName, or INDEX_NONE */
+    int32 FindDictionaryIndex(const FString& DictionaryName) const;
+
     // Utility Functions
     UFUNCTION(BlueprintCallable, Category = "Animation Groups Utility")
     FString ConvertPathToUAssetPath(const FString& GamePath);
@@ -98,11 +110,11 @@ public:
     FString EntityTypeToString(EAnimationEntityType EntityType);
 
 private:
-    // Internal XML parsing functions
-    bool ParseXMLContent(const FString& XMLContent);
-    FAnimationDictionaryDefinition ParseDictionaryElement(const FString& ElementContent);
-    FString ExtractAttributeValue(const FString& ElementContent, const FString& AttributeName);
-    TArray<FString> SplitXMLElements(const FString& XMLContent, const FString& ElementName);
+    // Lookup indices into LoadedDictionaries, never serialized
+    TArray<TArray<int32>> EntityTypeIndices; // One array per EAnimationEntityType
+    TMap<FName, int32> DictionaryNameIndices;
+
+    void RebuildIndices();
 
     // Default animation entry creation for known folder structures
     void CreateDefaultAnimationEntries(FAnimationDictionary& Dictionary, const FString& DictionaryName);
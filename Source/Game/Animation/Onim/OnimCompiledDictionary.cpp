@@ -0,0 +1,253 @@
+#include "OnimCompiledDictionary.h"
+#include "Algo/BinarySearch.h"
+
+using namespace OnimCompiled;
+
+FOnimCompiledDictionary::FOnimCompiledDictionary()
+{
+    SourceHash = 0;
+}
+
+FOnimCompiledDictionary::~FOnimCompiledDictionary()
+{
+    Close();
+}
+
+bool FOnimCompiledDictionary::Open(const FString& FilePath)
+{
+    Close();
+
+    if (!File.Open(FilePath))
+    {
+        return false;
+    }
+
+    if (!Validate())
+    {
+        UE_LOG(LogTemp, Error, TEXT("OnimCompiledDictionary: '%s' is not a valid version %d dictionary"), *FilePath, (int32)Version);
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void FOnimCompiledDictionary::Close()
+{
+    File.Close();
+    SourceHash = 0;
+
+    Clips = {};
+    Tracks = {};
+    Channels = {};
+    Keys = {};
+    BoneIds = {};
+    Names = {};
+    Strings = {};
+    Sources = {};
+}
+
+int32 FOnimCompiledDictionary::FindClip(FUtf8StringView Name) const
+{
+    int32 Low = 0;
+    int32 High = Clips.Num();
+    while (Low < High)
+    {
+        const int32 Mid = (Low + High) / 2;
+        const int32 Compare = GetClipName(Mid).Compare(Name);
+        if (Compare == 0)
+        {
+            return Mid;
+        }
+        if (Compare < 0)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+    return INDEX_NONE;
+}
+
+int32 FOnimCompiledDictionary::FindClip(const FString& Name) const
+{
+    const FTCHARToUTF8 Utf8(*Name);
+    return FindClip(FUtf8StringView((const UTF8CHAR*)Utf8.Get(), Utf8.Length()));
+}
+
+TArrayView<const FOnimTrackRecord> FOnimCompiledDictionary::GetTracks(int32 ClipIndex) const
+{
+    const FOnimClipRecord& Clip = Clips[ClipIndex];
+    return Tracks.Slice(Clip.FirstTrack, Clip.NumTracks);
+}
+
+TArrayView<const FOnimChannelRecord> FOnimCompiledDictionary::GetChannels(const FOnimTrackRecord& Track) const
+{
+    if (Track.Encoding != (uint8)ETrackEncoding::Channels)
+    {
+        return {};
+    }
+    return Channels.Slice(Track.FirstChannel, Track.NumChannels);
+}
+
+void FOnimCompiledDictionary::SampleFloats(const FOnimTrackRecord& Track, float Frame, float* OutValues) const
+{
+    if (Track.Encoding == (uint8)ETrackEncoding::SmallestThree48)
+    {
+        const FQuat4f Rotation = OnimCompiled::SampleRotation(Track, Keys.GetData(), Frame);
+        OutValues[0] = Rotation.X;
+        OutValues[1] = Rotation.Y;
+        OutValues[2] = Rotation.Z;
+        OutValues[3] = Rotation.W;
+        return;
+    }
+    OnimCompiled::SampleChannels(Track, Channels.GetData() + Track.FirstChannel, Keys.GetData(), Frame, OutValues);
+}
+
+uint32 FOnimCompiledDictionary::SampleUInt(const FOnimTrackRecord& Track, int32 Frame) const
+{
+    const FKeyPair Pair = OnimCompiled::FindKeys(Track, Keys.GetData(), (float)Frame);
+    return OnimCompiled::DecodeUInt(Channels[Track.FirstChannel], Keys.GetData(), Pair.Key0);
+}
+
+FUtf8StringView FOnimCompiledDictionary::FindName(uint32 Hash) const
+{
+    const int32 Index = Algo::BinarySearchBy(Names, Hash, &FNameRecord::Hash);
+    return Index != INDEX_NONE ? GetString(Names[Index].Name) : FUtf8StringView();
+}
+
+FUtf8StringView FOnimCompiledDictionary::GetString(const FStringRef& Ref) const
+{
+    return FUtf8StringView((const UTF8CHAR*)Strings.GetData() + Ref.Offset, (int32)Ref.Length);
+}
+
+bool FOnimCompiledDictionary::Validate()
+{
+    const FOnimCompiledHeader* Header = File.GetHeader<FOnimCompiledHeader>();
+    if (!Header || Header->Magic != Magic || Header->Version != Version || Header->FileSize != (uint64)File.GetSize() ||
+        !File.ReadSectionTable(sizeof(FOnimCompiledHeader), Header->NumSections, (uint32)ESection::Count, SectionAlignment))
+    {
+        return false;
+    }
+
+    if (!File.GetSectionView((uint32)ESection::Clips, Clips) ||
+        !File.GetSectionView((uint32)ESection::Tracks, Tracks) ||
+        !File.GetSectionView((uint32)ESection::Channels, Channels) ||
+        !File.GetSectionView((uint32)ESection::Keys, Keys) ||
+        !File.GetSectionView((uint32)ESection::BoneIds, BoneIds) ||
+        !File.GetSectionView((uint32)ESection::Names, Names) ||
+        !File.GetSectionView((uint32)ESection::Strings, Strings) ||
+        !File.GetSectionView((uint32)ESection::Sources, Sources))
+    {
+        return false;
+    }
+
+    if (Clips.Num() != (int32)Header->NumClips || Sources.Num() != Clips.Num())
+    {
+        return false;
+    }
+
+    auto IsValidString = [this](const FStringRef& Ref)
+    {
+        return (uint64)Ref.Offset + Ref.Length <= (uint64)Strings.Num();
+    };
+
+    for (const FNameRecord& Name : Names)
+    {
+        if (!IsValidString(Name.Name))
+        {
+            return false;
+        }
+    }
+
+    // Constant channels read the shared zero key at offset 0
+    if (Keys.Num() < (int32)sizeof(uint32) || *(const uint32*)Keys.GetData() != 0)
+    {
+        return false;
+    }
+
+    auto IsValidKeyRange = [this](uint32 Offset, int64 KeySize, int64 NumKeys)
+    {
+        return IsAligned(Offset, KeySize) && (int64)Offset + KeySize * NumKeys <= Keys.Num();
+    };
+
+    // Every range a sampler can reach is checked once here, so decoding never bounds-checks
+    for (const FOnimClipRecord& Clip : Clips)
+    {
+        if (!IsValidString(Clip.Name) || (uint64)Clip.FirstTrack + Clip.NumTracks > (uint64)Tracks.Num() || Clip.NumFrames == 0)
+        {
+            return false;
+        }
+
+        for (uint32 TrackIndex = Clip.FirstTrack; TrackIndex < Clip.FirstTrack + Clip.NumTracks; ++TrackIndex)
+        {
+            const FOnimTrackRecord& Track = Tracks[TrackIndex];
+            if (Track.Kind >= (uint8)EOnimTrackKind::Count || Track.Type >= (uint8)EOnimValueType::Count ||
+                Track.NumChannels != Onim::GetNumChannels((EOnimValueType)Track.Type) || Track.BoneIndex >= BoneIds.Num() ||
+                Track.NumKeys == 0 || Track.NumKeys > Clip.NumFrames)
+            {
+                return false;
+            }
+
+            // Key frames must run from the first frame to the last, strictly ascending
+            if (Track.KeyFramesOffset == EveryFrame)
+            {
+                if (Track.NumKeys != 1 && Track.NumKeys != Clip.NumFrames)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                if (Track.NumKeys < 2 || !IsValidKeyRange(Track.KeyFramesOffset, sizeof(uint16), Track.NumKeys))
+                {
+                    return false;
+                }
+                const uint16* KeyFrames = (const uint16*)(Keys.GetData() + Track.KeyFramesOffset);
+                if (KeyFrames[0] != 0 || KeyFrames[Track.NumKeys - 1] != Clip.NumFrames - 1)
+                {
+                    return false;
+                }
+                for (int32 Key = 1; Key < Track.NumKeys; ++Key)
+                {
+                    if (KeyFrames[Key] <= KeyFrames[Key - 1])
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            if (Track.Encoding == (uint8)ETrackEncoding::SmallestThree48)
+            {
+                if (Track.Type != (uint8)EOnimValueType::Float4 || !IsValidKeyRange(Track.RotationKeyOffset, sizeof(uint16), 3 * (int64)Track.NumKeys))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            if (Track.Encoding != (uint8)ETrackEncoding::Channels || (uint64)Track.FirstChannel + Track.NumChannels > (uint64)Channels.Num())
+            {
+                return false;
+            }
+
+            const bool bFloat = Onim::IsFloatType((EOnimValueType)Track.Type);
+            for (uint32 ChannelIndex = Track.FirstChannel; ChannelIndex < Track.FirstChannel + Track.NumChannels; ++ChannelIndex)
+            {
+                const FOnimChannelRecord& Channel = Channels[ChannelIndex];
+                const EChannelEncoding Encoding = (EChannelEncoding)Channel.Encoding;
+                const bool bValidEncoding = Encoding == EChannelEncoding::Constant ||
+                    (bFloat ? Encoding == EChannelEncoding::Quantized16 : Encoding == EChannelEncoding::Raw32);
+                if (!bValidEncoding || Channel.KeyStride != (Encoding == EChannelEncoding::Constant ? 0 : 1) ||
+                    !IsValidKeyRange(Channel.KeyOffset, bFloat ? sizeof(uint16) : sizeof(uint32), Channel.KeyStride ? Track.NumKeys : 1))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    SourceHash = Header->SourceHash;
+    return true;
+}
@@ -0,0 +1,359 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnimTypes.h"
+#include "Core/Utils/SectionedFile.h"
+
+/**
+ * Compiled Onim Dictionary
+ * Binary form of one Data/Animations/<dictionary> folder, written by FOnimCompiler. Layout:
+ *
+ *   FOnimCompiledHeader
+ *   FSectionedFileSection[NumSections]
+ *   sections, each starting on a 16-byte boundary
+ *
+ * Clips are sorted by name and each owns a range of tracks. A track stores NumKeys keys: one when it
+ * is constant, one per frame, or a reduced set whose frame numbers follow in the Keys section, with
+ * frames in between linearly interpolated. Rotation tracks pack each key as a 48-bit smallest-three
+ * quaternion; other tracks own a range of channels, float keys quantised to 16 bits over the
+ * channel's own [Min, Min + 65535 * Scale] range and UInt keys stored raw.
+ *
+ * Decoding never switches on encodings per value: constant channels have a key stride of zero and
+ * read the zero key at the start of the Keys section. Bone ids live in one table per dictionary and
+ * tracks refer to them by index.
+ */
+namespace OnimCompiled
+{
+    static constexpr uint32 Magic = 0x434D4E4F; // "ONMC"
+    static constexpr uint16 Version = 2;
+    static constexpr int64 SectionAlignment = 16;
+    static constexpr int32 QuantizedMax = MAX_uint16;
+
+    /** FOnimTrackRecord::KeyFramesOffset when key N is frame N */
+    static constexpr uint32 EveryFrame = MAX_uint32;
+
+    /** Smallest-three: the three smaller components, 15 bits each over [-1/sqrt(2), 1/sqrt(2)] */
+    static constexpr int32 RotationComponentBits = 15;
+    static constexpr int32 RotationComponentMax = (1 << RotationComponentBits) - 1;
+    static constexpr float RotationComponentRange = UE_INV_SQRT_2;
+    static constexpr int32 RotationKeySize = 3 * sizeof(uint16);
+
+    enum class ESection : uint32
+    {
+        Clips,      // FOnimClipRecord[NumClips], sorted by name
+        Tracks,     // FOnimTrackRecord[], ranges referenced by clips
+        Channels,   // FOnimChannelRecord[], ranges referenced by tracks
+        Keys,       // zero key, then key frame, rotation and channel key arrays, each 4-byte aligned
+        BoneIds,    // uint32[] bone ids referenced by tracks
+        Names,      // FNameRecord[] for hashed UInt values (facial clip names etc.)
+        Strings,    // UTF-8 blob referenced by clip and name records
+        Sources,    // FSourceRecord[NumClips], the .onim file each clip came from
+        Count
+    };
+
+    enum class ETrackEncoding : uint8
+    {
+        /** Per-channel records (positions, other floats, UInts) */
+        Channels,
+        /** NumKeys 48-bit smallest-three quaternions (rotations) */
+        SmallestThree48
+    };
+
+    enum class EChannelEncoding : uint8
+    {
+        /** One value for every key: Min, or UIntValue for UInt channels; key stride 0 */
+        Constant,
+        /** uint16 keys, value = Min + Key * Scale */
+        Quantized16,
+        /** uint32 keys, value = UIntValue (zero) + Key */
+        Raw32
+    };
+
+    struct FStringRef
+    {
+        uint32 Offset;
+        uint32 Length;
+    };
+
+    struct FNameRecord
+    {
+        uint32 Hash;
+        FStringRef Name;
+    };
+
+    /** Size and modification time of a clip's source at compile time, for the incremental check */
+    struct FSourceRecord
+    {
+        int64 Size;
+        int64 TimestampTicks;
+    };
+}
+
+struct FOnimCompiledHeader
+{
+    uint32 Magic;
+    uint16 Version;
+    uint8 NumSections;
+    uint8 Reserved;
+    uint32 NumClips;
+    uint32 Reserved2;
+    /** xxHash64 over every source file's name and the xxHash64 of its bytes, in clip order */
+    uint64 SourceHash;
+    uint64 FileSize;
+};
+
+struct FOnimClipRecord
+{
+    OnimCompiled::FStringRef Name;
+    uint32 FirstTrack;
+    uint32 NumTracks;
+    uint32 NumFrames;
+    uint32 NumSequences;
+    uint32 SequenceFrameLimit;
+    float Duration;
+    uint32 Flags;
+    uint32 ExtraFlags;
+    int32 MaterialID;
+    uint32 Field10;
+    uint16 VersionMajor;
+    uint16 VersionMinor;
+    uint32 Reserved;
+};
+
+struct FOnimTrackRecord
+{
+    /** EOnimTrackKind */
+    uint8 Kind;
+    /** EOnimValueType */
+    uint8 Type;
+    uint8 NumChannels;
+    /** OnimCompiled::ETrackEncoding */
+    uint8 Encoding;
+    /** Index into the BoneIds section */
+    uint16 BoneIndex;
+    /** 1 for constant tracks, NumFrames for unreduced ones */
+    uint16 NumKeys;
+    /** Byte offset of NumKeys ascending uint16 frame numbers in the Keys section, or EveryFrame */
+    uint32 KeyFramesOffset;
+    union
+    {
+        /** Channels encoding: first of NumChannels channel records */
+        uint32 FirstChannel;
+        /** SmallestThree48 encoding: byte offset of the rotation keys in the Keys section */
+        uint32 RotationKeyOffset;
+    };
+};
+
+struct FOnimChannelRecord
+{
+    /** OnimCompiled::EChannelEncoding */
+    uint8 Encoding;
+    /** 0 for constant channels, 1 otherwise; multiplies the key index so decoding never branches */
+    uint8 KeyStride;
+    uint8 Reserved[2];
+    /** Byte offset of the channel's keys in the Keys section */
+    uint32 KeyOffset;
+    union
+    {
+        float Min;
+        /** UInt channels: the constant value, zero for Raw32 */
+        uint32 UIntValue;
+    };
+    float Scale;
+};
+
+static_assert(sizeof(FOnimCompiledHeader) == 32, "Onim header layout changed; bump OnimCompiled::Version");
+static_assert(sizeof(FOnimClipRecord) == 56, "Onim clip record layout changed; bump OnimCompiled::Version");
+static_assert(sizeof(FOnimTrackRecord) == 16, "Onim track record layout changed; bump OnimCompiled::Version");
+static_assert(sizeof(FOnimChannelRecord) == 16, "Onim channel record layout changed; bump OnimCompiled::Version");
+
+namespace OnimCompiled
+{
+    /** The stored keys either side of a frame and the blend between them */
+    struct FKeyPair
+    {
+        int32 Key0;
+        int32 Key1;
+        float Alpha;
+    };
+
+    /** Keys bracketing a fractional frame; frames outside the clip clamp to its ends */
+    inline FKeyPair FindKeys(const FOnimTrackRecord& Track, const uint8* Keys, float Frame)
+    {
+        const int32 LastKey = Track.NumKeys - 1;
+        if (Track.KeyFramesOffset == EveryFrame)
+        {
+            const float Clamped = FMath::Clamp(Frame, 0.0f, (float)LastKey);
+            const int32 Key0 = (int32)Clamped;
+            return { Key0, FMath::Min(Key0 + 1, LastKey), Clamped - (float)Key0 };
+        }
+
+        // Branchless binary search for the last key at or before Frame
+        const uint16* KeyFrames = (const uint16*)(Keys + Track.KeyFramesOffset);
+        int32 Base = 0;
+        int32 Count = Track.NumKeys;
+        while (Count > 1)
+        {
+            const int32 Half = Count / 2;
+            Base = (float)KeyFrames[Base + Half] <= Frame ? Base + Half : Base;
+            Count -= Half;
+        }
+
+        const int32 Key1 = FMath::Min(Base + 1, LastKey);
+        const float Span = (float)FMath::Max(KeyFrames[Key1] - KeyFrames[Base], 1);
+        return { Base, Key1, FMath::Clamp((Frame - (float)KeyFrames[Base]) / Span, 0.0f, 1.0f) };
+    }
+
+    inline float DecodeFloat(const FOnimChannelRecord& Channel, const uint8* Keys, int32 Key)
+    {
+        return Channel.Min + ((const uint16*)(Keys + Channel.KeyOffset))[Key * Channel.KeyStride] * Channel.Scale;
+    }
+
+    inline uint32 DecodeUInt(const FOnimChannelRecord& Channel, const uint8* Keys, int32 Key)
+    {
+        return Channel.UIntValue + ((const uint32*)(Keys + Channel.KeyOffset))[Key * Channel.KeyStride];
+    }
+
+    /** Unit quaternion to smallest-three: 2-bit index of the dropped component, then 3 x 15 bits */
+    inline void PackRotation(const FQuat4f& Rotation, uint16* OutKey)
+    {
+        const FQuat4f Normalized = Rotation.GetNormalized();
+        const float Components[4] = { Normalized.X, Normalized.Y, Normalized.Z, Normalized.W };
+
+        int32 Largest = 0;
+        for (int32 Index = 1; Index < 4; ++Index)
+        {
+            Largest = FMath::Abs(Components[Index]) > FMath::Abs(Components[Largest]) ? Index : Largest;
+        }
+
+        // q and -q are the same rotation; flip so the dropped component is positive
+        const float Sign = Components[Largest] < 0.0f ? -1.0f : 1.0f;
+        uint64 Bits = (uint64)Largest << (3 * RotationComponentBits);
+        for (int32 Index = 0; Index < 3; ++Index)
+        {
+            const float Component = Components[(Largest + 1 + Index) & 3] * Sign;
+            const float Unit = (Component + RotationComponentRange) / (2.0f * RotationComponentRange);
+            const uint64 Quantized = (uint64)FMath::Clamp(FMath::RoundToInt32(Unit * RotationComponentMax), 0, RotationComponentMax);
+            Bits |= Quantized << ((2 - Index) * RotationComponentBits);
+        }
+
+        OutKey[0] = (uint16)Bits;
+        OutKey[1] = (uint16)(Bits >> 16);
+        OutKey[2] = (uint16)(Bits >> 32);
+    }
+
+    inline FQuat4f UnpackRotation(const uint16* Key)
+    {
+        const uint64 Bits = (uint64)Key[0] | ((uint64)Key[1] << 16) | ((uint64)Key[2] << 32);
+        const int32 Largest = (int32)(Bits >> (3 * RotationComponentBits)) & 3;
+        const float Scale = 2.0f * RotationComponentRange / RotationComponentMax;
+
+        const float A = (float)((Bits >> (2 * RotationComponentBits)) & RotationComponentMax) * Scale - RotationComponentRange;
+        const float B = (float)((Bits >> RotationComponentBits) & RotationComponentMax) * Scale - RotationComponentRange;
+        const float C = (float)(Bits & RotationComponentMax) * Scale - RotationComponentRange;
+
+        float Components[4];
+        Components[(Largest + 1) & 3] = A;
+        Components[(Largest + 2) & 3] = B;
+        Components[(Largest + 3) & 3] = C;
+        Components[Largest] = FMath::Sqrt(FMath::Max(1.0f - A * A - B * B - C * C, 0.0f));
+        return FQuat4f(Components[0], Components[1], Components[2], Components[3]);
+    }
+
+    /** Rotation of a SmallestThree48 track; keys are blended with a shortest-path nlerp */
+    inline FQuat4f SampleRotation(const FOnimTrackRecord& Track, const uint8* Keys, float Frame)
+    {
+        const FKeyPair Pair = FindKeys(Track, Keys, Frame);
+        const uint16* RotationKeys = (const uint16*)(Keys + Track.RotationKeyOffset);
+        const FQuat4f Rotation0 = UnpackRotation(RotationKeys + Pair.Key0 * 3);
+        const FQuat4f Rotation1 = UnpackRotation(RotationKeys + Pair.Key1 * 3);
+        return FQuat4f::FastLerp(Rotation0, Rotation1, Pair.Alpha).GetNormalized();
+    }
+
+    /** Every channel of a Channels-encoded float track into OutValues[NumChannels] */
+    inline void SampleChannels(const FOnimTrackRecord& Track, const FOnimChannelRecord* Channels, const uint8* Keys, float Frame, float* OutValues)
+    {
+        const FKeyPair Pair = FindKeys(Track, Keys, Frame);
+        for (int32 Channel = 0; Channel < Track.NumChannels; ++Channel)
+        {
+            const float Value0 = DecodeFloat(Channels[Channel], Keys, Pair.Key0);
+            const float Value1 = DecodeFloat(Channels[Channel], Keys, Pair.Key1);
+            OutValues[Channel] = Value0 + (Value1 - Value0) * Pair.Alpha;
+        }
+    }
+}
+
+/**
+ * Read-only view of a compiled dictionary
+ * Opens the file through FSectionedFileReader and validates every record range before handing out
+ * views. Views stay valid for the reader's lifetime.
+ */
+class GAME_API FOnimCompiledDictionary
+{
+public:
+    FOnimCompiledDictionary();
+    ~FOnimCompiledDictionary();
+
+    bool Open(const FString& FilePath);
+    void Close();
+
+    bool IsOpen() const { return File.IsOpen(); }
+    bool IsMemoryMapped() const { return File.IsMemoryMapped(); }
+
+    uint64 GetSourceHash() const { return SourceHash; }
+    int64 GetFileSize() const { return File.GetSize(); }
+
+    // === Clips ===
+
+    int32 Num() const { return Clips.Num(); }
+    TArrayView<const FOnimClipRecord> GetClips() const { return Clips; }
+    FUtf8StringView GetClipName(int32 ClipIndex) const { return GetString(Clips[ClipIndex].Name); }
+
+    /** Binary search by clip name (the .onim file name without extension); INDEX_NONE if absent */
+    int32 FindClip(FUtf8StringView Name) const;
+    int32 FindClip(const FString& Name) const;
+
+    TArrayView<const FOnimTrackRecord> GetTracks(int32 ClipIndex) const;
+    uint32 GetBoneId(const FOnimTrackRecord& Track) const { return BoneIds[Track.BoneIndex]; }
+
+    /** Channel records of a Channels-encoded track; empty for rotation tracks */
+    TArrayView<const FOnimChannelRecord> GetChannels(const FOnimTrackRecord& Track) const;
+
+    // === Sampling ===
+    // Frames are fractional; values between stored keys are interpolated, UInt values are not
+
+    OnimCompiled::FKeyPair FindKeys(const FOnimTrackRecord& Track, float Frame) const { return OnimCompiled::FindKeys(Track, Keys.GetData(), Frame); }
+
+    /** Rotation of a BoneRotation/ModelRotation track */
+    FQuat4f SampleRotation(const FOnimTrackRecord& Track, float Frame) const { return OnimCompiled::SampleRotation(Track, Keys.GetData(), Frame); }
+
+    /** Any float track into OutValues[NumChannels]; rotation tracks write X, Y, Z, W */
+    void SampleFloats(const FOnimTrackRecord& Track, float Frame, float* OutValues) const;
+
+    /** Value of a UInt track at a whole frame */
+    uint32 SampleUInt(const FOnimTrackRecord& Track, int32 Frame) const;
+
+    /** Original name of a hashed UInt value, empty if it was numeric in the source */
+    FUtf8StringView FindName(uint32 Hash) const;
+
+    // === Sources ===
+
+    TArrayView<const OnimCompiled::FSourceRecord> GetSources() const { return Sources; }
+
+private:
+    FUtf8StringView GetString(const OnimCompiled::FStringRef& Ref) const;
+
+    bool Validate();
+
+    FSectionedFileReader File;
+    uint64 SourceHash;
+
+    TArrayView<const FOnimClipRecord> Clips;
+    TArrayView<const FOnimTrackRecord> Tracks;
+    TArrayView<const FOnimChannelRecord> Channels;
+    TArrayView<const uint8> Keys;
+    TArrayView<const uint32> BoneIds;
+    TArrayView<const OnimCompiled::FNameRecord> Names;
+    TArrayView<const uint8> Strings;
+    TArrayView<const OnimCompiled::FSourceRecord> Sources;
+};
@@ -0,0 +1,374 @@
+#include "OnimCompiler.h"
+#include "OnimCompiledDictionary.h"
+#include "OnimParser.h"
+#include "OnimCompression.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Hash/xxhash.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Paths.h"
+
+using namespace OnimCompiled;
+
+FString FOnimCompiler::GetSourceRoot()
+{
+    return FPaths::ProjectDir() / TEXT("Data/Animations");
+}
+
+FString FOnimCompiler::GetSourceDir(const FString& DictionaryName)
+{
+    return GetSourceRoot() / DictionaryName;
+}
+
+FString FOnimCompiler::GetCompiledPath(const FString& DictionaryName)
+{
+    return GetSourceRoot() / DictionaryName + TEXT(".onimc");
+}
+
+void FOnimCompiler::GetDictionaryNames(TArray<FString>& OutNames)
+{
+    TArray<FString> Folders;
+    IFileManager::Get().FindFiles(Folders, *(GetSourceRoot() / TEXT("*")), false, true);
+    Folders.Sort();
+
+    for (const FString& Folder : Folders)
+    {
+        TArray<FString> Files;
+        IFileManager::Get().FindFiles(Files, *(GetSourceDir(Folder) / TEXT("*.onim")), true, false);
+        if (Files.Num() > 0)
+        {
+            OutNames.Add(Folder);
+        }
+    }
+}
+
+void FOnimCompiler::GetSourceFiles(const FString& DictionaryName, TArray<FString>& OutFiles)
+{
+    const FString SourceDir = GetSourceDir(DictionaryName);
+    TArray<FString> Files;
+    IFileManager::Get().FindFiles(Files, *(SourceDir / TEXT("*.onim")), true, false);
+
+    // Case-sensitive on ASCII names is UTF-8 byte order, which is what FindClip's binary search expects
+    Files.Sort([](const FString& A, const FString& B)
+    {
+        return FPaths::GetBaseFilename(A).Compare(FPaths::GetBaseFilename(B), ESearchCase::CaseSensitive) < 0;
+    });
+
+    for (const FString& File : Files)
+    {
+        OutFiles.Add(SourceDir / File);
+    }
+}
+
+bool FOnimCompiler::IsUpToDate(const FString& DictionaryName)
+{
+    const FString CompiledPath = GetCompiledPath(DictionaryName);
+    FOnimCompiledDictionary Dictionary;
+    if (!Dictionary.Open(CompiledPath))
+    {
+        return false;
+    }
+
+    TArray<FString> SourceFiles;
+    GetSourceFiles(DictionaryName, SourceFiles);
+    if (SourceFiles.Num() != Dictionary.Num())
+    {
+        return false;
+    }
+
+    const TArrayView<const FSourceRecord> Sources = Dictionary.GetSources();
+    bool bStatsMatch = true;
+    for (int32 Index = 0; Index < SourceFiles.Num(); ++Index)
+    {
+        const FFileStatData Stat = IFileManager::Get().GetStatData(*SourceFiles[Index]);
+        if (!Stat.bIsValid || Dictionary.FindClip(FPaths::GetBaseFilename(SourceFiles[Index])) != Index)
+        {
+            return false;
+        }
+        bStatsMatch &= Stat.FileSize == Sources[Index].Size && Stat.ModificationTime.GetTicks() == Sources[Index].TimestampTicks;
+    }
+    if (bStatsMatch)
+    {
+        return true;
+    }
+
+    // Checkouts and copies touch timestamps without changing content; only a content change recompiles.
+    // The mapped binary is never patched in place, so the stale stats stay until the next compile rewrites it
+    uint64 SourceHash = 0;
+    return HashSources(SourceFiles, SourceHash) && SourceHash == Dictionary.GetSourceHash();
+}
+
+bool FOnimCompiler::HashSources(const TArray<FString>& SourceFiles, uint64& OutHash)
+{
+    TArray<uint64> FileHashes;
+    FileHashes.SetNumZeroed(SourceFiles.Num());
+    std::atomic<bool> bReadFailed(false);
+
+    ParallelFor(SourceFiles.Num(), [&](int32 Index)
+        {
+            FOnimSourceFile File;
+            if (!File.Open(SourceFiles[Index]))
+            {
+                bReadFailed = true;
+                return;
+            }
+            FileHashes[Index] = FXxHash64::HashBuffer(File.GetData(), File.GetSize()).Hash;
+        },
+        EParallelForFlags::Unbalanced);
+
+    if (bReadFailed)
+    {
+        return false;
+    }
+
+    OutHash = CombineSourceHashes(SourceFiles, FileHashes);
+    return true;
+}
+
+uint64 FOnimCompiler::CombineSourceHashes(const TArray<FString>& SourceFiles, const TArray<uint64>& FileHashes)
+{
+    FXxHash64Builder HashBuilder;
+    for (int32 Index = 0; Index < SourceFiles.Num(); ++Index)
+    {
+        const FTCHARToUTF8 NameUtf8(*FPaths::GetBaseFilename(SourceFiles[Index]));
+        HashBuilder.Update(NameUtf8.Get(), NameUtf8.Length());
+        HashBuilder.Update(&FileHashes[Index], sizeof(uint64));
+    }
+    return HashBuilder.Finalize().Hash;
+}
+
+bool FOnimCompiler::CompileDictionary(const FString& DictionaryName, FOnimCompileStats* OutStats, const FOnimCompressionSettings& Settings)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<FString> SourceFiles;
+    GetSourceFiles(DictionaryName, SourceFiles);
+    if (SourceFiles.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("OnimCompiler: No .onim files in '%s'"), *GetSourceDir(DictionaryName));
+        return false;
+    }
+
+    FOnimCompileStats Stats;
+    TArray<FOnimClipSource> Clips;
+    Clips.SetNum(SourceFiles.Num());
+    TArray<uint64> FileHashes;
+    FileHashes.SetNumZeroed(SourceFiles.Num());
+    TArray<int64> FileSizes;
+    FileSizes.SetNumZeroed(SourceFiles.Num());
+    TArray<FSourceRecord> Sources;
+    Sources.SetNumZeroed(SourceFiles.Num());
+    TArray<FString> Errors;
+    Errors.SetNum(SourceFiles.Num());
+
+    // Files are independent: stat, map, hash and parse each on its own worker
+    ParallelFor(SourceFiles.Num(), [&](int32 Index)
+        {
+            // Stat before reading, so an edit that lands mid-compile leaves the stats stale rather than the hash
+            const FFileStatData Stat = IFileManager::Get().GetStatData(*SourceFiles[Index]);
+            FOnimSourceFile File;
+            if (!Stat.bIsValid || !File.Open(SourceFiles[Index]))
+            {
+                Errors[Index] = TEXT("could not read file");
+                return;
+            }
+            Sources[Index] = { Stat.FileSize, Stat.ModificationTime.GetTicks() };
+
+            FOnimClipSource& Clip = Clips[Index];
+            Clip.Name = FPaths::GetBaseFilename(SourceFiles[Index]);
+            FileHashes[Index] = FXxHash64::HashBuffer(File.GetData(), File.GetSize()).Hash;
+            FileSizes[Index] = File.GetSize();
+
+            FOnimParser::Parse(File.GetData(), File.GetSize(), Clip, Errors[Index]);
+        },
+        EParallelForFlags::Unbalanced);
+
+    for (int32 Index = 0; Index < SourceFiles.Num(); ++Index)
+    {
+        if (!Errors[Index].IsEmpty())
+        {
+            UE_LOG(LogTemp, Error, TEXT("OnimCompiler: %s: %s"), *SourceFiles[Index], *Errors[Index]);
+            return false;
+        }
+        Stats.SourceBytes += FileSizes[Index];
+    }
+
+    const FString CompiledPath = GetCompiledPath(DictionaryName);
+    if (!WriteDictionary(CompiledPath, Clips, Sources, CombineSourceHashes(SourceFiles, FileHashes), Settings, Stats))
+    {
+        return false;
+    }
+
+    Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+    UE_LOG(LogTemp, Log, TEXT("OnimCompiler: %s: %d clips, %d tracks, %lld -> %lld bytes (%.1f:1), max error %g, max rotation error %g rad, %.1f ms"),
+           *DictionaryName, Stats.NumClips, Stats.NumTracks, Stats.RawBytes, Stats.CompiledBytes, Stats.GetCompressionRatio(),
+           Stats.MaxError, Stats.MaxRotationError, Stats.Seconds * 1000.0);
+
+    if (OutStats)
+    {
+        *OutStats = Stats;
+    }
+    return true;
+}
+
+bool FOnimCompiler::CompileDictionary(const FString& DictionaryName, FOnimCompileStats* OutStats)
+{
+    return CompileDictionary(DictionaryName, OutStats, FOnimCompressionSettings());
+}
+
+bool FOnimCompiler::EnsureCompiled(const FString& DictionaryName)
+{
+    return IsUpToDate(DictionaryName) || CompileDictionary(DictionaryName);
+}
+
+bool FOnimCompiler::OpenDictionary(const FString& DictionaryName, FOnimCompiledDictionary& OutDictionary)
+{
+#if !UE_BUILD_SHIPPING
+    // Development builds ship the text sources too; keep the binary in step with them
+    if (IFileManager::Get().DirectoryExists(*GetSourceDir(DictionaryName)) && !EnsureCompiled(DictionaryName))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("OnimCompiler: Could not compile '%s'; using the existing binary if any"), *DictionaryName);
+    }
+#endif
+
+    if (!OutDictionary.Open(GetCompiledPath(DictionaryName)))
+    {
+        UE_LOG(LogTemp, Error, TEXT("OnimCompiler: No compiled dictionary for '%s'"), *DictionaryName);
+        return false;
+    }
+    return true;
+}
+
+bool FOnimCompiler::WriteDictionary(const FString& FilePath, const TArray<FOnimClipSource>& Clips, const TArray<FSourceRecord>& Sources,
+                                    uint64 SourceHash, const FOnimCompressionSettings& Settings, FOnimCompileStats& Stats)
+{
+    TArray<FOnimClipRecord> ClipRecords;
+    TArray<FOnimTrackRecord> TrackRecords;
+    TArray<FOnimChannelRecord> ChannelRecords;
+    TArray<uint8> Keys;
+    TArray<uint32> BoneIds;
+    TMap<uint32, uint16> BoneIndices;
+    TArray<FNameRecord> Names;
+    TArray<uint8> Strings;
+
+    // The shared zero key constant channels read
+    Keys.AddZeroed(sizeof(uint32));
+
+    auto AppendString = [&Strings](const FString& String)
+    {
+        FTCHARToUTF8 Utf8(*String);
+        const FStringRef Ref = { (uint32)Strings.Num(), (uint32)Utf8.Length() };
+        Strings.Append((const uint8*)Utf8.Get(), Utf8.Length());
+        return Ref;
+    };
+
+    TMap<uint32, FString> ValueNames;
+    for (int32 ClipIndex = 0; ClipIndex < Clips.Num(); ++ClipIndex)
+    {
+        const FOnimClipSource& Clip = Clips[ClipIndex];
+        if (Clip.NumFrames > MAX_uint16)
+        {
+            UE_LOG(LogTemp, Error, TEXT("OnimCompiler: '%s' has %d frames; at most %d are supported"), *Clip.Name, Clip.NumFrames, MAX_uint16);
+            return false;
+        }
+        ValueNames.Append(Clip.ValueNames);
+
+        FOnimClipRecord& ClipRecord = ClipRecords.AddZeroed_GetRef();
+        ClipRecord.Name = AppendString(Clip.Name);
+        ClipRecord.FirstTrack = (uint32)TrackRecords.Num();
+        ClipRecord.NumTracks = (uint32)Clip.Tracks.Num();
+        ClipRecord.NumFrames = (uint32)Clip.NumFrames;
+        ClipRecord.NumSequences = (uint32)Clip.NumSequences;
+        ClipRecord.SequenceFrameLimit = (uint32)Clip.SequenceFrameLimit;
+        ClipRecord.Duration = Clip.Duration;
+        ClipRecord.Flags = Clip.Flags;
+        ClipRecord.ExtraFlags = Clip.ExtraFlags;
+        ClipRecord.MaterialID = Clip.MaterialID;
+        ClipRecord.Field10 = Clip.Field10;
+        ClipRecord.VersionMajor = Clip.VersionMajor;
+        ClipRecord.VersionMinor = Clip.VersionMinor;
+
+        for (const FOnimTrackSource& Track : Clip.Tracks)
+        {
+            uint16* BoneIndex = BoneIndices.Find(Track.Id);
+            if (!BoneIndex)
+            {
+                if (BoneIds.Num() > MAX_uint16)
+                {
+                    UE_LOG(LogTemp, Error, TEXT("OnimCompiler: More than %d distinct bone ids in one dictionary"), MAX_uint16 + 1);
+                    return false;
+                }
+                BoneIndex = &BoneIndices.Add(Track.Id, (uint16)BoneIds.Add(Track.Id));
+            }
+
+            FOnimTrackRecord& TrackRecord = TrackRecords.AddZeroed_GetRef();
+            TrackRecord.Kind = (uint8)Track.Kind;
+            TrackRecord.Type = (uint8)Track.Type;
+            TrackRecord.BoneIndex = *BoneIndex;
+
+            const int32 FirstChannel = ChannelRecords.Num();
+            const FOnimTrackCompressionResult Result = FOnimCompression::CompressTrack(Track, Clip.NumFrames, Settings, TrackRecord, ChannelRecords, Keys);
+
+            Stats.SourceKeys += Clip.NumFrames;
+            Stats.StoredKeys += Result.NumKeys;
+            Stats.RawBytes += (int64)Clip.NumFrames * Track.GetNumChannels() * (int64)sizeof(float);
+            Stats.NumConstantTracks += Result.NumKeys == 1 ? 1 : 0;
+            if (Result.bRotation)
+            {
+                ++Stats.NumRotationTracks;
+                Stats.MaxRotationError = FMath::Max(Stats.MaxRotationError, Result.MaxError);
+            }
+            else
+            {
+                Stats.MaxError = FMath::Max(Stats.MaxError, Result.MaxError);
+            }
+
+            for (int32 Channel = FirstChannel; Channel < ChannelRecords.Num(); ++Channel)
+            {
+                Stats.NumConstantChannels += ChannelRecords[Channel].Encoding == (uint8)EChannelEncoding::Constant ? 1 : 0;
+            }
+        }
+    }
+
+    // Sorted by hash for FindName's binary search
+    ValueNames.KeySort(TLess<uint32>());
+    for (const TPair<uint32, FString>& Name : ValueNames)
+    {
+        Names.Add({ Name.Key, AppendString(Name.Value) });
+    }
+
+    Stats.NumClips = ClipRecords.Num();
+    Stats.NumTracks = TrackRecords.Num();
+    Stats.NumChannels = ChannelRecords.Num();
+
+    // Section order matches ESection
+    FSectionedFileWriter Writer(sizeof(FOnimCompiledHeader), SectionAlignment);
+    Writer.AddArray((uint32)ESection::Clips, ClipRecords);
+    Writer.AddArray((uint32)ESection::Tracks, TrackRecords);
+    Writer.AddArray((uint32)ESection::Channels, ChannelRecords);
+    Writer.AddArray((uint32)ESection::Keys, Keys);
+    Writer.AddArray((uint32)ESection::BoneIds, BoneIds);
+    Writer.AddArray((uint32)ESection::Names, Names);
+    Writer.AddArray((uint32)ESection::Strings, Strings);
+    Writer.AddArray((uint32)ESection::Sources, Sources);
+    check(Writer.NumSections() == (int32)ESection::Count);
+
+    const int64 FileSize = Writer.Layout();
+
+    FOnimCompiledHeader Header;
+    FMemory::Memzero(Header);
+    Header.Magic = Magic;
+    Header.Version = Version;
+    Header.NumSections = (uint8)Writer.NumSections();
+    Header.NumClips = (uint32)ClipRecords.Num();
+    Header.SourceHash = SourceHash;
+    Header.FileSize = (uint64)FileSize;
+
+    if (!Writer.Write(FilePath, &Header, TEXT("OnimCompiler")))
+    {
+        return false;
+    }
+
+    Stats.CompiledBytes = FileSize;
+    return true;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FOnimCompiledDictionary;
+struct FOnimClipSource;
+struct FOnimCompressionSettings;
+
+namespace OnimCompiled
+{
+    struct FSourceRecord;
+}
+
+/** What one dictionary compile produced */
+struct FOnimCompileStats
+{
+    int32 NumClips = 0;
+    int32 NumTracks = 0;
+    int32 NumRotationTracks = 0;
+    /** Tracks reduced to a single key */
+    int32 NumConstantTracks = 0;
+    int32 NumChannels = 0;
+    int32 NumConstantChannels = 0;
+    /** One key per frame per track in the sources, against the keys kept after reduction */
+    int64 SourceKeys = 0;
+    int64 StoredKeys = 0;
+    int64 SourceBytes = 0;
+    /** Every frame of every channel as a 4-byte value: the size before compression */
+    int64 RawBytes = 0;
+    int64 CompiledBytes = 0;
+    /** Largest absolute difference between a source float and its sampled value, rotations excepted */
+    float MaxError = 0.0f;
+    /** Largest angle, in radians, between a source rotation and its sampled value */
+    float MaxRotationError = 0.0f;
+    double Seconds = 0.0;
+
+    double GetCompressionRatio() const { return CompiledBytes > 0 ? (double)RawBytes / CompiledBytes : 0.0; }
+};
+
+/**
+ * Onim Compiler
+ * Turns the text .onim files of one Data/Animations/<dictionary> folder into a compiled dictionary
+ * next to it (Data/Animations/<dictionary>.onimc) that FOnimCompiledDictionary maps directly.
+ *
+ * A compiled dictionary records each source's size and timestamp plus a content hash of all of them.
+ * IsUpToDate compares the cheap stats first and only hashes the sources when they differ, so runtime
+ * lookups normally never read the text and a touched-but-unchanged source never recompiles. Compile from the
+ * OnimCompile commandlet, or let OpenDictionary compile stale dictionaries on demand in development
+ * builds. Shipping builds only ever map the binary.
+ */
+class GAME_API FOnimCompiler
+{
+public:
+    /** Folder holding the dictionary folders */
+    static FString GetSourceRoot();
+
+    static FString GetSourceDir(const FString& DictionaryName);
+    static FString GetCompiledPath(const FString& DictionaryName);
+
+    /** Every folder under the source root that holds .onim files */
+    static void GetDictionaryNames(TArray<FString>& OutNames);
+
+    /** Source .onim paths of a dictionary, sorted by clip name as the compiled clips are */
+    static void GetSourceFiles(const FString& DictionaryName, TArray<FString>& OutFiles);
+
+    /**
+     * True if the compiled dictionary exists and matches the sources' names, sizes and timestamps. When
+     * the stats differ the sources are hashed instead; if their content still matches the dictionary counts
+     * as up to date. The binary is never patched in place, so it keeps its old stats (and is hashed on each
+     * check) until the next compile.
+     */
+    static bool IsUpToDate(const FString& DictionaryName);
+
+    /**
+     * Parse every .onim of the dictionary and write its compiled form. Settings are not recorded in the
+     * binary, so recompiling with new tolerances needs an explicit compile rather than EnsureCompiled.
+     */
+    static bool CompileDictionary(const FString& DictionaryName, FOnimCompileStats* OutStats, const FOnimCompressionSettings& Settings);
+    static bool CompileDictionary(const FString& DictionaryName, FOnimCompileStats* OutStats = nullptr);
+
+    /** Compile the dictionary if it is missing or stale; true if an up-to-date binary exists afterwards */
+    static bool EnsureCompiled(const FString& DictionaryName);
+
+    /** Map a compiled dictionary, compiling it first if stale (development builds only) */
+    static bool OpenDictionary(const FString& DictionaryName, FOnimCompiledDictionary& OutDictionary);
+
+private:
+    /** SourceHash of the files as they are now; false if one can't be read */
+    static bool HashSources(const TArray<FString>& SourceFiles, uint64& OutHash);
+
+    /** xxHash64 over every source's clip name and the xxHash64 of its bytes, in clip order */
+    static uint64 CombineSourceHashes(const TArray<FString>& SourceFiles, const TArray<uint64>& FileHashes);
+
+    /** Sources holds each clip's stats as captured when its file was read */
+    static bool WriteDictionary(const FString& FilePath, const TArray<FOnimClipSource>& Clips, const TArray<OnimCompiled::FSourceRecord>& Sources,
+                                uint64 SourceHash, const FOnimCompressionSettings& Settings, FOnimCompileStats& Stats);
+};
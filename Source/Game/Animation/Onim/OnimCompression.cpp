@@ -0,0 +1,351 @@
+#include "OnimCompression.h"
+#include "OnimCompiledDictionary.h"
+
+using namespace OnimCompiled;
+
+namespace OnimCompressionPrivate
+{
+    /** Append Size zeroed bytes on a 4-byte boundary and return their offset */
+    uint32 AllocateKeys(TArray<uint8>& Keys, int32 Size)
+    {
+        Keys.SetNumZeroed(Align(Keys.Num(), (int32)sizeof(uint32)));
+        const uint32 Offset = (uint32)Keys.Num();
+        Keys.AddZeroed(Size);
+        return Offset;
+    }
+
+    /**
+     * Greedy linear key reduction: from each kept key, extend the segment for as long as CanSpan(Start, End)
+     * says interpolating Start to End reproduces every frame in between. The first and last frames are kept.
+     */
+    template<typename PredicateType>
+    void ReduceKeys(int32 NumFrames, PredicateType&& CanSpan, TArray<int32>& OutFrames)
+    {
+        OutFrames.Reset();
+        OutFrames.Add(0);
+
+        int32 Start = 0;
+        while (Start < NumFrames - 1)
+        {
+            int32 End = Start + 1;
+            while (End + 1 < NumFrames && CanSpan(Start, End + 1))
+            {
+                ++End;
+            }
+            OutFrames.Add(End);
+            Start = End;
+        }
+    }
+
+    /** Kept frame numbers into Keys, or EveryFrame when nothing was dropped */
+    uint32 WriteKeyFrames(const TArray<int32>& Frames, int32 NumFrames, TArray<uint8>& Keys)
+    {
+        if (Frames.Num() == NumFrames)
+        {
+            return EveryFrame;
+        }
+
+        const uint32 Offset = AllocateKeys(Keys, Frames.Num() * (int32)sizeof(uint16));
+        uint16* KeyFrames = (uint16*)(Keys.GetData() + Offset);
+        for (int32 Key = 0; Key < Frames.Num(); ++Key)
+        {
+            KeyFrames[Key] = (uint16)Frames[Key];
+        }
+        return Offset;
+    }
+
+    /** Interpolation weight of Frame between two key frames, computed as FindKeys does */
+    inline float GetAlpha(int32 Frame, int32 Start, int32 End)
+    {
+        return (float)(Frame - Start) / (float)(End - Start);
+    }
+
+    /** Chord between two unit quaternions on the same hemisphere; 2 * sin(angle / 4), exact near zero unlike a dot product */
+    inline float GetRotationDistance(const FQuat4f& A, const FQuat4f& B)
+    {
+        const float Sign = (A | B) < 0.0f ? -1.0f : 1.0f;
+        return FMath::Sqrt(FMath::Square(A.X - B.X * Sign) + FMath::Square(A.Y - B.Y * Sign) +
+                           FMath::Square(A.Z - B.Z * Sign) + FMath::Square(A.W - B.W * Sign));
+    }
+
+    inline float DistanceToAngle(float Distance)
+    {
+        return 4.0f * FMath::Asin(FMath::Min(Distance * 0.5f, 1.0f));
+    }
+
+    /** Every frame of every channel, static channels expanded, channel-major */
+    void ExpandChannels(const FOnimTrackSource& Track, int32 NumFrames, TArray<float>& OutValues)
+    {
+        const int32 NumChannels = Track.GetNumChannels();
+        OutValues.SetNumUninitialized(NumChannels * NumFrames);
+        for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+        {
+            const int32 Offset = Track.GetChannelOffset(Channel, NumFrames);
+            const int32 Stride = Track.IsChannelStatic(Channel) ? 0 : 1;
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                OutValues[Channel * NumFrames + Frame] = Track.Floats[Offset + Frame * Stride];
+            }
+        }
+    }
+}
+
+FOnimTrackCompressionResult FOnimCompression::CompressTrack(const FOnimTrackSource& Track, int32 NumFrames, const FOnimCompressionSettings& Settings,
+                                                            FOnimTrackRecord& OutRecord, TArray<FOnimChannelRecord>& OutChannels, TArray<uint8>& OutKeys)
+{
+    check(NumFrames > 0 && NumFrames <= MAX_uint16);
+    OutRecord.NumChannels = (uint8)Track.GetNumChannels();
+
+    if (!Onim::IsFloatType(Track.Type))
+    {
+        return CompressUIntTrack(Track, NumFrames, OutRecord, OutChannels, OutKeys);
+    }
+    if (IsRotationTrack(Track))
+    {
+        return CompressRotationTrack(Track, NumFrames, Settings, OutRecord, OutKeys);
+    }
+    return CompressFloatTrack(Track, NumFrames, Settings, OutRecord, OutChannels, OutKeys);
+}
+
+FOnimTrackCompressionResult FOnimCompression::CompressRotationTrack(const FOnimTrackSource& Track, int32 NumFrames, const FOnimCompressionSettings& Settings,
+                                                                    FOnimTrackRecord& OutRecord, TArray<uint8>& OutKeys)
+{
+    using namespace OnimCompressionPrivate;
+
+    TArray<float> Values;
+    ExpandChannels(Track, NumFrames, Values);
+
+    TArray<FQuat4f> Source;
+    Source.SetNumUninitialized(NumFrames);
+    FQuat4f Mean(0.0f, 0.0f, 0.0f, 0.0f);
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Source[Frame] = FQuat4f(Values[Frame], Values[NumFrames + Frame], Values[2 * NumFrames + Frame], Values[3 * NumFrames + Frame]).GetNormalized();
+        Mean += Source[Frame] * ((Source[0] | Source[Frame]) < 0.0f ? -1.0f : 1.0f);
+    }
+
+    const float MaxDistance = 2.0f * FMath::Sin(Settings.RotationTolerance * 0.25f);
+
+    // Constant elimination: one key, the quantised mean, if it is close enough to every frame
+    uint16 MeanKey[3];
+    PackRotation(Mean.GetNormalized(), MeanKey);
+    const FQuat4f DecodedMean = UnpackRotation(MeanKey);
+    bool bConstant = true;
+    for (int32 Frame = 0; Frame < NumFrames && bConstant; ++Frame)
+    {
+        bConstant = GetRotationDistance(DecodedMean, Source[Frame]) <= MaxDistance;
+    }
+
+    TArray<uint16> Packed;
+    TArray<int32> KeptFrames;
+    if (bConstant)
+    {
+        Packed.Append(MeanKey, 3);
+        KeptFrames.Add(0);
+    }
+    else
+    {
+        TArray<FQuat4f> Decoded;
+        Decoded.SetNumUninitialized(NumFrames);
+        Packed.SetNumUninitialized(NumFrames * 3);
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            PackRotation(Source[Frame], &Packed[Frame * 3]);
+            Decoded[Frame] = UnpackRotation(&Packed[Frame * 3]);
+        }
+
+        ReduceKeys(NumFrames, [&](int32 Start, int32 End)
+        {
+            for (int32 Frame = Start + 1; Frame < End; ++Frame)
+            {
+                const FQuat4f Rotation = FQuat4f::FastLerp(Decoded[Start], Decoded[End], GetAlpha(Frame, Start, End)).GetNormalized();
+                if (GetRotationDistance(Rotation, Source[Frame]) > MaxDistance)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }, KeptFrames);
+    }
+
+    OutRecord.Encoding = (uint8)ETrackEncoding::SmallestThree48;
+    OutRecord.NumKeys = (uint16)KeptFrames.Num();
+    OutRecord.KeyFramesOffset = bConstant ? EveryFrame : WriteKeyFrames(KeptFrames, NumFrames, OutKeys);
+    OutRecord.RotationKeyOffset = AllocateKeys(OutKeys, KeptFrames.Num() * RotationKeySize);
+
+    uint16* RotationKeys = (uint16*)(OutKeys.GetData() + OutRecord.RotationKeyOffset);
+    for (int32 Key = 0; Key < KeptFrames.Num(); ++Key)
+    {
+        const int32 SourceKey = bConstant ? 0 : KeptFrames[Key];
+        FMemory::Memcpy(RotationKeys + Key * 3, &Packed[SourceKey * 3], RotationKeySize);
+    }
+
+    // Measure through the runtime sampler so the report is what playback sees
+    FOnimTrackCompressionResult Result;
+    Result.NumKeys = KeptFrames.Num();
+    Result.bRotation = true;
+    float MaxFrameDistance = 0.0f;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        MaxFrameDistance = FMath::Max(MaxFrameDistance, GetRotationDistance(SampleRotation(OutRecord, OutKeys.GetData(), (float)Frame), Source[Frame]));
+    }
+    Result.MaxError = DistanceToAngle(MaxFrameDistance);
+    return Result;
+}
+
+FOnimTrackCompressionResult FOnimCompression::CompressFloatTrack(const FOnimTrackSource& Track, int32 NumFrames, const FOnimCompressionSettings& Settings,
+                                                                 FOnimTrackRecord& OutRecord, TArray<FOnimChannelRecord>& OutChannels, TArray<uint8>& OutKeys)
+{
+    using namespace OnimCompressionPrivate;
+
+    const int32 NumChannels = Track.GetNumChannels();
+    const float Tolerance = Settings.TranslationTolerance;
+
+    TArray<float> Source;
+    ExpandChannels(Track, NumFrames, Source);
+
+    // Range-quantise every frame first; reduction then works on exactly the values that will be stored
+    TArray<float> Quantized;
+    Quantized.SetNumUninitialized(Source.Num());
+    TArray<uint16> QuantizedKeys;
+    QuantizedKeys.SetNumZeroed(Source.Num());
+
+    OutRecord.Encoding = (uint8)ETrackEncoding::Channels;
+    OutRecord.FirstChannel = (uint32)OutChannels.Num();
+    bool bConstant = true;
+
+    for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+    {
+        const TArrayView<const float> Values = MakeArrayView(Source).Slice(Channel * NumFrames, NumFrames);
+        float Min = Values[0];
+        float Max = Values[0];
+        for (float Value : Values)
+        {
+            Min = FMath::Min(Min, Value);
+            Max = FMath::Max(Max, Value);
+        }
+
+        FOnimChannelRecord& Record = OutChannels.AddZeroed_GetRef();
+        if (Max - Min <= 2.0f * Tolerance)
+        {
+            // Constant elimination: the midpoint is within tolerance of every frame
+            Record.Encoding = (uint8)EChannelEncoding::Constant;
+            Record.KeyStride = 0;
+            Record.Min = (Min + Max) * 0.5f;
+            Record.Scale = 0.0f;
+        }
+        else
+        {
+            Record.Encoding = (uint8)EChannelEncoding::Quantized16;
+            Record.KeyStride = 1;
+            Record.Min = Min;
+            Record.Scale = (Max - Min) / QuantizedMax;
+            bConstant = false;
+        }
+
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            const int32 Index = Channel * NumFrames + Frame;
+            const int32 Key = Record.KeyStride ? FMath::Clamp(FMath::RoundToInt32((Values[Frame] - Min) / Record.Scale), 0, QuantizedMax) : 0;
+            QuantizedKeys[Index] = (uint16)Key;
+            Quantized[Index] = Record.Min + Key * Record.Scale;
+        }
+    }
+
+    TArray<int32> KeptFrames;
+    if (bConstant)
+    {
+        KeptFrames.Add(0);
+    }
+    else
+    {
+        ReduceKeys(NumFrames, [&](int32 Start, int32 End)
+        {
+            for (int32 Frame = Start + 1; Frame < End; ++Frame)
+            {
+                const float Alpha = GetAlpha(Frame, Start, End);
+                for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+                {
+                    const float* Channel0 = &Quantized[Channel * NumFrames];
+                    const float Value = Channel0[Start] + (Channel0[End] - Channel0[Start]) * Alpha;
+                    if (FMath::Abs(Value - Source[Channel * NumFrames + Frame]) > Tolerance)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }, KeptFrames);
+    }
+
+    OutRecord.NumKeys = (uint16)KeptFrames.Num();
+    OutRecord.KeyFramesOffset = bConstant ? EveryFrame : WriteKeyFrames(KeptFrames, NumFrames, OutKeys);
+
+    for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+    {
+        FOnimChannelRecord& Record = OutChannels[OutRecord.FirstChannel + Channel];
+        if (Record.KeyStride == 0)
+        {
+            continue;
+        }
+
+        Record.KeyOffset = AllocateKeys(OutKeys, KeptFrames.Num() * (int32)sizeof(uint16));
+        uint16* ChannelKeys = (uint16*)(OutKeys.GetData() + Record.KeyOffset);
+        for (int32 Key = 0; Key < KeptFrames.Num(); ++Key)
+        {
+            ChannelKeys[Key] = QuantizedKeys[Channel * NumFrames + KeptFrames[Key]];
+        }
+    }
+
+    FOnimTrackCompressionResult Result;
+    Result.NumKeys = KeptFrames.Num();
+    float Sampled[4];
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        SampleChannels(OutRecord, OutChannels.GetData() + OutRecord.FirstChannel, OutKeys.GetData(), (float)Frame, Sampled);
+        for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+        {
+            Result.MaxError = FMath::Max(Result.MaxError, FMath::Abs(Sampled[Channel] - Source[Channel * NumFrames + Frame]));
+        }
+    }
+    return Result;
+}
+
+FOnimTrackCompressionResult FOnimCompression::CompressUIntTrack(const FOnimTrackSource& Track, int32 NumFrames,
+                                                                FOnimTrackRecord& OutRecord, TArray<FOnimChannelRecord>& OutChannels, TArray<uint8>& OutKeys)
+{
+    using namespace OnimCompressionPrivate;
+
+    // Flags and event ids are not interpolated, so UInt tracks are either constant or keep every frame
+    const TArrayView<const uint32> Values = MakeArrayView(Track.UInts).Slice(0, Track.GetChannelNum(0, NumFrames));
+    bool bConstant = true;
+    for (uint32 Value : Values)
+    {
+        bConstant &= Value == Values[0];
+    }
+
+    OutRecord.Encoding = (uint8)ETrackEncoding::Channels;
+    OutRecord.FirstChannel = (uint32)OutChannels.Num();
+    OutRecord.KeyFramesOffset = EveryFrame;
+    OutRecord.NumKeys = (uint16)(bConstant ? 1 : NumFrames);
+
+    FOnimChannelRecord& Record = OutChannels.AddZeroed_GetRef();
+    if (bConstant)
+    {
+        Record.Encoding = (uint8)EChannelEncoding::Constant;
+        Record.KeyStride = 0;
+        Record.UIntValue = Values[0];
+    }
+    else
+    {
+        Record.Encoding = (uint8)EChannelEncoding::Raw32;
+        Record.KeyStride = 1;
+        Record.UIntValue = 0;
+        Record.KeyOffset = AllocateKeys(OutKeys, NumFrames * (int32)sizeof(uint32));
+        FMemory::Memcpy(OutKeys.GetData() + Record.KeyOffset, Values.GetData(), NumFrames * sizeof(uint32));
+    }
+
+    FOnimTrackCompressionResult Result;
+    Result.NumKeys = OutRecord.NumKeys;
+    return Result;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnimTypes.h"
+
+struct FOnimTrackRecord;
+struct FOnimChannelRecord;
+
+/** Error bounds for compressing one track; every track of a compile uses the same bounds */
+struct FOnimCompressionSettings
+{
+    /** Largest angle, in radians, a compressed rotation may be off its source */
+    float RotationTolerance = 0.001f;
+
+    /** Largest per-component error on position and other float tracks, in source units */
+    float TranslationTolerance = 0.0002f;
+};
+
+/** What compressing one track did */
+struct FOnimTrackCompressionResult
+{
+    int32 NumKeys = 0;
+
+    /** Largest error over every source frame, decoded the way the runtime samples it */
+    float MaxError = 0.0f;
+
+    /** MaxError is an angle in radians rather than a component difference */
+    bool bRotation = false;
+};
+
+/**
+ * Onim Compression
+ * The offline stage between parsing and writing a compiled dictionary. Per track:
+ *
+ *   - constant elimination: a track that stays within tolerance of one value keeps one key
+ *   - quantisation: rotations as 48-bit smallest-three quaternions, other floats as 16 bits over the
+ *     channel's range
+ *   - linear key reduction: keys that interpolation from their neighbours reproduces within
+ *     tolerance are dropped, greedily from the first frame
+ *
+ * Reduction is tested against the quantised keys, so the reported error is what the runtime sees.
+ */
+class GAME_API FOnimCompression
+{
+public:
+    static bool IsRotationTrack(const FOnimTrackSource& Track)
+    {
+        return Track.Type == EOnimValueType::Float4 &&
+            (Track.Kind == EOnimTrackKind::BoneRotation || Track.Kind == EOnimTrackKind::ModelRotation);
+    }
+
+    /**
+     * Encode one track, appending its channel records and keys to the dictionary-wide arrays and
+     * filling in the record's NumChannels, Encoding, NumKeys and key offsets. OutKeys must already
+     * hold the shared zero key.
+     */
+    static FOnimTrackCompressionResult CompressTrack(const FOnimTrackSource& Track, int32 NumFrames, const FOnimCompressionSettings& Settings,
+                                                     FOnimTrackRecord& OutRecord, TArray<FOnimChannelRecord>& OutChannels, TArray<uint8>& OutKeys);
+
+private:
+    static FOnimTrackCompressionResult CompressRotationTrack(const FOnimTrackSource& Track, int32 NumFrames, const FOnimCompressionSettings& Settings,
+                                                             FOnimTrackRecord& OutRecord, TArray<uint8>& OutKeys);
+
+    static FOnimTrackCompressionResult CompressFloatTrack(const FOnimTrackSource& Track, int32 NumFrames, const FOnimCompressionSettings& Settings,
+                                                          FOnimTrackRecord& OutRecord, TArray<FOnimChannelRecord>& OutChannels, TArray<uint8>& OutKeys);
+
+    static FOnimTrackCompressionResult CompressUIntTrack(const FOnimTrackSource& Track, int32 NumFrames,
+                                                         FOnimTrackRecord& OutRecord, TArray<FOnimChannelRecord>& OutChannels, TArray<uint8>& OutKeys);
+};
@@ -0,0 +1,730 @@
+#include "OnimParser.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Paths.h"
+
+namespace OnimParserPrivate
+{
+    inline bool IsSpace(ANSICHAR Char)
+    {
+        return Char == ' ' || Char == '\t' || Char == '\r' || Char == '\n';
+    }
+
+    inline bool IsDigit(ANSICHAR Char)
+    {
+        return (uint8)(Char - '0') < 10;
+    }
+
+    // === Number Scanning ===
+    // fast_float-style: digits are accumulated into a 64-bit mantissa, eight at a time with SWAR where
+    // the text allows, and converted with one exact multiply/divide by a power of ten when the
+    // mantissa and exponent are small enough for that to be correctly rounded (Clinger's fast path).
+    // Everything else falls back to the C library on a stack copy of the token.
+
+    static const double ExactPowersOfTen[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    static constexpr int32 MaxExactPower = UE_ARRAY_COUNT(ExactPowersOfTen) - 1;
+    static constexpr uint64 MaxExactMantissa = 1ull << 53;
+    static constexpr int32 MaxMantissaDigits = 19;
+
+    inline uint64 LoadEightChars(const ANSICHAR* Ptr)
+    {
+        uint64 Value;
+        FMemory::Memcpy(&Value, Ptr, sizeof(Value));
+#if !PLATFORM_LITTLE_ENDIAN
+        Value = ByteSwap(Value);
+#endif
+        return Value;
+    }
+
+    /** True if all eight bytes are ASCII digits */
+    inline bool IsEightDigits(uint64 Chars)
+    {
+        return (((Chars & 0xF0F0F0F0F0F0F0F0ull) | (((Chars + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull);
+    }
+
+    /** Eight ASCII digits (first digit in the low byte) to their value, in three multiplies */
+    inline uint32 ParseEightDigits(uint64 Chars)
+    {
+        const uint64 Mask = 0x000000FF000000FFull;
+        const uint64 Mul1 = 0x000F424000000064ull; // 100 + (1000000 << 32)
+        const uint64 Mul2 = 0x0000271000000001ull; // 1 + (10000 << 32)
+        Chars -= 0x3030303030303030ull;
+        Chars = (Chars * 10) + (Chars >> 8);
+        return (uint32)((((Chars & Mask) * Mul1) + (((Chars >> 16) & Mask) * Mul2)) >> 32);
+    }
+
+    /** Scan a float at Ptr, advancing past it; fails unless the token ends at whitespace or End */
+    bool ScanFloat(const ANSICHAR*& Ptr, const ANSICHAR* End, float& OutValue)
+    {
+        const ANSICHAR* Start = Ptr;
+        const bool bNegative = Ptr < End && *Ptr == '-';
+        if (Ptr < End && (*Ptr == '-' || *Ptr == '+'))
+        {
+            ++Ptr;
+        }
+
+        uint64 Mantissa = 0;
+        int32 NumDigits = 0;
+        int32 Exponent = 0;
+        bool bTruncated = false;
+        bool bAnyDigits = false;
+
+        auto AddDigit = [&](ANSICHAR Digit, bool bFraction)
+        {
+            bAnyDigits = true;
+            if (Mantissa == 0 && Digit == '0')
+            {
+                Exponent -= bFraction ? 1 : 0;
+            }
+            else if (NumDigits < MaxMantissaDigits)
+            {
+                Mantissa = Mantissa * 10 + (Digit - '0');
+                Exponent -= bFraction ? 1 : 0;
+                ++NumDigits;
+            }
+            else
+            {
+                bTruncated = true;
+                Exponent += bFraction ? 0 : 1;
+            }
+        };
+
+        while (Ptr < End && IsDigit(*Ptr))
+        {
+            AddDigit(*Ptr++, false);
+        }
+
+        if (Ptr < End && *Ptr == '.')
+        {
+            ++Ptr;
+
+            // The bulk of onim values are 8-decimal fractions: take them eight digits per step
+            while (End - Ptr >= 8 && NumDigits + 8 <= MaxMantissaDigits)
+            {
+                const uint64 Chars = LoadEightChars(Ptr);
+                if (!IsEightDigits(Chars))
+                {
+                    break;
+                }
+                const uint32 Digits = ParseEightDigits(Chars);
+                Mantissa = Mantissa * 100000000ull + Digits;
+                NumDigits = Mantissa != 0 ? NumDigits + 8 : 0;
+                Exponent -= 8;
+                bAnyDigits = true;
+                Ptr += 8;
+            }
+
+            while (Ptr < End && IsDigit(*Ptr))
+            {
+                AddDigit(*Ptr++, true);
+            }
+        }
+
+        if (!bAnyDigits)
+        {
+            return false;
+        }
+
+        if (Ptr < End && (*Ptr == 'e' || *Ptr == 'E'))
+        {
+            ++Ptr;
+            const bool bNegativeExponent = Ptr < End && *Ptr == '-';
+            if (Ptr < End && (*Ptr == '-' || *Ptr == '+'))
+            {
+                ++Ptr;
+            }
+            if (Ptr >= End || !IsDigit(*Ptr))
+            {
+                return false;
+            }
+            int32 ExplicitExponent = 0;
+            while (Ptr < End && IsDigit(*Ptr))
+            {
+                ExplicitExponent = FMath::Min(ExplicitExponent * 10 + (*Ptr++ - '0'), 100000);
+            }
+            Exponent += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+        }
+
+        if (Ptr < End && !IsSpace(*Ptr))
+        {
+            return false;
+        }
+
+        if (!bTruncated && Mantissa <= MaxExactMantissa && Exponent >= -MaxExactPower && Exponent <= MaxExactPower)
+        {
+            double Value = (double)Mantissa;
+            Value = Exponent < 0 ? Value / ExactPowersOfTen[-Exponent] : Value * ExactPowersOfTen[Exponent];
+            OutValue = (float)(bNegative ? -Value : Value);
+            return true;
+        }
+
+        // Slow path: long or extreme literals
+        ANSICHAR Buffer[64];
+        const int32 Length = (int32)FMath::Min<int64>(Ptr - Start, UE_ARRAY_COUNT(Buffer) - 1);
+        FMemory::Memcpy(Buffer, Start, Length);
+        Buffer[Length] = 0;
+        OutValue = (float)FCStringAnsi::Atod(Buffer);
+        return true;
+    }
+
+    bool ParseFloat(FAnsiStringView Token, float& OutValue)
+    {
+        const ANSICHAR* Ptr = Token.GetData();
+        return !Token.IsEmpty() && ScanFloat(Ptr, Token.GetData() + Token.Len(), OutValue) && Ptr == Token.GetData() + Token.Len();
+    }
+
+    bool ParseInt(FAnsiStringView Token, int32& OutValue)
+    {
+        int32 Index = Token.StartsWith('-') ? 1 : 0;
+        if (Index >= Token.Len())
+        {
+            return false;
+        }
+
+        int64 Value = 0;
+        for (; Index < Token.Len(); ++Index)
+        {
+            if (!IsDigit(Token[Index]) || Value > MAX_int32)
+            {
+                return false;
+            }
+            Value = Value * 10 + (Token[Index] - '0');
+        }
+        OutValue = (int32)(Token.StartsWith('-') ? -Value : Value);
+        return true;
+    }
+
+    /** Hex, decimal or a name; names are hashed and, if OutNames is given, remembered there */
+    bool ParseUInt(FAnsiStringView Token, uint32& OutValue, TMap<uint32, FString>* OutNames = nullptr)
+    {
+        if (Token.IsEmpty())
+        {
+            return false;
+        }
+
+        uint64 Value = 0;
+        if (Token.Len() > 2 && Token[0] == '0' && (Token[1] == 'x' || Token[1] == 'X'))
+        {
+            for (int32 Index = 2; Index < Token.Len(); ++Index)
+            {
+                const ANSICHAR Char = Token[Index];
+                const int32 Nibble = IsDigit(Char) ? Char - '0' : (Char | 0x20) >= 'a' && (Char | 0x20) <= 'f' ? (Char | 0x20) - 'a' + 10 : -1;
+                if (Nibble < 0 || Index > 9)
+                {
+                    return false;
+                }
+                Value = (Value << 4) | (uint64)Nibble;
+            }
+        }
+        else if (IsDigit(Token[0]))
+        {
+            for (ANSICHAR Char : Token)
+            {
+                if (!IsDigit(Char) || Value > MAX_uint32)
+                {
+                    return false;
+                }
+                Value = Value * 10 + (Char - '0');
+            }
+        }
+        else
+        {
+            OutValue = Onim::HashName(Token);
+            if (OutNames && !OutNames->Contains(OutValue))
+            {
+                OutNames->Add(OutValue, FString(Token));
+            }
+            return true;
+        }
+
+        OutValue = (uint32)Value;
+        return Value <= MAX_uint32;
+    }
+
+    // === Structure ===
+
+    /** Split the next whitespace-separated token off the front of Line */
+    bool NextToken(FAnsiStringView& Line, FAnsiStringView& OutToken)
+    {
+        int32 Start = 0;
+        while (Start < Line.Len() && IsSpace(Line[Start]))
+        {
+            ++Start;
+        }
+        int32 End = Start;
+        while (End < Line.Len() && !IsSpace(Line[End]))
+        {
+            ++End;
+        }
+
+        OutToken = Line.Mid(Start, End - Start);
+        Line.RightChopInline(End);
+        return !OutToken.IsEmpty();
+    }
+
+    /**
+     * Cursor over the mapped text. Structure is read a line at a time; value blocks are scanned
+     * straight off the buffer. LineNumber is the line the cursor is on.
+     */
+    struct FCursor
+    {
+        const ANSICHAR* Ptr;
+        const ANSICHAR* End;
+        int32 LineNumber;
+
+        FCursor(const ANSICHAR* Data, int64 Size)
+            : Ptr(Data), End(Data + Size), LineNumber(1)
+        {
+        }
+
+        void SkipSpace()
+        {
+            while (Ptr < End && IsSpace(*Ptr))
+            {
+                LineNumber += *Ptr == '\n' ? 1 : 0;
+                ++Ptr;
+            }
+        }
+
+        /** Next non-blank line, trimmed; the cursor is left at its line break */
+        bool NextLine(FAnsiStringView& OutLine)
+        {
+            SkipSpace();
+            if (Ptr >= End)
+            {
+                return false;
+            }
+
+            const ANSICHAR* LineStart = Ptr;
+            while (Ptr < End && *Ptr != '\n')
+            {
+                ++Ptr;
+            }
+            const ANSICHAR* LineEnd = Ptr;
+            while (IsSpace(LineEnd[-1]))
+            {
+                --LineEnd;
+            }
+
+            OutLine = FAnsiStringView(LineStart, (int32)(LineEnd - LineStart));
+            return true;
+        }
+    };
+
+    struct FParseContext
+    {
+        FCursor Cursor;
+        FOnimClipSource& Clip;
+        FString& Error;
+
+        FParseContext(const ANSICHAR* Data, int64 Size, FOnimClipSource& InClip, FString& InError)
+            : Cursor(Data, Size), Clip(InClip), Error(InError)
+        {
+        }
+
+        bool Fail(const TCHAR* Message)
+        {
+            Error = FString::Printf(TEXT("line %d: %s"), Cursor.LineNumber, Message);
+            return false;
+        }
+
+        bool Expect(const ANSICHAR* Expected)
+        {
+            FAnsiStringView Line;
+            if (!Cursor.NextLine(Line) || !Line.Equals(Expected))
+            {
+                return Fail(*FString::Printf(TEXT("expected '%hs'"), Expected));
+            }
+            return true;
+        }
+
+        /** Consume lines up to and including the '}' matching an already-read '{' */
+        bool SkipBlock()
+        {
+            int32 Depth = 1;
+            FAnsiStringView Line;
+            while (Depth > 0 && Cursor.NextLine(Line))
+            {
+                Depth += Line.Equals("{") ? 1 : Line.Equals("}") ? -1 : 0;
+            }
+            return Depth == 0 || Fail(TEXT("unterminated block"));
+        }
+    };
+
+    /** FLAG_n tokens to a bitmask */
+    bool ParseFlags(FAnsiStringView Line, uint32& OutFlags)
+    {
+        OutFlags = 0;
+        FAnsiStringView Token;
+        while (NextToken(Line, Token))
+        {
+            int32 Bit = 0;
+            if (!Token.StartsWith("FLAG_") || !ParseInt(Token.RightChop(5), Bit) || Bit < 0 || Bit >= 32)
+            {
+                return false;
+            }
+            OutFlags |= 1u << Bit;
+        }
+        return true;
+    }
+
+    /** Scan values up to the closing '}', appending them to the track; no per-token allocation */
+    bool ReadValues(FParseContext& Context, FOnimTrackSource& Track, int32& OutCount)
+    {
+        FCursor& Cursor = Context.Cursor;
+        const bool bFloat = Onim::IsFloatType(Track.Type);
+        OutCount = 0;
+
+        for (;;)
+        {
+            Cursor.SkipSpace();
+            if (Cursor.Ptr >= Cursor.End)
+            {
+                return Context.Fail(TEXT("unterminated value block"));
+            }
+            if (*Cursor.Ptr == '}')
+            {
+                ++Cursor.Ptr;
+                return true;
+            }
+
+            bool bParsed;
+            const ANSICHAR* TokenStart = Cursor.Ptr;
+            if (bFloat)
+            {
+                bParsed = ScanFloat(Cursor.Ptr, Cursor.End, Track.Floats.AddUninitialized_GetRef());
+            }
+            else
+            {
+                while (Cursor.Ptr < Cursor.End && !IsSpace(*Cursor.Ptr))
+                {
+                    ++Cursor.Ptr;
+                }
+                const FAnsiStringView Token(TokenStart, (int32)(Cursor.Ptr - TokenStart));
+                bParsed = ParseUInt(Token, Track.UInts.AddUninitialized_GetRef(), &Context.Clip.ValueNames);
+            }
+
+            if (!bParsed)
+            {
+                int32 TokenLength = 0;
+                while (TokenStart + TokenLength < Cursor.End && !IsSpace(TokenStart[TokenLength]))
+                {
+                    ++TokenLength;
+                }
+                return Context.Fail(*FString::Printf(TEXT("bad value '%s'"), *FString(FAnsiStringView(TokenStart, TokenLength))));
+            }
+            ++OutCount;
+        }
+    }
+
+    /** Interleaved per-frame values (SingleChannel, not static) to channel-major */
+    void Deinterleave(FOnimTrackSource& Track, int32 NumFrames)
+    {
+        const int32 NumChannels = Track.GetNumChannels();
+        if (NumChannels == 1)
+        {
+            return;
+        }
+
+        TArray<float> Interleaved = MoveTemp(Track.Floats);
+        Track.Floats.SetNumUninitialized(Interleaved.Num());
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+            {
+                Track.Floats[Channel * NumFrames + Frame] = Interleaved[Frame * NumChannels + Channel];
+            }
+        }
+    }
+
+    bool ParseFramesData(FParseContext& Context, FOnimTrackSource& Track, int32 NumFrames)
+    {
+        FAnsiStringView Line;
+        FAnsiStringView Token;
+        if (!Context.Cursor.NextLine(Line) || !NextToken(Line, Token) || !Token.Equals("FramesData") || !NextToken(Line, Token))
+        {
+            return Context.Fail(TEXT("expected 'FramesData'"));
+        }
+
+        const int32 NumChannels = Track.GetNumChannels();
+        const bool bMultiChannel = Token.Equals("MultiChannel");
+        if (!bMultiChannel && !Token.Equals("SingleChannel"))
+        {
+            return Context.Fail(TEXT("unknown FramesData layout"));
+        }
+        const bool bStatic = NextToken(Line, Token) && Token.Equals("Static");
+
+        if (!Context.Expect("{"))
+        {
+            return false;
+        }
+
+        int32 Count = 0;
+        if (bMultiChannel)
+        {
+            for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+            {
+                FAnsiStringView ChannelLine;
+                FAnsiStringView ChannelToken;
+                if (!Context.Cursor.NextLine(ChannelLine) || !NextToken(ChannelLine, ChannelToken) || !ChannelToken.Equals("channel"))
+                {
+                    return Context.Fail(TEXT("expected 'channel'"));
+                }
+                const bool bChannelStatic = NextToken(ChannelLine, ChannelToken) && ChannelToken.Equals("Static");
+
+                if (!Context.Expect("{") || !ReadValues(Context, Track, Count))
+                {
+                    return false;
+                }
+                if (Count != (bChannelStatic ? 1 : NumFrames))
+                {
+                    return Context.Fail(*FString::Printf(TEXT("channel has %d values, expected %d"), Count, bChannelStatic ? 1 : NumFrames));
+                }
+                Track.StaticMask |= bChannelStatic ? (uint8)(1 << Channel) : 0;
+            }
+            return Context.Expect("}");
+        }
+
+        if (!ReadValues(Context, Track, Count))
+        {
+            return false;
+        }
+
+        const int32 Expected = NumChannels * (bStatic ? 1 : NumFrames);
+        if (Count != Expected)
+        {
+            return Context.Fail(*FString::Printf(TEXT("track has %d values, expected %d"), Count, Expected));
+        }
+
+        if (bStatic)
+        {
+            Track.StaticMask = (uint8)((1 << NumChannels) - 1);
+        }
+        else if (Onim::IsFloatType(Track.Type))
+        {
+            Deinterleave(Track, NumFrames);
+        }
+        return true;
+    }
+
+    bool ParseHeaderField(FParseContext& Context, FAnsiStringView Line, FOnimClipSource& Clip)
+    {
+        FAnsiStringView Key;
+        FAnsiStringView Value;
+        NextToken(Line, Key);
+        const FAnsiStringView Rest = Line;
+        NextToken(Line, Value);
+
+        bool bParsed = true;
+        if (Key.Equals("Flags"))
+        {
+            bParsed = ParseFlags(Rest, Clip.Flags);
+        }
+        else if (Key.Equals("ExtraFlags"))
+        {
+            bParsed = ParseFlags(Rest, Clip.ExtraFlags);
+        }
+        else if (Key.Equals("Frames"))
+        {
+            bParsed = ParseInt(Value, Clip.NumFrames) && Clip.NumFrames > 0;
+        }
+        else if (Key.Equals("Sequences"))
+        {
+            bParsed = ParseInt(Value, Clip.NumSequences);
+        }
+        else if (Key.Equals("SequenceFrameLimit"))
+        {
+            bParsed = ParseInt(Value, Clip.SequenceFrameLimit);
+        }
+        else if (Key.Equals("Duration"))
+        {
+            bParsed = ParseFloat(Value, Clip.Duration);
+        }
+        else if (Key.Equals("MaterialID"))
+        {
+            bParsed = ParseInt(Value, Clip.MaterialID);
+        }
+        else if (Key.Equals("_f10"))
+        {
+            bParsed = ParseUInt(Value, Clip.Field10);
+        }
+        // Unknown header fields are ignored; they carry nothing the runtime reads
+
+        return bParsed || Context.Fail(*FString::Printf(TEXT("bad header field '%s'"), *FString(Key)));
+    }
+}
+
+// === FOnimParser ===
+
+bool FOnimParser::Parse(const ANSICHAR* Data, int64 Size, FOnimClipSource& OutClip, FString& OutError)
+{
+    using namespace OnimParserPrivate;
+
+    // Keep the clip's track and value allocations so a reused clip parses without allocating
+    TArray<FOnimTrackSource> Tracks = MoveTemp(OutClip.Tracks);
+    const FString Name = MoveTemp(OutClip.Name);
+    OutClip.Reset();
+    OutClip.Name = Name;
+    OutClip.Tracks = MoveTemp(Tracks);
+    int32 NumTracks = 0;
+
+    FParseContext Context(Data, Size, OutClip, OutError);
+    FAnsiStringView Line;
+    FAnsiStringView Token;
+
+    // Version <major> <minor>
+    int32 Major = 0;
+    int32 Minor = 0;
+    if (!Context.Cursor.NextLine(Line) || !NextToken(Line, Token) || !Token.Equals("Version") ||
+        !NextToken(Line, Token) || !ParseInt(Token, Major) || !NextToken(Line, Token) || !ParseInt(Token, Minor))
+    {
+        return Context.Fail(TEXT("expected 'Version <major> <minor>'"));
+    }
+    OutClip.VersionMajor = (uint16)Major;
+    OutClip.VersionMinor = (uint16)Minor;
+
+    if (!Context.Expect("{"))
+    {
+        return false;
+    }
+
+    // Header fields up to the Animation block
+    for (;;)
+    {
+        if (!Context.Cursor.NextLine(Line))
+        {
+            return Context.Fail(TEXT("missing Animation block"));
+        }
+        if (Line.Equals("Animation"))
+        {
+            break;
+        }
+        if (!ParseHeaderField(Context, Line, OutClip))
+        {
+            return false;
+        }
+    }
+
+    if (OutClip.NumFrames <= 0)
+    {
+        return Context.Fail(TEXT("missing Frames"));
+    }
+    if (!Context.Expect("{"))
+    {
+        return false;
+    }
+
+    // Tracks up to the Animation block's closing brace
+    bool bParsed = true;
+    for (;;)
+    {
+        if (!Context.Cursor.NextLine(Line))
+        {
+            bParsed = Context.Fail(TEXT("unterminated Animation block"));
+            break;
+        }
+        if (Line.Equals("}"))
+        {
+            break;
+        }
+
+        FAnsiStringView KindToken;
+        FAnsiStringView TypeToken;
+        FAnsiStringView IdToken;
+        NextToken(Line, KindToken);
+        NextToken(Line, TypeToken);
+        NextToken(Line, IdToken);
+
+        EOnimValueType Type;
+        uint32 Id = 0;
+        if (!Onim::ParseValueType(TypeToken, Type) || !ParseUInt(IdToken, Id))
+        {
+            bParsed = Context.Fail(*FString::Printf(TEXT("bad track header '%s'"), *FString(KindToken)));
+            break;
+        }
+
+        if (!Context.Expect("{"))
+        {
+            bParsed = false;
+            break;
+        }
+
+        EOnimTrackKind Kind;
+        if (!Onim::ParseTrackKind(KindToken, Kind))
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("OnimParser: Skipping unknown track '%s' in '%s'"), *FString(KindToken), *OutClip.Name);
+            if (!Context.SkipBlock())
+            {
+                bParsed = false;
+                break;
+            }
+            continue;
+        }
+
+        // Reuse a previous parse's track, values and all, when there is one
+        FOnimTrackSource& Track = NumTracks < OutClip.Tracks.Num() ? OutClip.Tracks[NumTracks] : OutClip.Tracks.AddDefaulted_GetRef();
+        ++NumTracks;
+        Track.Kind = Kind;
+        Track.Type = Type;
+        Track.Id = Id;
+        Track.StaticMask = 0;
+        Track.Floats.Reset();
+        Track.UInts.Reset();
+        if (Onim::IsFloatType(Type))
+        {
+            Track.Floats.Reserve(Onim::GetNumChannels(Type) * OutClip.NumFrames);
+        }
+        else
+        {
+            Track.UInts.Reserve(OutClip.NumFrames);
+        }
+
+        if (!ParseFramesData(Context, Track, OutClip.NumFrames) || !Context.Expect("}"))
+        {
+            bParsed = false;
+            break;
+        }
+    }
+
+    OutClip.Tracks.SetNum(NumTracks, EAllowShrinking::No);
+    return bParsed && Context.Expect("}");
+}
+
+bool FOnimParser::ParseFile(const FString& FilePath, FOnimClipSource& OutClip, FString& OutError)
+{
+    FOnimSourceFile File;
+    if (!File.Open(FilePath))
+    {
+        OutError = TEXT("could not read file");
+        return false;
+    }
+
+    OutClip.Name = FPaths::GetBaseFilename(FilePath);
+    return Parse(File.GetData(), File.GetSize(), OutClip, OutError);
+}
+
+int32 FOnimParser::ParseFiles(TConstArrayView<FString> FilePaths, TArray<FOnimClipSource>& OutClips, TArray<FString>& OutErrors, bool bParallel)
+{
+    // Sizing only grows, so clips (and their allocations) survive from one call to the next
+    if (OutClips.Num() < FilePaths.Num())
+    {
+        OutClips.SetNum(FilePaths.Num());
+    }
+    OutErrors.Reset();
+    OutErrors.SetNum(FilePaths.Num());
+
+    std::atomic<int32> NumParsed(0);
+    ParallelFor(FilePaths.Num(), [&](int32 Index)
+        {
+            if (ParseFile(FilePaths[Index], OutClips[Index], OutErrors[Index]))
+            {
+                NumParsed.fetch_add(1, std::memory_order_relaxed);
+            }
+        },
+        bParallel ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+
+    return NumParsed.load();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnimTypes.h"
+#include "Core/Utils/MappedFileView.h"
+
+/**
+ * Onim Parser
+ * Reads the text .onim format:
+ *
+ *   Version 8 2
+ *   {
+ *       Flags FLAG_0 ...          header fields, one per line
+ *       Frames 31
+ *       Animation
+ *       {
+ *           BoneRotation Float4 13745
+ *           {
+ *               FramesData MultiChannel          one "channel [Static]" block per component
+ *               FramesData SingleChannel Static  one line holding every component
+ *               FramesData SingleChannel         NumFrames lines of interleaved components
+ *               { ... }
+ *           }
+ *       }
+ *   }
+ *
+ * Parsing streams over the mapped file: values are scanned in place (eight fraction digits per step)
+ * and nothing is allocated per token. Reparsing into the same clip reuses its track arrays.
+ *
+ * Only the onim compiler and tools should parse text; the runtime maps compiled dictionaries.
+ */
+class GAME_API FOnimParser
+{
+public:
+    /** Parse a whole file; Data needs no terminator. Name is taken from the caller */
+    static bool Parse(const ANSICHAR* Data, int64 Size, FOnimClipSource& OutClip, FString& OutError);
+
+    /** Map and parse one .onim file; the clip is named after the file */
+    static bool ParseFile(const FString& FilePath, FOnimClipSource& OutClip, FString& OutError);
+
+    /**
+     * Parse many files, one per task when bParallel. OutClips/OutErrors line up with FilePaths; an
+     * error is empty when its file parsed. Returns the number of files that parsed.
+     */
+    static int32 ParseFiles(TConstArrayView<FString> FilePaths, TArray<FOnimClipSource>& OutClips, TArray<FString>& OutErrors, bool bParallel);
+};
+
+/** A source file mapped for parsing, or read into memory where mapping is unavailable */
+class GAME_API FOnimSourceFile
+{
+public:
+    bool Open(const FString& FilePath) { return View.Open(FilePath); }
+    void Close() { View.Close(); }
+
+    const ANSICHAR* GetData() const { return (const ANSICHAR*)View.GetData(); }
+    int64 GetSize() const { return View.GetSize(); }
+
+private:
+    FMappedFileView View;
+};
@@ -0,0 +1,449 @@
+#include "OnimPoseSampler.h"
+#include "OnimCompiledDictionary.h"
+#include "Math/VectorRegister.h"
+
+#if PLATFORM_ALWAYS_HAS_AVX
+#include <immintrin.h>
+#endif
+
+namespace OnimPoseSamplerPrivate
+{
+    static constexpr int32 LaneWidth = FOnimPoseClip::LaneWidth;
+    static constexpr int32 NumComponents = FOnimPoseClip::NumComponents;
+
+    enum EComponent : int32
+    {
+        RotX, RotY, RotZ, RotW, PosX, PosY, PosZ
+    };
+
+    /** Frames either side of Time and the blend between them */
+    struct FFramePair
+    {
+        const float* Frame0;
+        const float* Frame1;
+        float Alpha;
+    };
+
+    FFramePair GetFramePair(const FOnimPoseClip& Clip, float Time)
+    {
+        const int32 LastFrame = Clip.GetNumFrames() - 1;
+        const float FrameTime = Clip.GetDuration() > 0.0f ? FMath::Clamp(Time / Clip.GetDuration(), 0.0f, 1.0f) * LastFrame : 0.0f;
+        const int32 Frame0 = FMath::Min((int32)FrameTime, LastFrame);
+        const int32 Frame1 = FMath::Min(Frame0 + 1, LastFrame);
+        return { Clip.GetFrameData(Frame0), Clip.GetFrameData(Frame1), FrameTime - (float)Frame0 };
+    }
+
+    /** Lanes computed for one step, laid out [Component][LaneWidth] */
+    void WriteLanes(const float* Lanes, int32 FirstBone, int32 Count, TArrayView<FTransform> OutLocalPose)
+    {
+        for (int32 Lane = 0; Lane < Count; ++Lane)
+        {
+            OutLocalPose[FirstBone + Lane].SetComponents(
+                FQuat(Lanes[RotX * LaneWidth + Lane], Lanes[RotY * LaneWidth + Lane], Lanes[RotZ * LaneWidth + Lane], Lanes[RotW * LaneWidth + Lane]),
+                FVector(Lanes[PosX * LaneWidth + Lane], Lanes[PosY * LaneWidth + Lane], Lanes[PosZ * LaneWidth + Lane]),
+                FVector::OneVector);
+        }
+    }
+
+    // === Scalar ===
+
+    inline void GatherBone(const float* Frame, int32 Stride, int32 Bone, float* OutBone)
+    {
+        for (int32 Component = 0; Component < NumComponents; ++Component)
+        {
+            OutBone[Component] = Frame[Component * Stride + Bone];
+        }
+    }
+
+    /** Lerp translation, shortest-path nlerp rotation; the operation every path performs per lane */
+    inline void BlendBone(const float* A, const float* B, float Alpha, float* OutBone)
+    {
+        const float Dot = A[RotX] * B[RotX] + A[RotY] * B[RotY] + A[RotZ] * B[RotZ] + A[RotW] * B[RotW];
+        const float Bias = Dot >= 0.0f ? 1.0f : -1.0f;
+
+        float LengthSquared = 0.0f;
+        for (int32 Component = RotX; Component <= RotW; ++Component)
+        {
+            OutBone[Component] = A[Component] + (B[Component] * Bias - A[Component]) * Alpha;
+            LengthSquared += OutBone[Component] * OutBone[Component];
+        }
+
+        const float InvLength = FMath::InvSqrt(LengthSquared);
+        for (int32 Component = RotX; Component <= RotW; ++Component)
+        {
+            OutBone[Component] *= InvLength;
+        }
+        for (int32 Component = PosX; Component <= PosZ; ++Component)
+        {
+            OutBone[Component] = A[Component] + (B[Component] - A[Component]) * Alpha;
+        }
+    }
+
+    inline void WriteBone(const float* Bone, FTransform& OutTransform)
+    {
+        OutTransform.SetComponents(FQuat(Bone[RotX], Bone[RotY], Bone[RotZ], Bone[RotW]), FVector(Bone[PosX], Bone[PosY], Bone[PosZ]), FVector::OneVector);
+    }
+
+    // === 4-wide ===
+
+    struct FLanes4
+    {
+        VectorRegister4Float C[NumComponents];
+    };
+
+    FORCEINLINE void Load4(const float* RESTRICT Frame, int32 Stride, int32 Bone, FLanes4& Out)
+    {
+        for (int32 Component = 0; Component < NumComponents; ++Component)
+        {
+            Out.C[Component] = VectorLoadAligned(Frame + Component * Stride + Bone);
+        }
+    }
+
+    FORCEINLINE void Blend4(const FLanes4& A, const FLanes4& B, const VectorRegister4Float& Alpha, FLanes4& Out)
+    {
+        VectorRegister4Float Dot = VectorMultiply(A.C[RotX], B.C[RotX]);
+        Dot = VectorMultiplyAdd(A.C[RotY], B.C[RotY], Dot);
+        Dot = VectorMultiplyAdd(A.C[RotZ], B.C[RotZ], Dot);
+        Dot = VectorMultiplyAdd(A.C[RotW], B.C[RotW], Dot);
+        const VectorRegister4Float Bias = VectorSelect(VectorCompareGE(Dot, VectorZeroFloat()), VectorOneFloat(), VectorSetFloat1(-1.0f));
+
+        VectorRegister4Float LengthSquared = VectorZeroFloat();
+        for (int32 Component = RotX; Component <= RotW; ++Component)
+        {
+            Out.C[Component] = VectorMultiplyAdd(VectorSubtract(VectorMultiply(B.C[Component], Bias), A.C[Component]), Alpha, A.C[Component]);
+            LengthSquared = VectorMultiplyAdd(Out.C[Component], Out.C[Component], LengthSquared);
+        }
+
+        const VectorRegister4Float InvLength = VectorReciprocalSqrt(LengthSquared);
+        for (int32 Component = RotX; Component <= RotW; ++Component)
+        {
+            Out.C[Component] = VectorMultiply(Out.C[Component], InvLength);
+        }
+        for (int32 Component = PosX; Component <= PosZ; ++Component)
+        {
+            Out.C[Component] = VectorMultiplyAdd(VectorSubtract(B.C[Component], A.C[Component]), Alpha, A.C[Component]);
+        }
+    }
+
+    FORCEINLINE void Store4(const FLanes4& Lanes, float* RESTRICT Out)
+    {
+        for (int32 Component = 0; Component < NumComponents; ++Component)
+        {
+            VectorStoreAligned(Lanes.C[Component], Out + Component * LaneWidth);
+        }
+    }
+
+    // === 8-wide ===
+
+#if PLATFORM_ALWAYS_HAS_AVX
+    struct FLanes8
+    {
+        __m256 C[NumComponents];
+    };
+
+    FORCEINLINE void Load8(const float* RESTRICT Frame, int32 Stride, int32 Bone, FLanes8& Out)
+    {
+        for (int32 Component = 0; Component < NumComponents; ++Component)
+        {
+            Out.C[Component] = _mm256_load_ps(Frame + Component * Stride + Bone);
+        }
+    }
+
+    FORCEINLINE void Blend8(const FLanes8& A, const FLanes8& B, const __m256& Alpha, FLanes8& Out)
+    {
+        // AVX does not imply FMA, so multiply and add stay separate
+        __m256 Dot = _mm256_mul_ps(A.C[RotX], B.C[RotX]);
+        Dot = _mm256_add_ps(Dot, _mm256_mul_ps(A.C[RotY], B.C[RotY]));
+        Dot = _mm256_add_ps(Dot, _mm256_mul_ps(A.C[RotZ], B.C[RotZ]));
+        Dot = _mm256_add_ps(Dot, _mm256_mul_ps(A.C[RotW], B.C[RotW]));
+        const __m256 Bias = _mm256_blendv_ps(_mm256_set1_ps(-1.0f), _mm256_set1_ps(1.0f), _mm256_cmp_ps(Dot, _mm256_setzero_ps(), _CMP_GE_OQ));
+
+        __m256 LengthSquared = _mm256_setzero_ps();
+        for (int32 Component = RotX; Component <= RotW; ++Component)
+        {
+            const __m256 Delta = _mm256_sub_ps(_mm256_mul_ps(B.C[Component], Bias), A.C[Component]);
+            Out.C[Component] = _mm256_add_ps(A.C[Component], _mm256_mul_ps(Delta, Alpha));
+            LengthSquared = _mm256_add_ps(LengthSquared, _mm256_mul_ps(Out.C[Component], Out.C[Component]));
+        }
+
+        // One Newton-Raphson step takes the 12-bit estimate to near full precision
+        const __m256 Estimate = _mm256_rsqrt_ps(LengthSquared);
+        const __m256 InvLength = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), Estimate),
+            _mm256_sub_ps(_mm256_set1_ps(3.0f), _mm256_mul_ps(_mm256_mul_ps(LengthSquared, Estimate), Estimate)));
+        for (int32 Component = RotX; Component <= RotW; ++Component)
+        {
+            Out.C[Component] = _mm256_mul_ps(Out.C[Component], InvLength);
+        }
+        for (int32 Component = PosX; Component <= PosZ; ++Component)
+        {
+            const __m256 Delta = _mm256_sub_ps(B.C[Component], A.C[Component]);
+            Out.C[Component] = _mm256_add_ps(A.C[Component], _mm256_mul_ps(Delta, Alpha));
+        }
+    }
+
+    FORCEINLINE void Store8(const FLanes8& Lanes, float* RESTRICT Out)
+    {
+        for (int32 Component = 0; Component < NumComponents; ++Component)
+        {
+            _mm256_store_ps(Out + Component * LaneWidth, Lanes.C[Component]);
+        }
+    }
+#endif
+}
+
+// === FOnimPoseClip ===
+
+FOnimPoseClip::FOnimPoseClip()
+{
+    NumBones = 0;
+    NumFrames = 0;
+    Stride = 0;
+    Duration = 0.0f;
+}
+
+void FOnimPoseClip::Init(int32 InNumBones, int32 InNumFrames, float InDuration)
+{
+    NumBones = FMath::Max(InNumBones, 0);
+    NumFrames = FMath::Max(InNumFrames, 1);
+    Stride = Align(FMath::Max(NumBones, 1), LaneWidth);
+    Duration = FMath::Max(InDuration, 0.0f);
+    Data.Reset();
+    Data.SetNumZeroed((int64)NumFrames * NumComponents * Stride);
+
+    // Identity everywhere, padding included, so padded lanes normalise cleanly
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        float* RotW = Data.GetData() + ((int64)Frame * NumComponents + 3) * Stride;
+        for (int32 Bone = 0; Bone < Stride; ++Bone)
+        {
+            RotW[Bone] = 1.0f;
+        }
+    }
+}
+
+void FOnimPoseClip::SetKey(int32 Frame, int32 Bone, const FQuat4f& Rotation, const FVector3f& Translation)
+{
+    check(Frame >= 0 && Frame < NumFrames && Bone >= 0 && Bone < NumBones);
+    float* FrameData = Data.GetData() + (int64)Frame * NumComponents * Stride;
+    FrameData[0 * Stride + Bone] = Rotation.X;
+    FrameData[1 * Stride + Bone] = Rotation.Y;
+    FrameData[2 * Stride + Bone] = Rotation.Z;
+    FrameData[3 * Stride + Bone] = Rotation.W;
+    FrameData[4 * Stride + Bone] = Translation.X;
+    FrameData[5 * Stride + Bone] = Translation.Y;
+    FrameData[6 * Stride + Bone] = Translation.Z;
+}
+
+bool FOnimPoseClip::Build(const FOnimCompiledDictionary& Dictionary, int32 ClipIndex, TConstArrayView<uint32> BoneIds,
+                          TConstArrayView<FVector3f> DefaultTranslations)
+{
+    if (!Dictionary.IsOpen() || !Dictionary.GetClips().IsValidIndex(ClipIndex))
+    {
+        return false;
+    }
+
+    const FOnimClipRecord& Clip = Dictionary.GetClips()[ClipIndex];
+    Init(BoneIds.Num(), (int32)Clip.NumFrames, Clip.Duration);
+
+    TMap<uint32, int32> Slots;
+    Slots.Reserve(BoneIds.Num());
+    for (int32 Slot = 0; Slot < BoneIds.Num(); ++Slot)
+    {
+        Slots.Add(BoneIds[Slot], Slot);
+    }
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        float* FrameData = Data.GetData() + (int64)Frame * NumComponents * Stride;
+        for (int32 Slot = 0; Slot < FMath::Min(NumBones, DefaultTranslations.Num()); ++Slot)
+        {
+            FrameData[4 * Stride + Slot] = DefaultTranslations[Slot].X;
+            FrameData[5 * Stride + Slot] = DefaultTranslations[Slot].Y;
+            FrameData[6 * Stride + Slot] = DefaultTranslations[Slot].Z;
+        }
+    }
+
+    float Values[4];
+    for (const FOnimTrackRecord& Track : Dictionary.GetTracks(ClipIndex))
+    {
+        const EOnimTrackKind Kind = (EOnimTrackKind)Track.Kind;
+        const bool bRotation = Kind == EOnimTrackKind::BoneRotation && Track.NumChannels == 4;
+        const bool bPosition = Kind == EOnimTrackKind::BonePosition && Track.NumChannels == 3;
+        const int32* Slot = bRotation || bPosition ? Slots.Find(Dictionary.GetBoneId(Track)) : nullptr;
+        if (!Slot)
+        {
+            continue;
+        }
+
+        const int32 FirstComponent = bRotation ? 0 : 4;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            Dictionary.SampleFloats(Track, (float)Frame, Values);
+            float* FrameData = Data.GetData() + (int64)Frame * NumComponents * Stride;
+            for (int32 Channel = 0; Channel < Track.NumChannels; ++Channel)
+            {
+                FrameData[(FirstComponent + Channel) * Stride + *Slot] = Values[Channel];
+            }
+        }
+    }
+    return true;
+}
+
+// === FOnimPoseSampler ===
+
+void FOnimPoseSampler::SamplePose(const FOnimPoseClip& Clip, float Time, TArrayView<FTransform> OutLocalPose)
+{
+    using namespace OnimPoseSamplerPrivate;
+
+    const int32 NumBones = FMath::Min(Clip.GetNumBones(), OutLocalPose.Num());
+    if (NumBones <= 0)
+    {
+        return;
+    }
+
+    const FFramePair Pair = GetFramePair(Clip, Time);
+    const int32 Stride = Clip.GetStride();
+    alignas(32) float Lanes[NumComponents * LaneWidth];
+
+#if PLATFORM_ALWAYS_HAS_AVX
+    const __m256 Alpha = _mm256_set1_ps(Pair.Alpha);
+#else
+    const VectorRegister4Float Alpha = VectorSetFloat1(Pair.Alpha);
+#endif
+
+    for (int32 Bone = 0; Bone < NumBones; Bone += LaneWidth)
+    {
+#if PLATFORM_ALWAYS_HAS_AVX
+        FLanes8 Frame0, Frame1, Result;
+        Load8(Pair.Frame0, Stride, Bone, Frame0);
+        Load8(Pair.Frame1, Stride, Bone, Frame1);
+        Blend8(Frame0, Frame1, Alpha, Result);
+        Store8(Result, Lanes);
+#else
+        for (int32 Half = 0; Half < LaneWidth; Half += 4)
+        {
+            FLanes4 Frame0, Frame1, Result;
+            Load4(Pair.Frame0, Stride, Bone + Half, Frame0);
+            Load4(Pair.Frame1, Stride, Bone + Half, Frame1);
+            Blend4(Frame0, Frame1, Alpha, Result);
+            Store4(Result, Lanes + Half);
+        }
+#endif
+        WriteLanes(Lanes, Bone, FMath::Min(LaneWidth, NumBones - Bone), OutLocalPose);
+    }
+}
+
+void FOnimPoseSampler::SampleBlendedPose(const FOnimPoseClip& ClipA, float TimeA, const FOnimPoseClip& ClipB, float TimeB, float Weight,
+                                         TArrayView<FTransform> OutLocalPose)
+{
+    using namespace OnimPoseSamplerPrivate;
+
+    if (ClipA.GetNumBones() != ClipB.GetNumBones())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("OnimPoseSampler: Cannot blend clips with %d and %d bone slots"), ClipA.GetNumBones(), ClipB.GetNumBones());
+        return;
+    }
+
+    const int32 NumBones = FMath::Min(ClipA.GetNumBones(), OutLocalPose.Num());
+    if (NumBones <= 0)
+    {
+        return;
+    }
+
+    const FFramePair PairA = GetFramePair(ClipA, TimeA);
+    const FFramePair PairB = GetFramePair(ClipB, TimeB);
+    const int32 Stride = ClipA.GetStride();
+    alignas(32) float Lanes[NumComponents * LaneWidth];
+
+#if PLATFORM_ALWAYS_HAS_AVX
+    const __m256 AlphaA = _mm256_set1_ps(PairA.Alpha);
+    const __m256 AlphaB = _mm256_set1_ps(PairB.Alpha);
+    const __m256 BlendWeight = _mm256_set1_ps(FMath::Clamp(Weight, 0.0f, 1.0f));
+#else
+    const VectorRegister4Float AlphaA = VectorSetFloat1(PairA.Alpha);
+    const VectorRegister4Float AlphaB = VectorSetFloat1(PairB.Alpha);
+    const VectorRegister4Float BlendWeight = VectorSetFloat1(FMath::Clamp(Weight, 0.0f, 1.0f));
+#endif
+
+    for (int32 Bone = 0; Bone < NumBones; Bone += LaneWidth)
+    {
+#if PLATFORM_ALWAYS_HAS_AVX
+        FLanes8 Frame0, Frame1, SampleA, SampleB;
+        Load8(PairA.Frame0, Stride, Bone, Frame0);
+        Load8(PairA.Frame1, Stride, Bone, Frame1);
+        Blend8(Frame0, Frame1, AlphaA, SampleA);
+        Load8(PairB.Frame0, Stride, Bone, Frame0);
+        Load8(PairB.Frame1, Stride, Bone, Frame1);
+        Blend8(Frame0, Frame1, AlphaB, SampleB);
+        Blend8(SampleA, SampleB, BlendWeight, Frame0);
+        Store8(Frame0, Lanes);
+#else
+        for (int32 Half = 0; Half < LaneWidth; Half += 4)
+        {
+            FLanes4 Frame0, Frame1, SampleA, SampleB;
+            Load4(PairA.Frame0, Stride, Bone + Half, Frame0);
+            Load4(PairA.Frame1, Stride, Bone + Half, Frame1);
+            Blend4(Frame0, Frame1, AlphaA, SampleA);
+            Load4(PairB.Frame0, Stride, Bone + Half, Frame0);
+            Load4(PairB.Frame1, Stride, Bone + Half, Frame1);
+            Blend4(Frame0, Frame1, AlphaB, SampleB);
+            Blend4(SampleA, SampleB, BlendWeight, Frame0);
+            Store4(Frame0, Lanes + Half);
+        }
+#endif
+        WriteLanes(Lanes, Bone, FMath::Min(LaneWidth, NumBones - Bone), OutLocalPose);
+    }
+}
+
+void FOnimPoseSampler::SamplePoseScalar(const FOnimPoseClip& Clip, float Time, TArrayView<FTransform> OutLocalPose)
+{
+    using namespace OnimPoseSamplerPrivate;
+
+    const int32 NumBones = FMath::Min(Clip.GetNumBones(), OutLocalPose.Num());
+    const FFramePair Pair = GetFramePair(Clip, Time);
+    float Frame0[NumComponents];
+    float Frame1[NumComponents];
+    float Result[NumComponents];
+
+    for (int32 Bone = 0; Bone < NumBones; ++Bone)
+    {
+        GatherBone(Pair.Frame0, Clip.GetStride(), Bone, Frame0);
+        GatherBone(Pair.Frame1, Clip.GetStride(), Bone, Frame1);
+        BlendBone(Frame0, Frame1, Pair.Alpha, Result);
+        WriteBone(Result, OutLocalPose[Bone]);
+    }
+}
+
+void FOnimPoseSampler::SampleBlendedPoseScalar(const FOnimPoseClip& ClipA, float TimeA, const FOnimPoseClip& ClipB, float TimeB, float Weight,
+                                               TArrayView<FTransform> OutLocalPose)
+{
+    using namespace OnimPoseSamplerPrivate;
+
+    if (ClipA.GetNumBones() != ClipB.GetNumBones())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("OnimPoseSampler: Cannot blend clips with %d and %d bone slots"), ClipA.GetNumBones(), ClipB.GetNumBones());
+        return;
+    }
+
+    const int32 NumBones = FMath::Min(ClipA.GetNumBones(), OutLocalPose.Num());
+    const FFramePair PairA = GetFramePair(ClipA, TimeA);
+    const FFramePair PairB = GetFramePair(ClipB, TimeB);
+    const float BlendWeight = FMath::Clamp(Weight, 0.0f, 1.0f);
+    float Frame0[NumComponents];
+    float Frame1[NumComponents];
+    float SampleA[NumComponents];
+    float SampleB[NumComponents];
+    float Result[NumComponents];
+
+    for (int32 Bone = 0; Bone < NumBones; ++Bone)
+    {
+        GatherBone(PairA.Frame0, ClipA.GetStride(), Bone, Frame0);
+        GatherBone(PairA.Frame1, ClipA.GetStride(), Bone, Frame1);
+        BlendBone(Frame0, Frame1, PairA.Alpha, SampleA);
+        GatherBone(PairB.Frame0, ClipB.GetStride(), Bone, Frame0);
+        GatherBone(PairB.Frame1, ClipB.GetStride(), Bone, Frame1);
+        BlendBone(Frame0, Frame1, PairB.Alpha, SampleB);
+        BlendBone(SampleA, SampleB, BlendWeight, Result);
+        WriteBone(Result, OutLocalPose[Bone]);
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FOnimCompiledDictionary;
+
+/**
+ * Onim Pose Clip
+ * A clip decoded into the layout the pose sampler streams: for every frame, each transform component
+ * of every bone slot is contiguous,
+ *
+ *   RotX[Stride] RotY[Stride] RotZ[Stride] RotW[Stride] PosX[Stride] PosY[Stride] PosZ[Stride]
+ *
+ * with Stride the bone count padded to a whole number of 8-wide lanes (padding holds identity).
+ * Bone slots are chosen by whoever builds the clip, so clips built on the same bone list can be
+ * blended lane for lane. Values stay in the clip's source space.
+ */
+class GAME_API FOnimPoseClip
+{
+public:
+    static constexpr int32 LaneWidth = 8;
+    static constexpr int32 NumComponents = 7;
+
+    FOnimPoseClip();
+
+    /** Size the clip; every key starts as identity rotation and zero translation */
+    void Init(int32 InNumBones, int32 InNumFrames, float InDuration);
+
+    void SetKey(int32 Frame, int32 Bone, const FQuat4f& Rotation, const FVector3f& Translation);
+
+    /**
+     * Decode a compiled clip with one slot per entry of BoneIds. Bones without a rotation track keep
+     * identity, bones without a position track DefaultTranslations[Slot] (or zero if none given).
+     */
+    bool Build(const FOnimCompiledDictionary& Dictionary, int32 ClipIndex, TConstArrayView<uint32> BoneIds,
+               TConstArrayView<FVector3f> DefaultTranslations = TConstArrayView<FVector3f>());
+
+    int32 GetNumBones() const { return NumBones; }
+    int32 GetNumFrames() const { return NumFrames; }
+    int32 GetStride() const { return Stride; }
+    float GetDuration() const { return Duration; }
+
+    /** First float of a frame's component block */
+    const float* GetFrameData(int32 Frame) const { return Data.GetData() + (int64)Frame * NumComponents * Stride; }
+
+private:
+    int32 NumBones;
+    int32 NumFrames;
+    int32 Stride;
+    float Duration;
+    TArray<float, TAlignedHeapAllocator<32>> Data;
+};
+
+/**
+ * Onim Pose Sampler
+ * Evaluates every bone of a clip at a time into a caller-owned local-space transform buffer (one
+ * transform per bone slot): translations lerp and rotations nlerp between the bracketing frames,
+ * eight bones per step on AVX builds and four elsewhere. The blended variant samples two clips built
+ * on the same bone slots and crossfades them the same way.
+ *
+ * Times clamp to [0, Duration]; looping is the caller's. The scalar versions are the reference the
+ * vector paths are benchmarked and checked against. Runtime animation still plays UAnimSequence assets;
+ * the OnimPoseBenchmark commandlet is the sampler's only caller until onim clips are played directly.
+ */
+class GAME_API FOnimPoseSampler
+{
+public:
+    static void SamplePose(const FOnimPoseClip& Clip, float Time, TArrayView<FTransform> OutLocalPose);
+
+    /** Weight 0 is all A, 1 is all B */
+    static void SampleBlendedPose(const FOnimPoseClip& ClipA, float TimeA, const FOnimPoseClip& ClipB, float TimeB, float Weight,
+                                  TArrayView<FTransform> OutLocalPose);
+
+    static void SamplePoseScalar(const FOnimPoseClip& Clip, float Time, TArrayView<FTransform> OutLocalPose);
+
+    static void SampleBlendedPoseScalar(const FOnimPoseClip& ClipA, float TimeA, const FOnimPoseClip& ClipB, float TimeB, float Weight,
+                                        TArrayView<FTransform> OutLocalPose);
+};
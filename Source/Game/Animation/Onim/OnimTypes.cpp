@@ -0,0 +1,67 @@
+#include "OnimTypes.h"
+
+namespace OnimTypesPrivate
+{
+    static const ANSICHAR* TrackKindNames[] =
+    {
+        "BonePosition",
+        "BoneRotation",
+        "ModelPosition",
+        "ModelRotation",
+        "ActionFlags",
+        "AudioEvent",
+        "FacialAnimation",
+        "UV0"
+    };
+    static_assert(UE_ARRAY_COUNT(TrackKindNames) == (int32)EOnimTrackKind::Count, "TrackKindNames out of sync with EOnimTrackKind");
+
+    static const ANSICHAR* ValueTypeNames[] =
+    {
+        "Float3",
+        "Float4",
+        "UInt"
+    };
+    static_assert(UE_ARRAY_COUNT(ValueTypeNames) == (int32)EOnimValueType::Count, "ValueTypeNames out of sync with EOnimValueType");
+}
+
+const TCHAR* Onim::GetTrackKindName(EOnimTrackKind Kind)
+{
+    static const TCHAR* Names[] =
+    {
+        TEXT("BonePosition"),
+        TEXT("BoneRotation"),
+        TEXT("ModelPosition"),
+        TEXT("ModelRotation"),
+        TEXT("ActionFlags"),
+        TEXT("AudioEvent"),
+        TEXT("FacialAnimation"),
+        TEXT("UV0")
+    };
+    return Kind < EOnimTrackKind::Count ? Names[(int32)Kind] : TEXT("Unknown");
+}
+
+bool Onim::ParseTrackKind(FAnsiStringView Token, EOnimTrackKind& OutKind)
+{
+    for (int32 Index = 0; Index < (int32)EOnimTrackKind::Count; ++Index)
+    {
+        if (Token.Equals(OnimTypesPrivate::TrackKindNames[Index]))
+        {
+            OutKind = (EOnimTrackKind)Index;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Onim::ParseValueType(FAnsiStringView Token, EOnimValueType& OutType)
+{
+    for (int32 Index = 0; Index < (int32)EOnimValueType::Count; ++Index)
+    {
+        if (Token.Equals(OnimTypesPrivate::ValueTypeNames[Index]))
+        {
+            OutType = (EOnimValueType)Index;
+            return true;
+        }
+    }
+    return false;
+}
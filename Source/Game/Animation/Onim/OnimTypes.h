@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Track kinds found in .onim files; the first token of a track block's header line */
+enum class EOnimTrackKind : uint8
+{
+    BonePosition,
+    BoneRotation,
+    ModelPosition,
+    ModelRotation,
+    ActionFlags,
+    AudioEvent,
+    FacialAnimation,
+    UV0,
+    Count
+};
+
+/** Value type of a track: Float3/Float4 have that many channels, UInt has one */
+enum class EOnimValueType : uint8
+{
+    Float3,
+    Float4,
+    UInt,
+    Count
+};
+
+namespace Onim
+{
+    GAME_API const TCHAR* GetTrackKindName(EOnimTrackKind Kind);
+    GAME_API bool ParseTrackKind(FAnsiStringView Token, EOnimTrackKind& OutKind);
+    GAME_API bool ParseValueType(FAnsiStringView Token, EOnimValueType& OutType);
+
+    inline int32 GetNumChannels(EOnimValueType Type)
+    {
+        return Type == EOnimValueType::Float4 ? 4 : Type == EOnimValueType::Float3 ? 3 : 1;
+    }
+
+    inline bool IsFloatType(EOnimValueType Type)
+    {
+        return Type != EOnimValueType::UInt;
+    }
+
+    /** Named UInt values (e.g. facial clip names) are stored as this hash; lower-cased Jenkins one-at-a-time */
+    inline uint32 HashName(FAnsiStringView Name)
+    {
+        uint32 Hash = 0;
+        for (ANSICHAR Char : Name)
+        {
+            Hash += (uint8)FCharAnsi::ToLower(Char);
+            Hash += Hash << 10;
+            Hash ^= Hash >> 6;
+        }
+        Hash += Hash << 3;
+        Hash ^= Hash >> 11;
+        Hash += Hash << 15;
+        return Hash;
+    }
+}
+
+/**
+ * One parsed track. Values are channel-major: each channel holds NumFrames values, or a single value
+ * when its bit in StaticMask is set. Float tracks use Floats, UInt tracks use UInts.
+ */
+struct FOnimTrackSource
+{
+    EOnimTrackKind Kind = EOnimTrackKind::Count;
+    EOnimValueType Type = EOnimValueType::Count;
+
+    /** Bone id for bone tracks, the header's trailing number otherwise */
+    uint32 Id = 0;
+
+    uint8 StaticMask = 0;
+
+    TArray<float> Floats;
+    TArray<uint32> UInts;
+
+    int32 GetNumChannels() const { return Onim::GetNumChannels(Type); }
+    bool IsChannelStatic(int32 Channel) const { return (StaticMask & (1 << Channel)) != 0; }
+
+    /** Offset of a channel's first value in Floats/UInts */
+    int32 GetChannelOffset(int32 Channel, int32 NumFrames) const
+    {
+        int32 Offset = 0;
+        for (int32 Index = 0; Index < Channel; ++Index)
+        {
+            Offset += IsChannelStatic(Index) ? 1 : NumFrames;
+        }
+        return Offset;
+    }
+
+    int32 GetChannelNum(int32 Channel, int32 NumFrames) const
+    {
+        return IsChannelStatic(Channel) ? 1 : NumFrames;
+    }
+};
+
+/** One parsed .onim file: the header block and every track of its Animation block */
+struct FOnimClipSource
+{
+    /** File name without extension; the key AnimationGroups.xml refers to */
+    FString Name;
+
+    uint16 VersionMajor = 0;
+    uint16 VersionMinor = 0;
+
+    /** FLAG_n tokens as bit n */
+    uint32 Flags = 0;
+    uint32 ExtraFlags = 0;
+
+    int32 NumFrames = 0;
+    int32 NumSequences = 0;
+    int32 SequenceFrameLimit = 0;
+    float Duration = 0.0f;
+    int32 MaterialID = -1;
+
+    /** The header's unnamed _f10 field, kept for round-tripping */
+    uint32 Field10 = 0;
+
+    TArray<FOnimTrackSource> Tracks;
+
+    /** Names behind hashed UInt values, so tools can show them */
+    TMap<uint32, FString> ValueNames;
+
+    void Reset()
+    {
+        *this = FOnimClipSource();
+    }
+};
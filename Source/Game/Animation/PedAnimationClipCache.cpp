@@ -0,0 +1,287 @@
+#include "PedAnimationClipCache.h"
+#include "PedAnimationDictionary.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+
+namespace PedAnimationClipCachePrivate
+{
+    /** Dictionary paths name the package only ("/Game/.../walk"); soft paths need "Package.Asset" */
+    FSoftObjectPath ToSoftObjectPath(const FString& AssetPath)
+    {
+        if (AssetPath.Contains(TEXT(".")))
+        {
+            return FSoftObjectPath(AssetPath);
+        }
+        return FSoftObjectPath(AssetPath + TEXT(".") + FPackageName::GetShortName(AssetPath));
+    }
+}
+
+UPedAnimationClipCache::UPedAnimationClipCache()
+{
+    MemoryBudgetMB = 256;
+    TotalResidentBytes = 0;
+}
+
+UPedAnimationClipCache* UPedAnimationClipCache::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UPedAnimationClipCache>() : nullptr;
+}
+
+void UPedAnimationClipCache::Deinitialize()
+{
+    for (TPair<FName, FPedAnimationClipSet>& ClipSet : ClipSets)
+    {
+        if (ClipSet.Value.LoadHandle.IsValid())
+        {
+            ClipSet.Value.LoadHandle->CancelHandle();
+        }
+    }
+    ClipSets.Empty();
+    TotalResidentBytes = 0;
+
+    Super::Deinitialize();
+}
+
+// === Residency ===
+
+void UPedAnimationClipCache::AcquireDictionary(const UPedAnimationDictionary& Source, FName DictionaryName)
+{
+    if (DictionaryName.IsNone())
+    {
+        return;
+    }
+
+    FPedAnimationClipSet& ClipSet = ClipSets.FindOrAdd(DictionaryName);
+    ClipSet.RefCount++;
+    ClipSet.LastUsedFrame = GFrameCounter;
+
+    PreloadDictionary(Source, DictionaryName);
+}
+
+void UPedAnimationClipCache::ReleaseDictionary(FName DictionaryName)
+{
+    FPedAnimationClipSet* ClipSet = ClipSets.Find(DictionaryName);
+    if (!ClipSet || ClipSet->RefCount <= 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("PedAnimationClipCache: Released dictionary '%s' that is not held"), *DictionaryName.ToString());
+        return;
+    }
+
+    ClipSet->RefCount--;
+    ClipSet->LastUsedFrame = GFrameCounter;
+
+    if (ClipSet->RefCount == 0)
+    {
+        EnforceBudget();
+    }
+}
+
+void UPedAnimationClipCache::PreloadDictionary(const UPedAnimationDictionary& Source, FName DictionaryName)
+{
+    using namespace PedAnimationClipCachePrivate;
+
+    if (DictionaryName.IsNone() || IsDictionaryLoading(DictionaryName))
+    {
+        return;
+    }
+
+    TArray<TPair<FName, FString>> ClipPaths;
+    if (!Source.GetDictionaryClipPaths(DictionaryName, ClipPaths))
+    {
+        return;
+    }
+
+    FPedAnimationClipSet& ClipSet = ClipSets.FindOrAdd(DictionaryName);
+    TArray<FName> AnimationNames;
+    TArray<FSoftObjectPath> AssetPaths;
+    for (const TPair<FName, FString>& ClipPath : ClipPaths)
+    {
+        if (!ClipSet.Clips.Contains(ClipPath.Key))
+        {
+            AnimationNames.Add(ClipPath.Key);
+            AssetPaths.Add(ToSoftObjectPath(ClipPath.Value));
+        }
+    }
+
+    if (AssetPaths.Num() == 0)
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("PedAnimationClipCache: Loading %d clips for dictionary '%s'"), AssetPaths.Num(), *DictionaryName.ToString());
+
+    TWeakObjectPtr<UPedAnimationClipCache> WeakThis(this);
+    TSharedPtr<FStreamableHandle> LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths,
+        FStreamableDelegate::CreateLambda([WeakThis, DictionaryName, AnimationNames, AssetPaths]()
+        {
+            if (WeakThis.IsValid())
+            {
+                WeakThis->OnDictionaryLoaded(DictionaryName, AnimationNames, AssetPaths);
+            }
+        }));
+
+    // Assets already in memory complete inside the request, which can even evict an unheld set, so
+    // look the set up again rather than trusting ClipSet
+    FPedAnimationClipSet* PendingSet = ClipSets.Find(DictionaryName);
+    if (PendingSet && LoadHandle.IsValid() && !LoadHandle->HasLoadCompleted())
+    {
+        PendingSet->LoadHandle = LoadHandle;
+    }
+}
+
+void UPedAnimationClipCache::OnDictionaryLoaded(FName DictionaryName, TArray<FName> AnimationNames, TArray<FSoftObjectPath> AssetPaths)
+{
+    FPedAnimationClipSet* ClipSet = ClipSets.Find(DictionaryName);
+    if (!ClipSet)
+    {
+        return;
+    }
+
+    int32 NumFailed = 0;
+    for (int32 Index = 0; Index < AnimationNames.Num(); Index++)
+    {
+        UAnimSequence* Clip = Cast<UAnimSequence>(AssetPaths[Index].ResolveObject());
+        if (!Clip)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("PedAnimationClipCache: Failed to load '%s' for dictionary '%s'"),
+                   *AssetPaths[Index].ToString(), *DictionaryName.ToString());
+            NumFailed++;
+        }
+
+        // A clip a ped loaded itself while this was in flight is kept
+        if (!ClipSet->Clips.Contains(AnimationNames[Index]))
+        {
+            StoreClip(*ClipSet, AnimationNames[Index], Clip);
+        }
+    }
+
+    // The clip set holds the references now
+    ClipSet->LoadHandle.Reset();
+
+    UE_LOG(LogTemp, Log, TEXT("PedAnimationClipCache: Dictionary '%s' resolved, %d clips (%d failed), %.2f MB resident of %.2f MB total"),
+           *DictionaryName.ToString(), AnimationNames.Num() - NumFailed, NumFailed,
+           ClipSet->ResidentBytes / (1024.0 * 1024.0), TotalResidentBytes / (1024.0 * 1024.0));
+
+    EnforceBudget();
+}
+
+void UPedAnimationClipCache::EnforceBudget()
+{
+    const int64 BudgetBytes = (int64)MemoryBudgetMB * 1024 * 1024;
+    while (TotalResidentBytes > BudgetBytes)
+    {
+        // Few dictionaries are ever resident, so a scan beats keeping an ordered list current
+        FName Victim;
+        uint64 OldestFrame = MAX_uint64;
+        for (const TPair<FName, FPedAnimationClipSet>& ClipSet : ClipSets)
+        {
+            const bool bLoading = ClipSet.Value.LoadHandle.IsValid() && ClipSet.Value.LoadHandle->IsLoadingInProgress();
+            if (ClipSet.Value.RefCount == 0 && !bLoading && ClipSet.Value.LastUsedFrame < OldestFrame)
+            {
+                Victim = ClipSet.Key;
+                OldestFrame = ClipSet.Value.LastUsedFrame;
+            }
+        }
+
+        if (Victim.IsNone())
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("PedAnimationClipCache: %.2f MB held over the %d MB budget"),
+                   TotalResidentBytes / (1024.0 * 1024.0), MemoryBudgetMB);
+            return;
+        }
+
+        const FPedAnimationClipSet& Evicted = ClipSets.FindChecked(Victim);
+        TotalResidentBytes -= Evicted.ResidentBytes;
+        UE_LOG(LogTemp, Log, TEXT("PedAnimationClipCache: Evicted dictionary '%s' (%.2f MB)"), *Victim.ToString(), Evicted.ResidentBytes / (1024.0 * 1024.0));
+        ClipSets.Remove(Victim);
+    }
+}
+
+void UPedAnimationClipCache::SetMemoryBudgetMB(int32 InMemoryBudgetMB)
+{
+    MemoryBudgetMB = FMath::Max(InMemoryBudgetMB, 0);
+    EnforceBudget();
+}
+
+// === Clips ===
+
+bool UPedAnimationClipCache::FindClip(FName DictionaryName, FName AnimationName, UAnimSequence*& OutClip)
+{
+    FPedAnimationClipSet* ClipSet = ClipSets.Find(DictionaryName);
+    const TObjectPtr<UAnimSequence>* Clip = ClipSet ? ClipSet->Clips.Find(AnimationName) : nullptr;
+    if (!Clip)
+    {
+        OutClip = nullptr;
+        return false;
+    }
+
+    ClipSet->LastUsedFrame = GFrameCounter;
+    OutClip = Clip->Get();
+    return true;
+}
+
+void UPedAnimationClipCache::AddClip(FName DictionaryName, FName AnimationName, UAnimSequence* Clip)
+{
+    FPedAnimationClipSet& ClipSet = ClipSets.FindOrAdd(DictionaryName);
+    if (!ClipSet.Clips.Contains(AnimationName))
+    {
+        StoreClip(ClipSet, AnimationName, Clip);
+        ClipSet.LastUsedFrame = GFrameCounter;
+        EnforceBudget();
+    }
+}
+
+void UPedAnimationClipCache::StoreClip(FPedAnimationClipSet& ClipSet, FName AnimationName, UAnimSequence* Clip)
+{
+    ClipSet.Clips.Add(AnimationName, Clip);
+    if (Clip)
+    {
+        const int64 ClipBytes = Clip->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+        ClipSet.ResidentBytes += ClipBytes;
+        TotalResidentBytes += ClipBytes;
+    }
+}
+
+// === Stats ===
+
+bool UPedAnimationClipCache::IsDictionaryLoading(FName DictionaryName) const
+{
+    const FPedAnimationClipSet* ClipSet = ClipSets.Find(DictionaryName);
+    return ClipSet && ClipSet->LoadHandle.IsValid() && ClipSet->LoadHandle->IsLoadingInProgress();
+}
+
+int32 UPedAnimationClipCache::GetRefCount(FName DictionaryName) const
+{
+    const FPedAnimationClipSet* ClipSet = ClipSets.Find(DictionaryName);
+    return ClipSet ? ClipSet->RefCount : 0;
+}
+
+int64 UPedAnimationClipCache::GetResidentBytes(FName DictionaryName) const
+{
+    const FPedAnimationClipSet* ClipSet = ClipSets.Find(DictionaryName);
+    return ClipSet ? ClipSet->ResidentBytes : 0;
+}
+
+int32 UPedAnimationClipCache::GetNumCachedClips() const
+{
+    int32 NumClips = 0;
+    for (const TPair<FName, FPedAnimationClipSet>& ClipSet : ClipSets)
+    {
+        NumClips += ClipSet.Value.Clips.Num();
+    }
+    return NumClips;
+}
+
+TMap<FName, int64> UPedAnimationClipCache::GetResidentBytesPerDictionary() const
+{
+    TMap<FName, int64> ResidentBytes;
+    for (const TPair<FName, FPedAnimationClipSet>& ClipSet : ClipSets)
+    {
+        ResidentBytes.Add(ClipSet.Key, ClipSet.Value.ResidentBytes);
+    }
+    return ResidentBytes;
+}
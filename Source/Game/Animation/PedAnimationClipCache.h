@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "Animation/AnimSequence.h"
+#include "PedAnimationClipCache.generated.h"
+
+class UPedAnimationDictionary;
+
+/** Resolved clips of one animation dictionary */
+USTRUCT()
+struct FPedAnimationClipSet
+{
+    GENERATED_BODY()
+
+    /** Entry name to clip; a null clip records a path that failed to load, so it is not retried */
+    UPROPERTY()
+    TMap<FName, TObjectPtr<UAnimSequence>> Clips;
+
+    /** In-flight async load, if any */
+    TSharedPtr<FStreamableHandle> LoadHandle;
+
+    /** Ped contexts currently holding the dictionary; only unheld sets are evicted */
+    int32 RefCount = 0;
+
+    /** Estimated memory of the resolved clips */
+    int64 ResidentBytes = 0;
+
+    /** GFrameCounter when last acquired or played from, for LRU eviction */
+    uint64 LastUsedFrame = 0;
+};
+
+/**
+ * Ped Animation Clip Cache
+ * Resolved UAnimSequence per (dictionary, animation name), shared by every ped whose context resolves
+ * to that dictionary, so playback is a pointer fetch rather than path resolution and LoadObject.
+ *
+ * Residency: peds acquire the dictionaries their contexts resolve to and release them when they
+ * leave the region or swap the dictionary out. Acquiring loads the dictionary asynchronously through
+ * the streamable manager. While resident bytes exceed MemoryBudgetMB, the least recently used
+ * dictionaries nobody holds are evicted. A clip asked for before its load lands is the caller's to
+ * load and add.
+ */
+UCLASS(Config=Game)
+class GAME_API UPedAnimationClipCache : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UPedAnimationClipCache();
+
+    /** Cache of the object's game instance, nullptr if it has none */
+    static UPedAnimationClipCache* Get(const UObject* WorldContextObject);
+
+    virtual void Deinitialize() override;
+
+    // === Residency ===
+
+    /** Hold a dictionary resident, loading whatever of it is not already cached or loading */
+    void AcquireDictionary(const UPedAnimationDictionary& Source, FName DictionaryName);
+
+    /** Drop one hold; the dictionary stays cached until the budget needs its memory */
+    void ReleaseDictionary(FName DictionaryName);
+
+    /** Start loading a dictionary without holding it, e.g. to warm one about to be swapped in */
+    void PreloadDictionary(const UPedAnimationDictionary& Source, FName DictionaryName);
+
+    /** Evict unheld dictionaries, least recently used first, until within budget */
+    void EnforceBudget();
+
+    void SetMemoryBudgetMB(int32 InMemoryBudgetMB);
+    int32 GetMemoryBudgetMB() const { return MemoryBudgetMB; }
+
+    // === Clips ===
+
+    /** True if the clip has been resolved; OutClip is null if its load failed */
+    bool FindClip(FName DictionaryName, FName AnimationName, UAnimSequence*& OutClip);
+
+    void AddClip(FName DictionaryName, FName AnimationName, UAnimSequence* Clip);
+
+    // === Stats ===
+
+    bool IsDictionaryLoading(FName DictionaryName) const;
+    int32 GetRefCount(FName DictionaryName) const;
+    int64 GetResidentBytes(FName DictionaryName) const;
+    int64 GetTotalResidentBytes() const { return TotalResidentBytes; }
+    int32 GetNumCachedClips() const;
+
+    /** Resident bytes of every cached dictionary */
+    UFUNCTION(BlueprintCallable, Category = "Animation Residency")
+    TMap<FName, int64> GetResidentBytesPerDictionary() const;
+
+private:
+    /** Resident memory above which unheld dictionaries are evicted */
+    UPROPERTY(Config)
+    int32 MemoryBudgetMB;
+
+    UPROPERTY()
+    TMap<FName, FPedAnimationClipSet> ClipSets;
+
+    int64 TotalResidentBytes;
+
+    void OnDictionaryLoaded(FName DictionaryName, TArray<FName> AnimationNames, TArray<FSoftObjectPath> AssetPaths);
+    void StoreClip(FPedAnimationClipSet& ClipSet, FName AnimationName, UAnimSequence* Clip);
+};
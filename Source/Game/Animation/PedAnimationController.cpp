@@ -5,6 +5,7 @@
 #include "Animation/AnimSequence.h"
 #include "Engine/Engine.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "PedAnimationLODSubsystem.h"
 
 UPedAnimationController::UPedAnimationController()
 {
@@ -30,12 +31,24 @@ UPedAnimationController::UPedAnimationController()
     BlendDuration = 0.15f;
     bIsBlending = false;
     
-    PreviousMovementState = EPedMovementState::Idle;
-    PreviousStanceState = EPedStanceState::Standing;
-    
     PreviousYaw = 0.0f;
-    YawDelta = 0.0f;
     TurnThreshold = 15.0f; // Degrees threshold for turn detection
+
+    UpdateTier = EPedAnimationUpdateTier::Full;
+    LODUpdateInterval = 1;
+    bLODManaged = false;
+    bFullUpdateGranted = true;
+    PendingUpdateTime = 0.0f;
+    LastFullUpdateFrame = 0;
+
+    LODFromSpeed = 0.0f;
+    LODToSpeed = 0.0f;
+    LODFromDirection = 0.0f;
+    LODDirectionDelta = 0.0f;
+    LODFromLeanAngle = 0.0f;
+    LODToLeanAngle = 0.0f;
+    LODInterpTime = 0.0f;
+    LODInterpDuration = 0.0f;
 }
 
 void UPedAnimationController::NativeInitializeAnimation()
@@ -50,6 +63,11 @@ void UPedAnimationController::NativeInitializeAnimation()
         // Initialize animation system
         LoadAllAnimations();
         InitializeAnimationData();
+
+        if (UPedAnimationLODSubsystem* LODSubsystem = UPedAnimationLODSubsystem::Get(this))
+        {
+            LODSubsystem->RegisterController(this);
+        }
         
         UE_LOG(LogTemp, Log, TEXT("PedAnimationController: Initialized for character %s"), 
                *OwnerCharacter->GetName());
@@ -62,248 +80,393 @@ void UPedAnimationController::NativeUpdateAnimation(float DeltaTimeX)
     
     if (!OwnerCharacter)
         return;
+
+    // Results of the last thread-safe update, and the transitions it asked for
+    PublishUpdateOutputs();
+
+    PendingUpdateTime += DeltaTimeX;
+    UpdateInputs.bRunStateMachine = false;
+
+    // Between LOD grants only the blend and the eased movement outputs advance
+    if (!bLODManaged || bFullUpdateGranted)
+    {
+        // The state machine sees the whole time since its last run, not just this frame
+        bFullUpdateGranted = false;
+        GatherUpdateInputs(PendingUpdateTime);
+        PendingUpdateTime = 0.0f;
+    }
+
+    UpdateInterpolatedOutputs(DeltaTimeX);
+    UpdateBlending(DeltaTimeX);
+}
+
+void UPedAnimationController::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+    Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+    const FPedAnimationUpdateInputs& In = UpdateInputs;
+    if (!In.bRunStateMachine)
+        return;
+
+    FPedAnimationUpdateOutputs& Out = UpdateOutputs;
+    Out.TransitionRequests.Reset();
     
     // Update all movement variables
-    UpdateMovementVariables();
+    UpdateMovementVariables(In, Out);
     
     // Handle turn detection
-    HandleTurnDetection();
+    HandleTurnDetection(In, Out);
     
     // Update animation states based on movement
-    UpdateAnimationStates();
+    UpdateAnimationStates(In, Out);
     
     // Handle state transitions
-    HandleStateTransitions();
-    
-    // Update blending
-    UpdateBlending(DeltaTimeX);
+    HandleStateTransitions(In, Out);
+
+    Out.StepTime = In.StepTime;
+    Out.bInterpolate = In.bInterpolate;
+    Out.bHasResults = true;
 }
 
-void UPedAnimationController::UpdateMovementVariables()
+void UPedAnimationController::GatherUpdateInputs(float StepTime)
 {
-    if (!OwnerCharacter || !OwnerCharacter->GetCharacterMovement())
+    FPedAnimationUpdateInputs& In = UpdateInputs;
+
+    if (const UCharacterMovementComponent* Movement = OwnerCharacter->GetCharacterMovement())
+    {
+        In.Velocity = Movement->Velocity;
+        In.bIsFalling = Movement->IsFalling();
+        In.bIsCrouching = Movement->IsCrouching();
+    }
+    else
+    {
+        // The old update bailed out of movement without a movement component; keep the last values
+        In.Velocity = UpdateOutputs.Velocity;
+        In.bIsFalling = UpdateOutputs.bIsInAir;
+        In.bIsCrouching = UpdateOutputs.bIsCrouching;
+    }
+
+    In.ActorForward = OwnerCharacter->GetActorForwardVector();
+    In.ActorYaw = OwnerCharacter->GetActorRotation().Yaw;
+    In.bIsAiming = bIsAiming;
+    In.MovementState = CurrentMovementState;
+    In.StanceState = CurrentStanceState;
+    In.StepTime = StepTime;
+    In.bInterpolate = LODUpdateInterval > 1;
+    In.bRunStateMachine = true;
+}
+
+void UPedAnimationController::PublishUpdateOutputs()
+{
+    FPedAnimationUpdateOutputs& Out = UpdateOutputs;
+    if (!Out.bHasResults)
         return;
-    
-    UCharacterMovementComponent* Movement = OwnerCharacter->GetCharacterMovement();
-    
+
+    Out.bHasResults = false;
+    LastFullUpdateFrame = GFrameCounter;
+
+    // At a reduced rate, ease the movement outputs toward the new values over about one interval instead of stepping
+    if (Out.bInterpolate && Out.StepTime > 0.0f)
+    {
+        LODFromSpeed = Speed;
+        LODToSpeed = Out.Speed;
+        LODFromDirection = Direction;
+        LODDirectionDelta = FMath::FindDeltaAngleDegrees(Direction, Out.Direction);
+        LODFromLeanAngle = LeanAngle;
+        LODToLeanAngle = Out.LeanAngle;
+        LODInterpTime = 0.0f;
+        LODInterpDuration = Out.StepTime;
+    }
+    else
+    {
+        Speed = Out.Speed;
+        Direction = Out.Direction;
+        LeanAngle = Out.LeanAngle;
+        LODInterpDuration = 0.0f;
+    }
+
+    Velocity = Out.Velocity;
+    TurnRate = Out.TurnRate;
+    CurrentTurnDirection = Out.TurnDirection;
+    bIsInAir = Out.bIsInAir;
+    bIsCrouching = Out.bIsCrouching;
+    CurrentMovementState = Out.MovementState;
+    CurrentStanceState = Out.StanceState;
+
+    for (const FPedAnimationTransitionRequest& Request : Out.TransitionRequests)
+    {
+        PlayTransition(Request);
+    }
+    Out.TransitionRequests.Reset();
+}
+
+void UPedAnimationController::PlayTransition(const FPedAnimationTransitionRequest& Request)
+{
+    switch (Request.Transition)
+    {
+        case EPedAnimationTransition::Start:
+            PlayAnimation(GetBestStartAnimation(Request.MovementState, Request.TurnAngle));
+            break;
+
+        case EPedAnimationTransition::Stop:
+            PlayAnimation(GetBestStopAnimation(Request.MovementState, ShouldUseLeftFootVariant()));
+            break;
+
+        case EPedAnimationTransition::Turn:
+            PlayAnimation(GetBestTurnAnimation(Request.MovementState, Request.TurnAngle));
+            break;
+
+        case EPedAnimationTransition::JumpTakeoff:
+            PlayAnimation(GetBestJumpAnimation(true, false, false, ShouldUseLeftFootVariant()));
+            break;
+
+        case EPedAnimationTransition::EnterCrouch:
+            PlayAnimation(CrouchAnims.IdleToCrouch);
+            break;
+
+        case EPedAnimationTransition::ExitCrouch:
+            PlayAnimation(CrouchAnims.CrouchToIdle);
+            break;
+    }
+}
+
+void UPedAnimationController::NativeUninitializeAnimation()
+{
+    if (UPedAnimationLODSubsystem* LODSubsystem = UPedAnimationLODSubsystem::Get(this))
+    {
+        LODSubsystem->UnregisterController(this);
+    }
+
+    Super::NativeUninitializeAnimation();
+}
+
+void UPedAnimationController::SetLODManaged(bool bManaged)
+{
+    bLODManaged = bManaged;
+    bFullUpdateGranted = true;
+    LODInterpDuration = 0.0f;
+
+    if (!bManaged)
+    {
+        UpdateTier = EPedAnimationUpdateTier::Full;
+        LODUpdateInterval = 1;
+    }
+}
+
+void UPedAnimationController::SetUpdateTier(EPedAnimationUpdateTier Tier, int32 UpdateInterval)
+{
+    UpdateTier = Tier;
+    LODUpdateInterval = FMath::Max(UpdateInterval, 1);
+}
+
+void UPedAnimationController::UpdateInterpolatedOutputs(float DeltaTime)
+{
+    if (LODInterpDuration <= 0.0f)
+        return;
+
+    LODInterpTime = FMath::Min(LODInterpTime + DeltaTime, LODInterpDuration);
+    const float Alpha = LODInterpTime / LODInterpDuration;
+
+    Speed = FMath::Lerp(LODFromSpeed, LODToSpeed, Alpha);
+    Direction = FMath::UnwindDegrees(LODFromDirection + LODDirectionDelta * Alpha);
+    LeanAngle = FMath::Lerp(LODFromLeanAngle, LODToLeanAngle, Alpha);
+
+    if (LODInterpTime >= LODInterpDuration)
+    {
+        LODInterpDuration = 0.0f;
+    }
+}
+
+void UPedAnimationController::UpdateMovementVariables(const FPedAnimationUpdateInputs& In, FPedAnimationUpdateOutputs& Out) const
+{
     // Get velocity and speed
-    Velocity = Movement->Velocity;
-    Speed = Velocity.Size();
+    Out.Velocity = In.Velocity;
+    Out.Speed = Out.Velocity.Size();
     
     // Calculate movement direction relative to character
-    if (Speed > 1.0f)
+    if (Out.Speed > 1.0f)
     {
-        FVector ForwardVector = OwnerCharacter->GetActorForwardVector();
-        FVector VelocityNormalized = Velocity.GetSafeNormal();
-        Direction = FMath::Atan2(
-            FVector::CrossProduct(ForwardVector, VelocityNormalized).Z,
-            FVector::DotProduct(ForwardVector, VelocityNormalized)
+        FVector VelocityNormalized = Out.Velocity.GetSafeNormal();
+        Out.Direction = FMath::Atan2(
+            FVector::CrossProduct(In.ActorForward, VelocityNormalized).Z,
+            FVector::DotProduct(In.ActorForward, VelocityNormalized)
         ) * 180.0f / PI;
     }
     else
     {
-        Direction = 0.0f;
+        Out.Direction = 0.0f;
     }
     
     // Update movement flags
-    bIsInAir = Movement->IsFalling();
-    bIsCrouching = Movement->IsCrouching();
+    Out.bIsInAir = In.bIsFalling;
+    Out.bIsCrouching = In.bIsCrouching;
     
-    // Calculate lean angle for turns
-    if (Speed > 100.0f) // Only lean when moving at decent speed
+    // Calculate lean angle for turns, from the previous update's turn rate
+    if (Out.Speed > 100.0f) // Only lean when moving at decent speed
     {
-        LeanAngle = FMath::Clamp(TurnRate * 0.5f, -30.0f, 30.0f);
+        Out.LeanAngle = FMath::Clamp(Out.TurnRate * 0.5f, -30.0f, 30.0f);
     }
     else
     {
-        LeanAngle = FMath::FInterpTo(LeanAngle, 0.0f, GetWorld()->GetDeltaSeconds(), 5.0f);
+        Out.LeanAngle = FMath::FInterpTo(Out.LeanAngle, 0.0f, In.StepTime, 5.0f);
     }
 }
 
-void UPedAnimationController::HandleTurnDetection()
+void UPedAnimationController::HandleTurnDetection(const FPedAnimationUpdateInputs& In, FPedAnimationUpdateOutputs& Out)
 {
-    if (!OwnerCharacter)
-        return;
-    
-    float CurrentYaw = OwnerCharacter->GetActorRotation().Yaw;
-    YawDelta = FMath::FindDeltaAngleDegrees(PreviousYaw, CurrentYaw);
+    const float DeltaTime = In.StepTime;
+    Out.YawDelta = FMath::FindDeltaAngleDegrees(PreviousYaw, In.ActorYaw);
     
     // Calculate turn rate (degrees per second)
-    float DeltaTime = GetWorld()->GetDeltaSeconds();
     if (DeltaTime > 0.0f)
     {
-        TurnRate = YawDelta / DeltaTime;
+        Out.TurnRate = Out.YawDelta / DeltaTime;
     }
     
     // Determine turn direction
-    if (FMath::Abs(YawDelta) > TurnThreshold * DeltaTime)
+    if (FMath::Abs(Out.YawDelta) > TurnThreshold * DeltaTime)
     {
-        if (YawDelta > 0.0f)
+        if (Out.YawDelta > 0.0f)
         {
-            CurrentTurnDirection = ETurnDirection::Right;
+            Out.TurnDirection = ETurnDirection::Right;
         }
         else
         {
-            CurrentTurnDirection = ETurnDirection::Left;
+            Out.TurnDirection = ETurnDirection::Left;
         }
         
         // Check for 180+ degree turns
-        if (FMath::Abs(YawDelta) > 90.0f * DeltaTime)
+        if (FMath::Abs(Out.YawDelta) > 90.0f * DeltaTime)
         {
-            CurrentTurnDirection = ETurnDirection::Around180;
+            Out.TurnDirection = ETurnDirection::Around180;
         }
     }
     else
     {
-        CurrentTurnDirection = ETurnDirection::None;
+        Out.TurnDirection = ETurnDirection::None;
     }
     
-    PreviousYaw = CurrentYaw;
+    PreviousYaw = In.ActorYaw;
 }
 
-void UPedAnimationController::UpdateAnimationStates()
+void UPedAnimationController::UpdateAnimationStates(const FPedAnimationUpdateInputs& In, FPedAnimationUpdateOutputs& Out) const
 {
-    // Store previous states
-    PreviousMovementState = CurrentMovementState;
-    PreviousStanceState = CurrentStanceState;
-    
     // Update stance state
-    if (bIsCrouching)
+    if (Out.bIsCrouching)
     {
-        CurrentStanceState = EPedStanceState::Crouched;
+        Out.StanceState = EPedStanceState::Crouched;
     }
-    else if (bIsAiming)
+    else if (In.bIsAiming)
     {
-        CurrentStanceState = EPedStanceState::Combat;
+        Out.StanceState = EPedStanceState::Combat;
     }
     else
     {
-        CurrentStanceState = EPedStanceState::Standing;
+        Out.StanceState = EPedStanceState::Standing;
     }
     
     // Update movement state based on speed and conditions
-    if (bIsInAir)
+    if (Out.bIsInAir)
     {
-        CurrentMovementState = EPedMovementState::Jumping;
+        Out.MovementState = EPedMovementState::Jumping;
     }
-    else if (Speed < 1.0f)
+    else if (Out.Speed < 1.0f)
     {
-        CurrentMovementState = EPedMovementState::Idle;
+        Out.MovementState = EPedMovementState::Idle;
     }
-    else if (Speed < 150.0f) // Walk threshold
+    else if (Out.Speed < 150.0f) // Walk threshold
     {
-        CurrentMovementState = EPedMovementState::Walking;
+        Out.MovementState = EPedMovementState::Walking;
     }
-    else if (Speed < 400.0f) // Run threshold
+    else if (Out.Speed < 400.0f) // Run threshold
     {
-        CurrentMovementState = EPedMovementState::Running;
+        Out.MovementState = EPedMovementState::Running;
     }
     else // Sprint
     {
-        CurrentMovementState = EPedMovementState::Sprinting;
+        Out.MovementState = EPedMovementState::Sprinting;
     }
     
     // Handle turning state
-    if (CurrentTurnDirection != ETurnDirection::None && Speed > 50.0f)
+    if (Out.TurnDirection != ETurnDirection::None && Out.Speed > 50.0f)
     {
         // Only show turning state if we're moving and turning significantly
-        if (FMath::Abs(TurnRate) > 60.0f) // Degrees per second threshold
+        if (FMath::Abs(Out.TurnRate) > 60.0f) // Degrees per second threshold
         {
-            CurrentMovementState = EPedMovementState::Turning;
+            Out.MovementState = EPedMovementState::Turning;
         }
     }
 }
 
-void UPedAnimationController::HandleStateTransitions()
+void UPedAnimationController::HandleStateTransitions(const FPedAnimationUpdateInputs& In, FPedAnimationUpdateOutputs& Out) const
 {
+    // Transitions are detected against the state the game thread last saw; it selects and plays them
+    const EPedMovementState PreviousMovementState = In.MovementState;
+    const EPedStanceState PreviousStanceState = In.StanceState;
+
     // Handle transitions between movement states
-    if (PreviousMovementState != CurrentMovementState)
+    if (PreviousMovementState != Out.MovementState)
     {
-        switch (CurrentMovementState)
+        switch (Out.MovementState)
         {
             case EPedMovementState::Walking:
                 if (PreviousMovementState == EPedMovementState::Idle)
                 {
                     // Start walking animation
-                    FAnimationData StartAnim = GetBestStartAnimation(CurrentMovementState, YawDelta);
-                    PlayAnimation(StartAnim);
+                    Out.TransitionRequests.Add({ EPedAnimationTransition::Start, Out.MovementState, Out.YawDelta });
                 }
                 break;
                 
             case EPedMovementState::Running:
-                if (PreviousMovementState == EPedMovementState::Walking)
+                if (PreviousMovementState == EPedMovementState::Walking || PreviousMovementState == EPedMovementState::Idle)
                 {
-                    // Transition from walk to run
-                    FAnimationData StartAnim = GetBestStartAnimation(CurrentMovementState, YawDelta);
-                    PlayAnimation(StartAnim);
-                }
-                else if (PreviousMovementState == EPedMovementState::Idle)
-                {
-                    // Start running from idle
-                    FAnimationData StartAnim = GetBestStartAnimation(CurrentMovementState, YawDelta);
-                    PlayAnimation(StartAnim);
+                    // Transition from walk to run, or start running from idle
+                    Out.TransitionRequests.Add({ EPedAnimationTransition::Start, Out.MovementState, Out.YawDelta });
                 }
                 break;
                 
             case EPedMovementState::Sprinting:
-            {
                 // Always play sprint start animation
-                FAnimationData StartAnim = GetBestStartAnimation(CurrentMovementState, YawDelta);
-                PlayAnimation(StartAnim);
+                Out.TransitionRequests.Add({ EPedAnimationTransition::Start, Out.MovementState, Out.YawDelta });
                 break;
-            }
                 
             case EPedMovementState::Idle:
-            {
                 // Play stop animation based on previous movement
-                if (PreviousMovementState == EPedMovementState::Walking)
-                {
-                    FAnimationData StopAnim = GetBestStopAnimation(PreviousMovementState, ShouldUseLeftFootVariant());
-                    PlayAnimation(StopAnim);
-                }
-                else if (PreviousMovementState == EPedMovementState::Running)
+                if (PreviousMovementState == EPedMovementState::Walking ||
+                    PreviousMovementState == EPedMovementState::Running ||
+                    PreviousMovementState == EPedMovementState::Sprinting)
                 {
-                    FAnimationData StopAnim = GetBestStopAnimation(PreviousMovementState, ShouldUseLeftFootVariant());
-                    PlayAnimation(StopAnim);
-                }
-                else if (PreviousMovementState == EPedMovementState::Sprinting)
-                {
-                    FAnimationData StopAnim = GetBestStopAnimation(PreviousMovementState, ShouldUseLeftFootVariant());
-                    PlayAnimation(StopAnim);
+                    Out.TransitionRequests.Add({ EPedAnimationTransition::Stop, PreviousMovementState, 0.0f });
                 }
                 break;
-            }
                 
             case EPedMovementState::Turning:
-            {
                 // Play turn animation
-                FAnimationData TurnAnim = GetBestTurnAnimation(PreviousMovementState, YawDelta);
-                PlayAnimation(TurnAnim);
+                Out.TransitionRequests.Add({ EPedAnimationTransition::Turn, PreviousMovementState, Out.YawDelta });
                 break;
-            }
                 
             case EPedMovementState::Jumping:
-            {
                 // Play jump takeoff
-                FAnimationData JumpAnim = GetBestJumpAnimation(true, false, false, ShouldUseLeftFootVariant());
-                PlayAnimation(JumpAnim);
+                Out.TransitionRequests.Add({ EPedAnimationTransition::JumpTakeoff, Out.MovementState, 0.0f });
+                break;
+
+            default:
                 break;
-            }
         }
     }
     
     // Handle stance transitions
-    if (PreviousStanceState != CurrentStanceState)
+    if (PreviousStanceState != Out.StanceState)
     {
-        if (CurrentStanceState == EPedStanceState::Crouched && PreviousStanceState == EPedStanceState::Standing)
+        if (Out.StanceState == EPedStanceState::Crouched && PreviousStanceState == EPedStanceState::Standing)
         {
             // Transition to crouch
-            PlayAnimation(CrouchAnims.IdleToCrouch);
+            Out.TransitionRequests.Add({ EPedAnimationTransition::EnterCrouch, Out.MovementState, 0.0f });
         }
-        else if (CurrentStanceState == EPedStanceState::Standing && PreviousStanceState == EPedStanceState::Crouched)
+        else if (Out.StanceState == EPedStanceState::Standing && PreviousStanceState == EPedStanceState::Crouched)
         {
             // Transition from crouch
-            PlayAnimation(CrouchAnims.CrouchToIdle);
+            Out.TransitionRequests.Add({ EPedAnimationTransition::ExitCrouch, Out.MovementState, 0.0f });
         }
     }
 }
@@ -338,9 +338,90 @@ struct FVehicleAnimSet
     FAnimationData ShockRight; // shock_right.onim
 };
 
+/** Animation the thread-safe update asks the game thread to play; selection and playback happen there */
+enum class EPedAnimationTransition : uint8
+{
+    Start,
+    Stop,
+    Turn,
+    JumpTakeoff,
+    EnterCrouch,
+    ExitCrouch
+};
+
+struct FPedAnimationTransitionRequest
+{
+    EPedAnimationTransition Transition = EPedAnimationTransition::Start;
+
+    /** State the start or turn goes into, or the stop comes out of */
+    EPedMovementState MovementState = EPedMovementState::Idle;
+
+    float TurnAngle = 0.0f;
+};
+
+/**
+ * Everything the thread-safe update reads, gathered on the game thread by NativeUpdateAnimation so the
+ * worker never touches the character, its movement component, or properties the game thread writes
+ */
+struct FPedAnimationUpdateInputs
+{
+    FVector Velocity = FVector::ZeroVector;
+    FVector ActorForward = FVector::ForwardVector;
+    float ActorYaw = 0.0f;
+    bool bIsFalling = false;
+    bool bIsCrouching = false;
+    bool bIsAiming = false;
+
+    // State as the game thread last saw it; transitions are detected against these
+    EPedMovementState MovementState = EPedMovementState::Idle;
+    EPedStanceState StanceState = EPedStanceState::Standing;
+
+    /** Seconds since the previous state-machine run */
+    float StepTime = 0.0f;
+
+    /** Ease the published movement outputs in over StepTime instead of snapping (reduced update LOD) */
+    bool bInterpolate = false;
+
+    /** False on frames the update LOD skips; the thread-safe update then does nothing */
+    bool bRunStateMachine = false;
+};
+
+/**
+ * Written only by the thread-safe update and published to the controller's properties at the start of
+ * the next game-thread update. Its movement values double as the worker's previous-frame state.
+ */
+struct FPedAnimationUpdateOutputs
+{
+    FVector Velocity = FVector::ZeroVector;
+    float Speed = 0.0f;
+    float Direction = 0.0f;
+    float LeanAngle = 0.0f;
+    float TurnRate = 0.0f;
+    float YawDelta = 0.0f;
+    ETurnDirection TurnDirection = ETurnDirection::None;
+    bool bIsInAir = false;
+    bool bIsCrouching = false;
+    EPedMovementState MovementState = EPedMovementState::Idle;
+    EPedStanceState StanceState = EPedStanceState::Standing;
+
+    float StepTime = 0.0f;
+    bool bInterpolate = false;
+
+    /** At most one movement and one stance transition per update */
+    TArray<FPedAnimationTransitionRequest, TInlineAllocator<2>> TransitionRequests;
+
+    /** Set by the thread-safe update, cleared once published */
+    bool bHasResults = false;
+};
+
 /**
  * Pure C++ Animation Controller for Ped/Player characters
  * Handles all movement animations with smooth blending and cancellation support
+ *
+ * Threading: NativeUpdateAnimation (game thread) publishes the previous thread-safe update's results,
+ * plays the transitions it requested, and gathers FPedAnimationUpdateInputs. Movement, turn detection
+ * and state selection then run in NativeThreadSafeUpdateAnimation on an animation worker. State is
+ * therefore published one frame after the movement it reflects.
  */
 UCLASS(BlueprintType, Blueprintable)
 class GAME_API UPedAnimationController : public UAnimInstance
@@ -352,6 +433,8 @@ public:
 
     virtual void NativeInitializeAnimation() override;
     virtual void NativeUpdateAnimation(float DeltaTimeX) override;
+    virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+    virtual void NativeUninitializeAnimation() override;
 
     // Current State Variables (Public for Manager Access)
     UPROPERTY(BlueprintReadOnly, Category = "Animation State")
@@ -447,15 +530,32 @@ private:
     float BlendDuration;
     bool bIsBlending;
     
-    // Previous state for transitions
-    EPedMovementState PreviousMovementState;
-    EPedStanceState PreviousStanceState;
-    
-    // Turn detection
+    // Turn detection (PreviousYaw belongs to the thread-safe update)
     float PreviousYaw;
-    float YawDelta;
     float TurnThreshold;
 
+    // Game thread -> thread-safe update -> game thread
+    FPedAnimationUpdateInputs UpdateInputs;
+    FPedAnimationUpdateOutputs UpdateOutputs;
+
+    // Update LOD, driven by UPedAnimationLODSubsystem
+    EPedAnimationUpdateTier UpdateTier;
+    int32 LODUpdateInterval;
+    bool bLODManaged;
+    bool bFullUpdateGranted;
+    float PendingUpdateTime; // Seconds since the last full update
+    uint64 LastFullUpdateFrame;
+
+    // Movement outputs eased between full updates
+    float LODFromSpeed;
+    float LODToSpeed;
+    float LODFromDirection;
+    float LODDirectionDelta;
+    float LODFromLeanAngle;
+    float LODToLeanAngle;
+    float LODInterpTime;
+    float LODInterpDuration;
+
 public:
     // Animation Control Functions
     UFUNCTION(BlueprintCallable, Category = "Animation")
@@ -553,13 +653,31 @@ public:
     UFUNCTION(BlueprintCallable, Category = "State Management")
     void SetStanceState(EPedStanceState NewState);
 
+    // Update LOD
+    UFUNCTION(BlueprintCallable, Category = "Animation LOD")
+    EPedAnimationUpdateTier GetUpdateTier() const { return UpdateTier; }
+
+    /** GFrameCounter of the last full state-machine update; state consumers can skip frames without one */
+    uint64 GetLastFullUpdateFrame() const { return LastFullUpdateFrame; }
+
+    /** Managed controllers run their state machine only on frames UPedAnimationLODSubsystem grants */
+    void SetLODManaged(bool bManaged);
+    void SetUpdateTier(EPedAnimationUpdateTier Tier, int32 UpdateInterval);
+    void GrantFullUpdate() { bFullUpdateGranted = true; }
+
 private:
-    // Internal Update Functions
-    void UpdateMovementVariables();
-    void UpdateAnimationStates();
-    void HandleStateTransitions();
-    void HandleTurnDetection();
+    // Game-thread update
+    void GatherUpdateInputs(float StepTime);
+    void PublishUpdateOutputs();
+    void PlayTransition(const FPedAnimationTransitionRequest& Request);
     void UpdateBlending(float DeltaTime);
+    void UpdateInterpolatedOutputs(float DeltaTime);
+
+    // Thread-safe update; read only UpdateInputs and write only UpdateOutputs and PreviousYaw
+    void UpdateMovementVariables(const FPedAnimationUpdateInputs& In, FPedAnimationUpdateOutputs& Out) const;
+    void HandleTurnDetection(const FPedAnimationUpdateInputs& In, FPedAnimationUpdateOutputs& Out);
+    void UpdateAnimationStates(const FPedAnimationUpdateInputs& In, FPedAnimationUpdateOutputs& Out) const;
+    void HandleStateTransitions(const FPedAnimationUpdateInputs& In, FPedAnimationUpdateOutputs& Out) const;
 
     // Animation Helper Functions
     FAnimationData SelectRandomFromArray(const TArray<FAnimationData>& AnimArray) const;
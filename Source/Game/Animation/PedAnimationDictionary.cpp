@@ -6,6 +6,20 @@ UPedAnimationDictionary::UPedAnimationDictionary()
     // Constructor
 }
 
+void UPedAnimationDictionary::PostLoad()
+{
+    Super::PostLoad();
+    RebuildIndices();
+}
+
+#if WITH_EDITOR
+void UPedAnimationDictionary::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    RebuildIndices();
+}
+#endif
+
 void UPedAnimationDictionary::InitializeDefaultDictionaries()
 {
     UE_LOG(LogTemp, Log, TEXT("PedAnimationDictionary: Initializing default dictionaries..."));
@@ -51,6 +65,8 @@ void UPedAnimationDictionary::InitializeDefaultDictionaries()
     VehicleContext.AvailableDictionaries = {TEXT("vehicle_standard"), TEXT("vehicle_sports"), TEXT("vehicle_truck")};
     AnimationContexts.Add(VehicleContext);
 
+    RebuildIndices();
+
     UE_LOG(LogTemp, Log, TEXT("PedAnimationDictionary: Default dictionaries initialized successfully"));
 }
 
@@ -242,7 +258,8 @@ FAnimationEntry UPedAnimationDictionary::CreateEntry(const FString& AnimName, co
 
 bool UPedAnimationDictionary::SwapDictionary(const FString& ContextName, const FString& NewDictionaryName)
 {
-    FAnimationContext* Context = FindContext(ContextName);
+    const int32 ContextIndex = FindContextIndex(ContextName);
+    FAnimationContext* Context = ContextIndex != INDEX_NONE ? &AnimationContexts[ContextIndex] : nullptr;
     if (!Context)
     {
         UE_LOG(LogTemp, Error, TEXT("PedAnimationDictionary: Context '%s' not found"), *ContextName);
@@ -265,6 +282,7 @@ bool UPedAnimationDictionary::SwapDictionary(const FString& ContextName, const F
 
     FString OldDictionary = Context->CurrentDictionaryName;
     Context->CurrentDictionaryName = NewDictionaryName;
+    IndexContext(ContextIndex);
 
     UE_LOG(LogTemp, Log, TEXT("PedAnimationDictionary: Swapped context '%s' from '%s' to '%s'"), 
            *ContextName, *OldDictionary, *NewDictionaryName);
@@ -310,62 +328,14 @@ TArray<FString> UPedAnimationDictionary::GetAvailableDictionariesForContext(cons
 
 FString UPedAnimationDictionary::GetAnimationPath(const FString& ContextName, const FString& AnimationName)
 {
-    // Get current dictionary for context
-    FString DictionaryName = GetCurrentDictionaryForContext(ContextName);
-    if (DictionaryName.IsEmpty())
-    {
-        return TEXT("");
-    }
-
-    // Get dictionary
-    FAnimationDictionary Dictionary = GetDictionaryByName(DictionaryName);
-    if (Dictionary.DictionaryName.IsEmpty())
-    {
-        return TEXT("");
-    }
-
-    // Find animation entry
-    for (const FAnimationEntry& Entry : Dictionary.Animations)
-    {
-        if (Entry.AnimationName == AnimationName)
-        {
-            // Convert to UAsset path
-            FString FullPath = Dictionary.BaseFolderPath + TEXT("/") + Entry.FileName;
-            FullPath = FullPath.Replace(TEXT("Data/"), TEXT("/Game/Content/"));
-            FullPath = FullPath.Replace(TEXT(".onim"), TEXT(""));
-            return FullPath;
-        }
-    }
-
-    return TEXT("");
+    const FResolvedAnimationEntry Resolved = ResolveAnimation(FName(*ContextName, FNAME_Find), FName(*AnimationName, FNAME_Find));
+    return Resolved.IsValid() ? *Resolved.AssetPath : FString();
 }
 
 FAnimationEntry UPedAnimationDictionary::GetAnimationEntry(const FString& ContextName, const FString& AnimationName)
 {
-    // Get current dictionary for context
-    FString DictionaryName = GetCurrentDictionaryForContext(ContextName);
-    if (DictionaryName.IsEmpty())
-    {
-        return FAnimationEntry();
-    }
-
-    // Get dictionary
-    FAnimationDictionary Dictionary = GetDictionaryByName(DictionaryName);
-    if (Dictionary.DictionaryName.IsEmpty())
-    {
-        return FAnimationEntry();
-    }
-
-    // Find animation entry
-    for (const FAnimationEntry& Entry : Dictionary.Animations)
-    {
-        if (Entry.AnimationName == AnimationName)
-        {
-            return Entry;
-        }
-    }
-
-    return FAnimationEntry();
+    const FResolvedAnimationEntry Resolved = ResolveAnimation(FName(*ContextName, FNAME_Find), FName(*AnimationName, FNAME_Find));
+    return Resolved.IsValid() ? *Resolved.Entry : FAnimationEntry();
 }
 
 TArray<FString> UPedAnimationDictionary::GetAllAnimationNamesInContext(const FString& ContextName)
@@ -404,7 +374,19 @@ bool UPedAnimationDictionary::AddDictionary(const FAnimationDictionary& NewDicti
         return false;
     }
 
-    AllDictionaries.Add(NewDictionary);
+    const int32 DictionaryIndex = AllDictionaries.Add(NewDictionary);
+    DictionaryEntryIndices.SetNum(AllDictionaries.Num());
+    IndexDictionary(DictionaryIndex);
+
+    // Contexts may already name the new dictionary as current
+    for (int32 ContextIndex = 0; ContextIndex < ContextDictionaries.Num(); ContextIndex++)
+    {
+        if (ContextDictionaries[ContextIndex] == INDEX_NONE)
+        {
+            IndexContext(ContextIndex);
+        }
+    }
+
     UE_LOG(LogTemp, Log, TEXT("PedAnimationDictionary: Added dictionary '%s'"), *NewDictionary.DictionaryName);
     return true;
 }
@@ -416,6 +398,9 @@ bool UPedAnimationDictionary::RemoveDictionary(const FString& DictionaryName)
         if (AllDictionaries[i].DictionaryName == DictionaryName)
         {
             AllDictionaries.RemoveAt(i);
+
+            // Every later dictionary shifts down, so re-index from scratch
+            RebuildIndices();
             UE_LOG(LogTemp, Log, TEXT("PedAnimationDictionary: Removed dictionary '%s'"), *DictionaryName);
             return true;
         }
@@ -434,7 +419,9 @@ bool UPedAnimationDictionary::AddContext(const FAnimationContext& NewContext)
         return false;
     }
 
-    AnimationContexts.Add(NewContext);
+    const int32 ContextIndex = AnimationContexts.Add(NewContext);
+    ContextDictionaries.SetNum(AnimationContexts.Num());
+    IndexContext(ContextIndex);
     UE_LOG(LogTemp, Log, TEXT("PedAnimationDictionary: Added context '%s'"), *NewContext.ContextName);
     return true;
 }
@@ -461,26 +448,132 @@ TArray<FString> UPedAnimationDictionary::GetAllDictionaryNames()
 
 FAnimationContext* UPedAnimationDictionary::FindContext(const FString& ContextName)
 {
-    for (FAnimationContext& Context : AnimationContexts)
+    const int32 ContextIndex = FindContextIndex(ContextName);
+    return ContextIndex != INDEX_NONE ? &AnimationContexts[ContextIndex] : nullptr;
+}
+
+FAnimationDictionary* UPedAnimationDictionary::FindDictionary(const FString& DictionaryName)
+{
+    const int32 DictionaryIndex = FindDictionaryIndex(DictionaryName);
+    return DictionaryIndex != INDEX_NONE ? &AllDictionaries[DictionaryIndex] : nullptr;
+}
+
+// ============ LOOKUP INDICES ============
+
+void UPedAnimationDictionary::RebuildIndices()
+{
+    DictionaryIndices.Reset();
+    DictionaryEntryIndices.Reset();
+    DictionaryEntryIndices.SetNum(AllDictionaries.Num());
+    for (int32 DictionaryIndex = 0; DictionaryIndex < AllDictionaries.Num(); DictionaryIndex++)
     {
-        if (Context.ContextName == ContextName)
-        {
-            return &Context;
-        }
+        IndexDictionary(DictionaryIndex);
+    }
+
+    ContextIndices.Reset();
+    ContextDictionaries.Reset();
+    ContextDictionaries.SetNum(AnimationContexts.Num());
+    for (int32 ContextIndex = 0; ContextIndex < AnimationContexts.Num(); ContextIndex++)
+    {
+        IndexContext(ContextIndex);
     }
-    return nullptr;
 }
 
-FAnimationDictionary* UPedAnimationDictionary::FindDictionary(const FString& DictionaryName)
+void UPedAnimationDictionary::IndexDictionary(int32 DictionaryIndex)
 {
-    for (FAnimationDictionary& Dictionary : AllDictionaries)
+    const FAnimationDictionary& Dictionary = AllDictionaries[DictionaryIndex];
+    FDictionaryIndex& Index = DictionaryEntryIndices[DictionaryIndex];
+    Index.Name = FName(*Dictionary.DictionaryName);
+    DictionaryIndices.FindOrAdd(Index.Name, DictionaryIndex);
+
+    Index.Entries.Reset();
+    Index.Entries.Reserve(Dictionary.Animations.Num());
+    Index.AssetPaths.Reset(Dictionary.Animations.Num());
+
+    for (int32 EntryIndex = 0; EntryIndex < Dictionary.Animations.Num(); EntryIndex++)
     {
-        if (Dictionary.DictionaryName == DictionaryName)
-        {
-            return &Dictionary;
-        }
+        // First entry of a name wins, as with the linear search this replaces
+        const FAnimationEntry& Entry = Dictionary.Animations[EntryIndex];
+        Index.Entries.FindOrAdd(FName(*Entry.AnimationName), EntryIndex);
+        Index.AssetPaths.Add(MakeAssetPath(Dictionary, Entry));
     }
-    return nullptr;
+}
+
+void UPedAnimationDictionary::IndexContext(int32 ContextIndex)
+{
+    const FAnimationContext& Context = AnimationContexts[ContextIndex];
+    ContextIndices.FindOrAdd(FName(*Context.ContextName), ContextIndex);
+
+    const int32* DictionaryIndex = DictionaryIndices.Find(FName(*Context.CurrentDictionaryName, FNAME_Find));
+    ContextDictionaries[ContextIndex] = DictionaryIndex ? *DictionaryIndex : INDEX_NONE;
+}
+
+int32 UPedAnimationDictionary::FindContextIndex(const FString& ContextName) const
+{
+    // FNAME_Find: a name never created cannot be a key, and the lookup should not add it
+    const int32* ContextIndex = ContextIndices.Find(FName(*ContextName, FNAME_Find));
+    return ContextIndex && AnimationContexts.IsValidIndex(*ContextIndex) ? *ContextIndex : INDEX_NONE;
+}
+
+int32 UPedAnimationDictionary::FindDictionaryIndex(const FString& DictionaryName) const
+{
+    const int32* DictionaryIndex = DictionaryIndices.Find(FName(*DictionaryName, FNAME_Find));
+    return DictionaryIndex && AllDictionaries.IsValidIndex(*DictionaryIndex) ? *DictionaryIndex : INDEX_NONE;
+}
+
+FResolvedAnimationEntry UPedAnimationDictionary::ResolveAnimation(FName ContextName, FName AnimationName) const
+{
+    FResolvedAnimationEntry Resolved;
+
+    const int32* ContextIndex = ContextIndices.Find(ContextName);
+    if (!ContextIndex || !ContextDictionaries.IsValidIndex(*ContextIndex))
+    {
+        return Resolved;
+    }
+
+    const int32 DictionaryIndex = ContextDictionaries[*ContextIndex];
+    if (!DictionaryEntryIndices.IsValidIndex(DictionaryIndex))
+    {
+        return Resolved;
+    }
+
+    const FDictionaryIndex& Index = DictionaryEntryIndices[DictionaryIndex];
+    const int32* EntryIndex = Index.Entries.Find(AnimationName);
+    if (!EntryIndex || !AllDictionaries[DictionaryIndex].Animations.IsValidIndex(*EntryIndex))
+    {
+        return Resolved;
+    }
+
+    Resolved.Entry = &AllDictionaries[DictionaryIndex].Animations[*EntryIndex];
+    Resolved.AssetPath = &Index.AssetPaths[*EntryIndex];
+    Resolved.DictionaryName = Index.Name;
+    return Resolved;
+}
+
+bool UPedAnimationDictionary::GetDictionaryClipPaths(FName DictionaryName, TArray<TPair<FName, FString>>& OutClipPaths) const
+{
+    const int32* DictionaryIndex = DictionaryIndices.Find(DictionaryName);
+    if (!DictionaryIndex || !DictionaryEntryIndices.IsValidIndex(*DictionaryIndex))
+    {
+        return false;
+    }
+
+    const FDictionaryIndex& Index = DictionaryEntryIndices[*DictionaryIndex];
+    OutClipPaths.Reserve(OutClipPaths.Num() + Index.Entries.Num());
+    for (const TPair<FName, int32>& Entry : Index.Entries)
+    {
+        OutClipPaths.Emplace(Entry.Key, Index.AssetPaths[Entry.Value]);
+    }
+    return true;
+}
+
+FString UPedAnimationDictionary::MakeAssetPath(const FAnimationDictionary& Dictionary, const FAnimationEntry& Entry)
+{
+    // Convert to UAsset path
+    FString FullPath = Dictionary.BaseFolderPath + TEXT("/") + Entry.FileName;
+    FullPath = FullPath.Replace(TEXT("Data/"), TEXT("/Game/Content/"));
+    FullPath = FullPath.Replace(TEXT(".onim"), TEXT(""));
+    return FullPath;
 }
 
 // ============ VALIDATION SYSTEM IMPLEMENTATION ============
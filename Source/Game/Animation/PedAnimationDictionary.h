@@ -111,6 +111,23 @@ struct FAnimationContext
     }
 };
 
+/**
+ * Result of resolving an animation through a context's current dictionary. Both pointers are owned by
+ * the UPedAnimationDictionary and stay valid until its dictionaries or contexts next change.
+ */
+struct FResolvedAnimationEntry
+{
+    const FAnimationEntry* Entry = nullptr;
+
+    /** Full asset path, e.g. "/Game/Content/Animations/move_player/walk" */
+    const FString* AssetPath = nullptr;
+
+    /** Dictionary the context resolved to, e.g. for keying shared clip caches */
+    FName DictionaryName;
+
+    bool IsValid() const { return Entry != nullptr; }
+};
+
 /**
  * Dynamic Animation Dictionary Manager
  * Handles swapping of animation sets at runtime
@@ -123,12 +140,18 @@ class GAME_API UPedAnimationDictionary : public UPrimaryDataAsset
 public:
     UPedAnimationDictionary();
 
+    virtual void PostLoad() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
     // Dictionary Storage
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dictionaries")
+    // Read-only to Blueprint so every change goes through the mutators below and keeps the indices in step
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dictionaries")
     TArray<FAnimationDictionary> AllDictionaries;
 
     // Animation Contexts
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Contexts")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Contexts")
     TArray<FAnimationContext> AnimationContexts;
 
     // Dictionary Management
@@ -157,6 +180,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Animation Resolution")
     TArray<FString> GetAllAnimationNamesInContext(const FString& ContextName);
 
+    /** Hashed context -> dictionary -> entry lookup with the asset path pre-built; the per-ped hot path */
+    FResolvedAnimationEntry ResolveAnimation(FName ContextName, FName AnimationName) const;
+
+    /**
+     * Rebuild every lookup index from AllDictionaries and AnimationContexts. Called on load, after editor
+     * changes and by every function here that changes them; C++ that edits either array directly must call it.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Animation Resolution")
+    void RebuildIndices();
+
+    /** Every entry name of a dictionary with its asset path; false if there is no such dictionary */
+    bool GetDictionaryClipPaths(FName DictionaryName, TArray<TPair<FName, FString>>& OutClipPaths) const;
+
     // Utility Functions
     UFUNCTION(BlueprintCallable, Category = "Dictionary Utility")
     bool AddDictionary(const FAnimationDictionary& NewDictionary);
@@ -214,6 +250,26 @@ public:
     TArray<FString> GetOptionalClipsForDictionary(const FString& DictionaryName);
 
 private:
+    /** Entry lookup for one dictionary, parallel to AllDictionaries */
+    struct FDictionaryIndex
+    {
+        FName Name;
+        TMap<FName, int32> Entries;
+        TArray<FString> AssetPaths; // Parallel to FAnimationDictionary::Animations
+    };
+
+    // Lookup indices, never serialized
+    TMap<FName, int32> ContextIndices;
+    TMap<FName, int32> DictionaryIndices;
+    TArray<int32> ContextDictionaries; // Current dictionary per context, INDEX_NONE if it does not exist
+    TArray<FDictionaryIndex> DictionaryEntryIndices;
+
+    void IndexDictionary(int32 DictionaryIndex);
+    void IndexContext(int32 ContextIndex);
+    int32 FindContextIndex(const FString& ContextName) const;
+    int32 FindDictionaryIndex(const FString& DictionaryName) const;
+    static FString MakeAssetPath(const FAnimationDictionary& Dictionary, const FAnimationEntry& Entry);
+
     // Internal helper functions
     FAnimationContext* FindContext(const FString& ContextName);
     FAnimationDictionary* FindDictionary(const FString& DictionaryName);
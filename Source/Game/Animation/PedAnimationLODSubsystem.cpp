@@ -0,0 +1,255 @@
+#include "PedAnimationLODSubsystem.h"
+#include "PedAnimationController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+UPedAnimationLODSubsystem::UPedAnimationLODSubsystem()
+{
+    FullTierDistance = 1500.0f;
+    ReducedTierDistance = 5000.0f;
+    ReducedUpdateInterval = 3;
+    MinimalUpdateInterval = 10;
+    MaxFullUpdatesPerFrame = 32;
+    OffScreenGraceSeconds = 0.2f;
+    StatsLogInterval = 0.0f;
+    TimeSinceStatsLog = 0.0f;
+}
+
+UPedAnimationLODSubsystem* UPedAnimationLODSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UPedAnimationLODSubsystem>() : nullptr;
+}
+
+bool UPedAnimationLODSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    // Editor and preview worlds never tick this, so their controllers must not wait on grants
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPedAnimationLODSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    LastFrameStats = FPedAnimationLODStats();
+    DueEntries.Reset();
+    GatherViewLocations();
+
+    for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+    {
+        if (!Entries[Index].Controller.IsValid())
+        {
+            Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        }
+    }
+
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        FControllerEntry& Entry = Entries[Index];
+        UPedAnimationController* Controller = Entry.Controller.Get();
+
+        Entry.Tier = ComputeTier(*Controller, Entry.bPlayerControlled);
+        Entry.FramesSinceUpdate++;
+
+        const int32 UpdateInterval = GetUpdateInterval(Entry.Tier);
+        Controller->SetUpdateTier(Entry.Tier, UpdateInterval);
+
+        switch (Entry.Tier)
+        {
+            case EPedAnimationUpdateTier::Full:
+                LastFrameStats.FullTierCount++;
+                break;
+            case EPedAnimationUpdateTier::Reduced:
+                LastFrameStats.ReducedTierCount++;
+                break;
+            default:
+                LastFrameStats.MinimalTierCount++;
+                break;
+        }
+
+        if (Entry.bPlayerControlled)
+        {
+            Controller->GrantFullUpdate();
+            Entry.FramesSinceUpdate = 0;
+            LastFrameStats.GrantedUpdates++;
+        }
+        else if (Entry.FramesSinceUpdate >= UpdateInterval)
+        {
+            DueEntries.Add(Index);
+        }
+    }
+
+    // Most overdue relative to its own interval first. A deferred ped's ratio keeps growing while freshly
+    // due ones sit at 1, so every tier gets its turn even when Full-tier peds alone exceed the budget;
+    // equal ratios go to the more significant tier
+    DueEntries.Sort([this](int32 A, int32 B)
+    {
+        const FControllerEntry& EntryA = Entries[A];
+        const FControllerEntry& EntryB = Entries[B];
+        const float OverdueA = (float)EntryA.FramesSinceUpdate / GetUpdateInterval(EntryA.Tier);
+        const float OverdueB = (float)EntryB.FramesSinceUpdate / GetUpdateInterval(EntryB.Tier);
+        if (OverdueA != OverdueB)
+        {
+            return OverdueA > OverdueB;
+        }
+        return EntryA.Tier < EntryB.Tier;
+    });
+
+    const int32 NumGranted = FMath::Min(DueEntries.Num(), FMath::Max(MaxFullUpdatesPerFrame, 1));
+    for (int32 DueIndex = 0; DueIndex < NumGranted; ++DueIndex)
+    {
+        FControllerEntry& Entry = Entries[DueEntries[DueIndex]];
+        Entry.Controller->GrantFullUpdate();
+        Entry.FramesSinceUpdate = 0;
+    }
+    LastFrameStats.GrantedUpdates += NumGranted;
+    LastFrameStats.DeferredUpdates = DueEntries.Num() - NumGranted;
+
+    if (StatsLogInterval > 0.0f)
+    {
+        TimeSinceStatsLog += DeltaTime;
+        if (TimeSinceStatsLog >= StatsLogInterval)
+        {
+            TimeSinceStatsLog = 0.0f;
+            UE_LOG(LogTemp, Display, TEXT("PedAnimationLODSubsystem: %d full, %d reduced, %d minimal; %d updates granted, %d deferred"),
+                   LastFrameStats.FullTierCount, LastFrameStats.ReducedTierCount, LastFrameStats.MinimalTierCount,
+                   LastFrameStats.GrantedUpdates, LastFrameStats.DeferredUpdates);
+        }
+    }
+}
+
+TStatId UPedAnimationLODSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UPedAnimationLODSubsystem, STATGROUP_Tickables);
+}
+
+// === Registration ===
+
+void UPedAnimationLODSubsystem::RegisterController(UPedAnimationController* Controller)
+{
+    if (!Controller)
+    {
+        return;
+    }
+
+    // Controllers re-initialize when their mesh is re-initialized; keep a single entry
+    for (const FControllerEntry& Entry : Entries)
+    {
+        if (Entry.Controller.Get() == Controller)
+        {
+            return;
+        }
+    }
+
+    FControllerEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.Controller = Controller;
+    Controller->SetLODManaged(true);
+}
+
+void UPedAnimationLODSubsystem::UnregisterController(UPedAnimationController* Controller)
+{
+    const int32 Index = Entries.IndexOfByPredicate([Controller](const FControllerEntry& Entry) { return Entry.Controller.Get() == Controller; });
+    if (Index != INDEX_NONE)
+    {
+        Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+
+    if (Controller)
+    {
+        Controller->SetLODManaged(false);
+    }
+}
+
+// === Stats ===
+
+int32 UPedAnimationLODSubsystem::GetTierCount(EPedAnimationUpdateTier Tier) const
+{
+    switch (Tier)
+    {
+        case EPedAnimationUpdateTier::Full:
+            return LastFrameStats.FullTierCount;
+        case EPedAnimationUpdateTier::Reduced:
+            return LastFrameStats.ReducedTierCount;
+        default:
+            return LastFrameStats.MinimalTierCount;
+    }
+}
+
+// === Significance ===
+
+void UPedAnimationLODSubsystem::GatherViewLocations()
+{
+    ViewLocations.Reset();
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (PlayerController && PlayerController->IsLocalController())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            ViewLocations.Add(ViewLocation);
+        }
+    }
+}
+
+EPedAnimationUpdateTier UPedAnimationLODSubsystem::ComputeTier(const UPedAnimationController& Controller, bool& bOutPlayerControlled) const
+{
+    const APawn* Pawn = Cast<APawn>(Controller.GetOwningActor());
+    bOutPlayerControlled = Pawn && Pawn->IsPlayerControlled();
+    if (bOutPlayerControlled)
+    {
+        return EPedAnimationUpdateTier::Full;
+    }
+
+    // Without a local view (e.g. a dedicated server) there is nothing to rank by; the budget still applies
+    if (ViewLocations.Num() == 0)
+    {
+        return EPedAnimationUpdateTier::Full;
+    }
+
+    const USkeletalMeshComponent* Mesh = Controller.GetSkelMeshComponent();
+    if (!Mesh || !Mesh->WasRecentlyRendered(OffScreenGraceSeconds))
+    {
+        return EPedAnimationUpdateTier::Minimal;
+    }
+
+    const FVector Location = Mesh->GetComponentLocation();
+    float MinDistanceSquared = TNumericLimits<float>::Max();
+    for (const FVector& ViewLocation : ViewLocations)
+    {
+        MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(Location, ViewLocation)));
+    }
+
+    if (MinDistanceSquared <= FMath::Square(FullTierDistance))
+    {
+        return EPedAnimationUpdateTier::Full;
+    }
+    if (MinDistanceSquared <= FMath::Square(ReducedTierDistance))
+    {
+        return EPedAnimationUpdateTier::Reduced;
+    }
+    return EPedAnimationUpdateTier::Minimal;
+}
+
+int32 UPedAnimationLODSubsystem::GetUpdateInterval(EPedAnimationUpdateTier Tier) const
+{
+    switch (Tier)
+    {
+        case EPedAnimationUpdateTier::Full:
+            return 1;
+        case EPedAnimationUpdateTier::Reduced:
+            return FMath::Max(ReducedUpdateInterval, 1);
+        default:
+            return FMath::Max(MinimalUpdateInterval, 1);
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "../Core/Enums/GameWorldEnums.h"
+#include "PedAnimationLODSubsystem.generated.h"
+
+class UPedAnimationController;
+
+/** Per-frame update LOD counts, for profiling and debug display */
+USTRUCT(BlueprintType)
+struct FPedAnimationLODStats
+{
+    GENERATED_BODY()
+
+    /** Registered controllers in each tier */
+    UPROPERTY(BlueprintReadOnly, Category = "Animation LOD")
+    int32 FullTierCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Animation LOD")
+    int32 ReducedTierCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Animation LOD")
+    int32 MinimalTierCount = 0;
+
+    /** Controllers granted a full state-machine update for the next frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Animation LOD")
+    int32 GrantedUpdates = 0;
+
+    /** Controllers that were due an update but fell outside the frame budget */
+    UPROPERTY(BlueprintReadOnly, Category = "Animation LOD")
+    int32 DeferredUpdates = 0;
+};
+
+/**
+ * Ped Animation LOD Subsystem
+ * Significance-based update rate for UPedAnimationController. Each frame it ranks every registered
+ * controller by distance to the nearest local player's view and whether its mesh was recently
+ * rendered, and assigns it a tier:
+ *  - Full: player-controlled, or on screen within FullTierDistance; updates every frame
+ *  - Reduced: on screen within ReducedTierDistance; updates every ReducedUpdateInterval frames
+ *  - Minimal: anything else; updates every MinimalUpdateInterval frames
+ *
+ * Of the controllers due an update, at most MaxFullUpdatesPerFrame are granted one for the next
+ * frame, ranked by how overdue each is relative to its tier's interval (ties to the more significant
+ * tier), so a budget saturated by Full-tier peds delays Reduced and Minimal ones rather than starving
+ * them. Between grants a controller only advances its blend and interpolates its movement outputs,
+ * so distant peds stay smooth at a fraction of the cost. Player-controlled peds are always granted.
+ * Game and PIE worlds only; controllers in other worlds are never registered and update every frame.
+ */
+UCLASS(Config=Game)
+class GAME_API UPedAnimationLODSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UPedAnimationLODSubsystem();
+
+    /** Subsystem of the object's world, nullptr if it has none */
+    static UPedAnimationLODSubsystem* Get(const UObject* WorldContextObject);
+
+    // UWorldSubsystem interface
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // UTickableWorldSubsystem interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // === Registration ===
+
+    void RegisterController(UPedAnimationController* Controller);
+    void UnregisterController(UPedAnimationController* Controller);
+
+    int32 GetNumControllers() const { return Entries.Num(); }
+
+    // === Stats ===
+
+    UFUNCTION(BlueprintCallable, Category = "Animation LOD")
+    FPedAnimationLODStats GetLastFrameStats() const { return LastFrameStats; }
+
+    UFUNCTION(BlueprintCallable, Category = "Animation LOD")
+    int32 GetTierCount(EPedAnimationUpdateTier Tier) const;
+
+    // === Settings ===
+
+    /** On-screen controllers nearer than this (cm) update every frame */
+    UPROPERTY(EditAnywhere, Config, Category = "Animation LOD")
+    float FullTierDistance;
+
+    /** On-screen controllers nearer than this (cm) use the Reduced tier, farther ones Minimal */
+    UPROPERTY(EditAnywhere, Config, Category = "Animation LOD")
+    float ReducedTierDistance;
+
+    UPROPERTY(EditAnywhere, Config, Category = "Animation LOD", meta = (ClampMin = "1"))
+    int32 ReducedUpdateInterval;
+
+    UPROPERTY(EditAnywhere, Config, Category = "Animation LOD", meta = (ClampMin = "1"))
+    int32 MinimalUpdateInterval;
+
+    /** Full state-machine updates granted per frame across every ped; player-controlled peds are exempt */
+    UPROPERTY(EditAnywhere, Config, Category = "Animation LOD", meta = (ClampMin = "1"))
+    int32 MaxFullUpdatesPerFrame;
+
+    /** A mesh not rendered within this many seconds counts as off screen */
+    UPROPERTY(EditAnywhere, Config, Category = "Animation LOD")
+    float OffScreenGraceSeconds;
+
+    /** Seconds between per-tier count logs; 0 disables them */
+    UPROPERTY(EditAnywhere, Config, Category = "Animation LOD")
+    float StatsLogInterval;
+
+private:
+    struct FControllerEntry
+    {
+        TWeakObjectPtr<UPedAnimationController> Controller;
+        EPedAnimationUpdateTier Tier = EPedAnimationUpdateTier::Full;
+        int32 FramesSinceUpdate = 0;
+        bool bPlayerControlled = false;
+    };
+
+    TArray<FControllerEntry> Entries;
+
+    // Per-frame scratch, reused to avoid allocation
+    TArray<FVector> ViewLocations;
+    TArray<int32> DueEntries;
+
+    FPedAnimationLODStats LastFrameStats;
+    float TimeSinceStatsLog;
+
+    void GatherViewLocations();
+    EPedAnimationUpdateTier ComputeTier(const UPedAnimationController& Controller, bool& bOutPlayerControlled) const;
+    int32 GetUpdateInterval(EPedAnimationUpdateTier Tier) const;
+};
@@ -1,4 +1,5 @@
 #include "PedAnimationManager.h"
+#include "PedAnimationClipCache.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/Engine.h"
@@ -27,12 +28,14 @@ UPedAnimationManager::UPedAnimationManager()
     SmoothedDirection = 0.0f;
     TimeSinceLastStateChange = 0.0f;
     TimeSinceLastAnimation = 0.0f;
+    LastSeenControllerUpdateFrame = 0;
 
     AnimationController = nullptr;
     OwnerCharacter = nullptr;
     AnimationAssetLoader = nullptr;
     AnimationDictionary = nullptr;
     AnimationGroupsLoader = nullptr;
+    ClipCache = nullptr;
     AnimationGroupsXMLPath = TEXT("Data/Animations/AnimationGroups.xml");
 }
 
@@ -58,6 +61,8 @@ void UPedAnimationManager::BeginPlay()
         }
     }
 
+    ClipCache = UPedAnimationClipCache::Get(this);
+
     // Initialize animation system
     InitializeAnimationSystem();
 
@@ -65,6 +70,13 @@ void UPedAnimationManager::BeginPlay()
            *OwnerCharacter->GetName());
 }
 
+void UPedAnimationManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ReleaseAllDictionaries();
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void UPedAnimationManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -85,6 +97,17 @@ void UPedAnimationManager::TickComponent(float DeltaTime, ELevelTick TickType, F
     // Update movement detection
     UpdateMovementDetection();
 
+    // Under update LOD the controller's state only moves on its full updates; wait for the next one
+    if (AnimationController)
+    {
+        const uint64 ControllerUpdateFrame = AnimationController->GetLastFullUpdateFrame();
+        if (ControllerUpdateFrame == LastSeenControllerUpdateFrame)
+        {
+            return;
+        }
+        LastSeenControllerUpdateFrame = ControllerUpdateFrame;
+    }
+
     // Check for state changes
     CheckForStateChanges();
 
@@ -361,60 +384,79 @@ void UPedAnimationManager::PlayAnimationByName(const FString& AnimationName, boo
     }
 
     // Determine context based on current animation region
+    static const FName OnFootContext(TEXT("OnFoot"));
+    static const FName CrouchContext(TEXT("Crouch"));
+    static const FName JumpContext(TEXT("Jump"));
+    static const FName CombatContext(TEXT("Combat"));
+    static const FName CoverContext(TEXT("Cover"));
+    static const FName InVehicleContext(TEXT("InVehicle"));
+    static const FName InteractionContext(TEXT("Interaction"));
+
     EPedAnimationRegion CurrentRegion = AnimationController->DetermineAnimationRegion();
-    FString ContextName;
+    FName ContextName;
 
     switch (CurrentRegion)
     {
         case EPedAnimationRegion::OnFoot:
-            ContextName = TEXT("OnFoot");
+            ContextName = OnFootContext;
             break;
         case EPedAnimationRegion::Crouch:
-            ContextName = TEXT("Crouch");
+            ContextName = CrouchContext;
             break;
         case EPedAnimationRegion::Jump:
-            ContextName = TEXT("Jump");
+            ContextName = JumpContext;
             break;
         case EPedAnimationRegion::Combat:
-            ContextName = TEXT("Combat");
+            ContextName = CombatContext;
             break;
         case EPedAnimationRegion::Cover:
-            ContextName = TEXT("Cover");
+            ContextName = CoverContext;
             break;
         case EPedAnimationRegion::InVehicle:
-            ContextName = TEXT("InVehicle");
+            ContextName = InVehicleContext;
             break;
         case EPedAnimationRegion::Interaction:
-            ContextName = TEXT("Interaction");
+            ContextName = InteractionContext;
             break;
         case EPedAnimationRegion::Emote:
-            ContextName = TEXT("Interaction"); // Emotes use interaction context
+            ContextName = InteractionContext; // Emotes use interaction context
             break;
         default:
-            ContextName = TEXT("OnFoot"); // Fallback
+            ContextName = OnFootContext; // Fallback
             break;
     }
 
-    // Get animation entry from dictionary
-    FAnimationEntry AnimEntry = AnimationDictionary->GetAnimationEntry(ContextName, AnimationName);
-    if (AnimEntry.AnimationName.IsEmpty())
+    // Entry and pre-built asset path in one hashed lookup
+    const FName AnimationKey(*AnimationName, FNAME_Find);
+    const FResolvedAnimationEntry Resolved = AnimationDictionary->ResolveAnimation(ContextName, AnimationKey);
+
+    // Region changes made directly on the controller are picked up here
+    if (ContextName != CurrentRegionContext)
+    {
+        EnterRegionContext(ContextName.ToString());
+    }
+
+    if (!Resolved.IsValid())
     {
         UE_LOG(LogTemp, Warning, TEXT("PedAnimationManager: Animation '%s' not found in region '%s' (context: %s)"), 
-               *AnimationName, *UEnum::GetValueAsString(CurrentRegion), *ContextName);
+               *AnimationName, *UEnum::GetValueAsString(CurrentRegion), *ContextName.ToString());
         return;
     }
 
-    // Get full path
-    FString AnimationPath = AnimationDictionary->GetAnimationPath(ContextName, AnimationName);
-    if (AnimationPath.IsEmpty())
+    const FAnimationEntry& AnimEntry = *Resolved.Entry;
+    const FString& AnimationPath = *Resolved.AssetPath;
+
+    // Shared resolved clip; only a clip whose dictionary has not finished streaming in loads here
+    UAnimSequence* AnimAsset = nullptr;
+    if (!ClipCache || !ClipCache->FindClip(Resolved.DictionaryName, AnimationKey, AnimAsset))
     {
-        UE_LOG(LogTemp, Error, TEXT("PedAnimationManager: Failed to resolve path for animation '%s' in region '%s'"), 
-               *AnimationName, *UEnum::GetValueAsString(CurrentRegion));
-        return;
+        AnimAsset = LoadObject<UAnimSequence>(nullptr, *AnimationPath);
+        if (ClipCache)
+        {
+            ClipCache->AddClip(Resolved.DictionaryName, AnimationKey, AnimAsset);
+        }
     }
 
-    // Load animation asset
-    UAnimSequence* AnimAsset = LoadObject<UAnimSequence>(nullptr, *AnimationPath);
     if (!AnimAsset)
     {
         UE_LOG(LogTemp, Error, TEXT("PedAnimationManager: Failed to load animation asset from '%s'"), *AnimationPath);
@@ -434,7 +476,7 @@ void UPedAnimationManager::PlayAnimationByName(const FString& AnimationName, boo
     AnimationController->PlayAnimation(AnimData, bForcePlay);
 
     UE_LOG(LogTemp, Log, TEXT("PedAnimationManager: Playing animation '%s' from region '%s' (context: %s, path: %s)"), 
-           *AnimationName, *UEnum::GetValueAsString(CurrentRegion), *ContextName, *AnimationPath);
+           *AnimationName, *UEnum::GetValueAsString(CurrentRegion), *ContextName.ToString(), *AnimationPath);
 }
 
 void UPedAnimationManager::StopCurrentAnimation()
@@ -568,6 +610,9 @@ bool UPedAnimationManager::SwapAnimationDictionary(const FString& ContextName, c
     {
         UE_LOG(LogTemp, Log, TEXT("PedAnimationManager: Successfully swapped '%s' context to dictionary '%s'"), 
                *ContextName, *NewDictionaryName);
+
+        // The swap may have fallen back to another dictionary; move to whichever is current
+        RefreshContextDictionary(ContextName);
                
         // Get validation report for logging
         FString ValidationReport;
@@ -681,9 +726,112 @@ void UPedAnimationManager::SetupDictionariesFromXML()
     // Setup contexts from loaded groups
     AnimationGroupsLoader->SetupContextsFromGroups(AnimationDictionary);
 
+    // Locomotion is in use all the time; other regions are held while the ped is in them
+    HoldContextDictionary(TEXT("OnFoot"));
+    HoldContextDictionary(TEXT("Crouch"));
+    HoldContextDictionary(TEXT("Jump"));
+
     UE_LOG(LogTemp, Log, TEXT("PedAnimationManager: Animation dictionaries and contexts setup from XML"));
 }
 
+void UPedAnimationManager::HoldContextDictionary(const FString& ContextName)
+{
+    if (!ClipCache)
+    {
+        ClipCache = UPedAnimationClipCache::Get(this);
+    }
+
+    if (!ClipCache || !AnimationDictionary)
+    {
+        return;
+    }
+
+    const FName ContextKey(*ContextName);
+    const FName DictionaryName(*AnimationDictionary->GetCurrentDictionaryForContext(ContextName), FNAME_Find);
+    const FName* HeldDictionary = HeldDictionaries.Find(ContextKey);
+    if (HeldDictionary && *HeldDictionary == DictionaryName)
+    {
+        return;
+    }
+
+    // Acquire before releasing so a dictionary shared by both is never briefly unheld
+    if (!DictionaryName.IsNone())
+    {
+        ClipCache->AcquireDictionary(*AnimationDictionary, DictionaryName);
+    }
+    if (HeldDictionary)
+    {
+        ClipCache->ReleaseDictionary(*HeldDictionary);
+    }
+
+    if (DictionaryName.IsNone())
+    {
+        HeldDictionaries.Remove(ContextKey);
+    }
+    else
+    {
+        HeldDictionaries.Add(ContextKey, DictionaryName);
+    }
+}
+
+void UPedAnimationManager::ReleaseContextDictionary(const FString& ContextName)
+{
+    FName HeldDictionary;
+    if (HeldDictionaries.RemoveAndCopyValue(FName(*ContextName, FNAME_Find), HeldDictionary) && ClipCache)
+    {
+        ClipCache->ReleaseDictionary(HeldDictionary);
+    }
+}
+
+void UPedAnimationManager::RefreshContextDictionary(const FString& ContextName)
+{
+    if (HeldDictionaries.Contains(FName(*ContextName, FNAME_Find)))
+    {
+        HoldContextDictionary(ContextName);
+    }
+    else if (ClipCache && AnimationDictionary)
+    {
+        // Not in use by this ped yet; warm it without holding it
+        const FString DictionaryName = AnimationDictionary->GetCurrentDictionaryForContext(ContextName);
+        ClipCache->PreloadDictionary(*AnimationDictionary, FName(*DictionaryName, FNAME_Find));
+    }
+}
+
+void UPedAnimationManager::EnterRegionContext(const FString& ContextName)
+{
+    // Locomotion contexts are held for the ped's lifetime, so regions only add holds for the rest
+    static const FName BaseContexts[] = { FName(TEXT("OnFoot")), FName(TEXT("Crouch")), FName(TEXT("Jump")) };
+
+    const FName ContextKey(*ContextName);
+    if (ContextKey == CurrentRegionContext)
+    {
+        return;
+    }
+
+    if (!CurrentRegionContext.IsNone() && !TArrayView<const FName>(BaseContexts).Contains(CurrentRegionContext))
+    {
+        ReleaseContextDictionary(CurrentRegionContext.ToString());
+    }
+    if (!TArrayView<const FName>(BaseContexts).Contains(ContextKey))
+    {
+        HoldContextDictionary(ContextName);
+    }
+    CurrentRegionContext = ContextKey;
+}
+
+void UPedAnimationManager::ReleaseAllDictionaries()
+{
+    if (ClipCache)
+    {
+        for (const TPair<FName, FName>& HeldDictionary : HeldDictionaries)
+        {
+            ClipCache->ReleaseDictionary(HeldDictionary.Value);
+        }
+    }
+    HeldDictionaries.Empty();
+    CurrentRegionContext = NAME_None;
+}
+
 // Vehicle Animation Implementation
 void UPedAnimationManager::UpdateVehicleAnimationInputs(float SteeringInput, float ThrottleInput, float BrakeInput, int32 CurrentGear, float RPM, float Speed)
 {
@@ -775,6 +923,11 @@ bool UPedAnimationManager::SwitchWeaponAnimationSet(EPedWeaponType NewWeaponType
     // Use SAFE dictionary swapping with validation
     bool bSuccess = AnimationDictionary->SafeSwapDictionary(TEXT("Combat"), WeaponDictionary, true);
     
+    if (bSuccess)
+    {
+        RefreshContextDictionary(TEXT("Combat"));
+    }
+
     if (bSuccess && AnimationController)
     {
         AnimationController->CurrentWeaponType = NewWeaponType;
@@ -1019,6 +1172,9 @@ void UPedAnimationManager::SetAnimationRegion(EPedAnimationRegion NewRegion)
     if (AnimationController)
     {
         AnimationController->SetAnimationRegion(NewRegion);
+
+        // Start streaming the region's dictionary before its first animation is asked for
+        EnterRegionContext(AnimationController->GetRegionContextName(NewRegion));
     }
 }
 
@@ -9,6 +9,8 @@
 #include "GameFramework/Character.h"
 #include "PedAnimationManager.generated.h"
 
+class UPedAnimationClipCache;
+
 /**
  * Animation Manager Component for Ped/Player Characters
  * Handles high-level animation logic and state management
@@ -23,6 +25,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -218,6 +221,16 @@ public:
     void OnAnimationFinished(const FString& AnimationName);
 
 private:
+    // Shared resolved clips, from the game instance
+    UPROPERTY()
+    UPedAnimationClipCache* ClipCache;
+
+    // Dictionary this ped holds resident in the clip cache, per context
+    TMap<FName, FName> HeldDictionaries;
+
+    // Context of the region the ped was last seen in
+    FName CurrentRegionContext;
+
     // Internal state tracking
     EPedMovementState LastMovementState;
     EPedStanceState LastStanceState;
@@ -232,11 +245,21 @@ private:
     float TimeSinceLastStateChange;
     float TimeSinceLastAnimation;
 
+    // Controller full update last acted on; its state cannot change between full updates
+    uint64 LastSeenControllerUpdateFrame;
+
     // Internal functions
     void UpdateMovementDetection();
     void HandleAutoAnimationManagement();
     void UpdateSmoothingValues(float DeltaTime);
     void CheckForStateChanges();
+
+    // Clip residency
+    void HoldContextDictionary(const FString& ContextName);
+    void ReleaseContextDictionary(const FString& ContextName);
+    void RefreshContextDictionary(const FString& ContextName);
+    void EnterRegionContext(const FString& ContextName);
+    void ReleaseAllDictionaries();
     
     // Animation selection helpers
     FString SelectBestIdleAnimation();
@@ -0,0 +1,258 @@
+#include "AnimationGroupsBenchmarkCommandlet.h"
+#include "../Animation/AnimationGroupsLoader.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+namespace AnimationGroupsBenchmarkPrivate
+{
+    // The string-splitting loader that TinyXML2 replaced, kept as the baseline
+
+    FString ExtractAttributeValue(const FString& ElementContent, const FString& AttributeName)
+    {
+        FString SearchPattern = AttributeName + TEXT("=\"");
+        int32 StartIndex = ElementContent.Find(SearchPattern);
+        if (StartIndex == INDEX_NONE)
+        {
+            return TEXT("");
+        }
+
+        StartIndex += SearchPattern.Len();
+        int32 EndIndex = ElementContent.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, StartIndex);
+        if (EndIndex == INDEX_NONE)
+        {
+            return TEXT("");
+        }
+
+        return ElementContent.Mid(StartIndex, EndIndex - StartIndex);
+    }
+
+    TArray<FString> SplitXMLElements(const FString& XMLContent, const FString& ElementName)
+    {
+        TArray<FString> Elements;
+        FString StartTag = TEXT("<") + ElementName;
+        FString EndTag = TEXT("/>");
+
+        int32 SearchStart = 0;
+        while (true)
+        {
+            int32 StartIndex = XMLContent.Find(StartTag, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchStart);
+            if (StartIndex == INDEX_NONE)
+            {
+                break;
+            }
+
+            int32 EndIndex = XMLContent.Find(EndTag, ESearchCase::CaseSensitive, ESearchDir::FromStart, StartIndex);
+            if (EndIndex == INDEX_NONE)
+            {
+                break;
+            }
+
+            EndIndex += EndTag.Len();
+            Elements.Add(XMLContent.Mid(StartIndex, EndIndex - StartIndex));
+            SearchStart = EndIndex;
+        }
+
+        return Elements;
+    }
+
+    void ParseLegacy(UAnimationGroupsLoader& Loader, const FString& XMLContent, TArray<FAnimationDictionaryDefinition>& OutDefinitions)
+    {
+        OutDefinitions.Empty();
+
+        for (const FString& Element : SplitXMLElements(XMLContent, TEXT("AnimationDictionary")))
+        {
+            FAnimationDictionaryDefinition Definition;
+            Definition.Name = ExtractAttributeValue(Element, TEXT("Name"));
+            Definition.Path = ExtractAttributeValue(Element, TEXT("Path"));
+            Definition.EntityType = Loader.StringToEntityType(ExtractAttributeValue(Element, TEXT("EntityType")));
+            Definition.Description = FString::Printf(TEXT("%s animations for %s"),
+                                                     *Definition.Name, *Loader.EntityTypeToString(Definition.EntityType));
+            if (!Definition.Name.IsEmpty())
+            {
+                OutDefinitions.Add(Definition);
+            }
+        }
+    }
+
+    /** Every per-entity-type query plus a by-name lookup of every dictionary, as the old loader answered them */
+    int32 QueryLinear(const TArray<FAnimationDictionaryDefinition>& Definitions, const TArray<FString>& Names)
+    {
+        int32 Found = 0;
+        for (int32 Type = 0; Type <= static_cast<int32>(EAnimationEntityType::UNKNOWN); ++Type)
+        {
+            TArray<FAnimationDictionaryDefinition> Filtered;
+            for (const FAnimationDictionaryDefinition& Dict : Definitions)
+            {
+                if (Dict.EntityType == static_cast<EAnimationEntityType>(Type))
+                {
+                    Filtered.Add(Dict);
+                }
+            }
+            Found += Filtered.Num();
+        }
+
+        for (const FString& Name : Names)
+        {
+            for (const FAnimationDictionaryDefinition& Dict : Definitions)
+            {
+                if (Dict.Name == Name)
+                {
+                    ++Found;
+                    break;
+                }
+            }
+        }
+        return Found;
+    }
+
+    /** The same queries through the loader's indices */
+    int32 QueryIndexed(const UAnimationGroupsLoader& Loader, const TArray<FString>& Names)
+    {
+        int32 Found = 0;
+        for (int32 Type = 0; Type <= static_cast<int32>(EAnimationEntityType::UNKNOWN); ++Type)
+        {
+            Found += Loader.GetDictionaryIndicesByEntityType(static_cast<EAnimationEntityType>(Type)).Num();
+        }
+
+        for (const FString& Name : Names)
+        {
+            if (Loader.FindDictionaryIndex(Name) != INDEX_NONE)
+            {
+                ++Found;
+            }
+        }
+        return Found;
+    }
+
+    bool DefinitionsMatch(const FAnimationDictionaryDefinition& A, const FAnimationDictionaryDefinition& B)
+    {
+        return A.Name.Equals(B.Name, ESearchCase::CaseSensitive) && A.Path.Equals(B.Path, ESearchCase::CaseSensitive) &&
+               A.EntityType == B.EntityType && A.Description.Equals(B.Description, ESearchCase::CaseSensitive);
+    }
+}
+
+UAnimationGroupsBenchmarkCommandlet::UAnimationGroupsBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UAnimationGroupsBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace AnimationGroupsBenchmarkPrivate;
+
+    int32 Iterations = 1000;
+    FString FilePath = FPaths::ProjectDir() / TEXT("Data/Animations/AnimationGroups.xml");
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+        FString::Printf(TEXT("AnimationGroupsBenchmark_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    FParse::Value(*Params, TEXT("File="), FilePath);
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+    Iterations = FMath::Max(Iterations, 1);
+
+    TArray<uint8> XMLData;
+    FString XMLContent;
+    if (!FFileHelper::LoadFileToArray(XMLData, *FilePath) || !FFileHelper::LoadFileToString(XMLContent, *FilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AnimationGroupsBenchmark: Failed to load %s"), *FilePath);
+        return 1;
+    }
+
+    const ANSICHAR* XMLBytes = reinterpret_cast<const ANSICHAR*>(XMLData.GetData());
+    UAnimationGroupsLoader* Loader = NewObject<UAnimationGroupsLoader>();
+
+    // Both loaders must agree before their timings mean anything
+    TArray<FAnimationDictionaryDefinition> LegacyDefinitions;
+    ParseLegacy(*Loader, XMLContent, LegacyDefinitions);
+    if (!Loader->LoadAnimationGroupsFromBuffer(XMLBytes, XMLData.Num()))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AnimationGroupsBenchmark: %s has no dictionaries the TinyXML2 loader could read"), *FilePath);
+        return 1;
+    }
+
+    if (LegacyDefinitions.Num() != Loader->LoadedDictionaries.Num())
+    {
+        UE_LOG(LogTemp, Error, TEXT("AnimationGroupsBenchmark: Legacy loader found %d dictionaries, TinyXML2 loader %d"),
+               LegacyDefinitions.Num(), Loader->LoadedDictionaries.Num());
+        return 1;
+    }
+
+    for (int32 Index = 0; Index < LegacyDefinitions.Num(); ++Index)
+    {
+        if (!DefinitionsMatch(LegacyDefinitions[Index], Loader->LoadedDictionaries[Index]))
+        {
+            UE_LOG(LogTemp, Error, TEXT("AnimationGroupsBenchmark: Dictionary %d differs: legacy '%s', TinyXML2 '%s'"),
+                   Index, *LegacyDefinitions[Index].Name, *Loader->LoadedDictionaries[Index].Name);
+            return 1;
+        }
+    }
+
+    const TArray<FString> Names = Loader->GetAllDictionaryNames();
+    if (QueryLinear(LegacyDefinitions, Names) != QueryIndexed(*Loader, Names))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AnimationGroupsBenchmark: Indexed queries disagree with linear scans"));
+        return 1;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("AnimationGroupsBenchmark: %s, %d bytes, %d dictionaries, %d iterations"),
+           *FilePath, XMLData.Num(), LegacyDefinitions.Num(), Iterations);
+
+    // The loader logs every parse; keep that out of the timings
+    const ELogVerbosity::Type PreviousVerbosity = LogTemp.GetVerbosity();
+    LogTemp.SetVerbosity(ELogVerbosity::Warning);
+
+    FString CSV = TEXT("Mode,Iteration,Us\n");
+    int32 Checksum = 0;
+
+    const TPair<const TCHAR*, TFunction<void()>> Modes[] =
+    {
+        { TEXT("LegacyParse"), [&]() { ParseLegacy(*Loader, XMLContent, LegacyDefinitions); } },
+        { TEXT("TinyXMLParse"), [&]() { Loader->LoadAnimationGroupsFromBuffer(XMLBytes, XMLData.Num()); } },
+        { TEXT("LinearQuery"), [&]() { Checksum += QueryLinear(LegacyDefinitions, Names); } },
+        { TEXT("IndexedQuery"), [&]() { Checksum += QueryIndexed(*Loader, Names); } },
+    };
+
+    TArray<FString> Summary;
+    for (const TPair<const TCHAR*, TFunction<void()>>& Mode : Modes)
+    {
+        double MinUs = TNumericLimits<double>::Max();
+        double TotalUs = 0.0;
+
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            const double StartTime = FPlatformTime::Seconds();
+            Mode.Value();
+            const double Us = (FPlatformTime::Seconds() - StartTime) * 1.0e6;
+
+            MinUs = FMath::Min(MinUs, Us);
+            TotalUs += Us;
+            CSV += FString::Printf(TEXT("%s,%d,%.3f\n"), Mode.Key, Iteration, Us);
+        }
+
+        Summary.Add(FString::Printf(TEXT("AnimationGroupsBenchmark: %-12s min %.2f us, avg %.2f us"), Mode.Key, MinUs, TotalUs / Iterations));
+    }
+
+    LogTemp.SetVerbosity(PreviousVerbosity);
+
+    for (const FString& Line : Summary)
+    {
+        UE_LOG(LogTemp, Display, TEXT("%s"), *Line);
+    }
+    UE_LOG(LogTemp, Verbose, TEXT("AnimationGroupsBenchmark: Query checksum %d"), Checksum);
+
+    if (FFileHelper::SaveStringToFile(CSV, *OutputPath))
+    {
+        UE_LOG(LogTemp, Display, TEXT("AnimationGroupsBenchmark: Wrote %d iterations to %s"),
+               Iterations * static_cast<int32>(UE_ARRAY_COUNT(Modes)), *OutputPath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("AnimationGroupsBenchmark: Failed to write %s"), *OutputPath);
+    }
+    return 0;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AnimationGroupsBenchmarkCommandlet.generated.h"
+
+/**
+ * Animation Groups Benchmark Commandlet
+ * Parses AnimationGroups.xml from memory with the old string-splitting loader and with the TinyXML2
+ * loader, checks both produce the same definitions, then times the per-entity-type and by-name queries
+ * as linear scans against the loader's indices. File IO is excluded; both parsers start from a buffer.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Game.uproject -run=AnimationGroupsBenchmark -unattended
+ *       [-File=Data/Animations/AnimationGroups.xml] [-Iterations=1000]
+ *       [-Output=Saved/Benchmarks/AnimationGroupsBenchmark.csv]
+ */
+UCLASS()
+class GAME_API UAnimationGroupsBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UAnimationGroupsBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,84 @@
+#include "OnimCompileCommandlet.h"
+#include "../Animation/Onim/OnimCompiler.h"
+#include "../Animation/Onim/OnimCompression.h"
+#include "HAL/PlatformTime.h"
+
+UOnimCompileCommandlet::UOnimCompileCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UOnimCompileCommandlet::Main(const FString& Params)
+{
+    FString DictionaryList;
+    FParse::Value(*Params, TEXT("Dictionaries="), DictionaryList, false);
+    const bool bForce = FParse::Param(*Params, TEXT("Force"));
+
+    FOnimCompressionSettings Settings;
+    FParse::Value(*Params, TEXT("RotationTolerance="), Settings.RotationTolerance);
+    FParse::Value(*Params, TEXT("TranslationTolerance="), Settings.TranslationTolerance);
+
+    TArray<FString> Dictionaries;
+    if (DictionaryList.IsEmpty())
+    {
+        FOnimCompiler::GetDictionaryNames(Dictionaries);
+    }
+    else
+    {
+        DictionaryList.ParseIntoArray(Dictionaries, TEXT(","));
+    }
+
+    if (Dictionaries.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("OnimCompile: No dictionaries found under %s"), *FOnimCompiler::GetSourceRoot());
+        return 1;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    FOnimCompileStats Totals;
+    int32 NumCompiled = 0;
+    int32 NumSkipped = 0;
+    int32 NumFailed = 0;
+
+    for (const FString& Dictionary : Dictionaries)
+    {
+        if (!bForce && FOnimCompiler::IsUpToDate(Dictionary))
+        {
+            UE_LOG(LogTemp, Display, TEXT("OnimCompile: %s is up to date"), *Dictionary);
+            ++NumSkipped;
+            continue;
+        }
+
+        FOnimCompileStats Stats;
+        if (!FOnimCompiler::CompileDictionary(Dictionary, &Stats, Settings))
+        {
+            ++NumFailed;
+            continue;
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("OnimCompile: %-24s %4d clips %6d tracks (%5d constant) %5.1f%% keys kept %9lld -> %8lld bytes %5.1f:1  max error %.6f  max rotation error %.4f deg"),
+               *Dictionary, Stats.NumClips, Stats.NumTracks, Stats.NumConstantTracks,
+               Stats.SourceKeys > 0 ? 100.0 * Stats.StoredKeys / Stats.SourceKeys : 0.0,
+               Stats.RawBytes, Stats.CompiledBytes, Stats.GetCompressionRatio(), Stats.MaxError, FMath::RadiansToDegrees(Stats.MaxRotationError));
+
+        ++NumCompiled;
+        Totals.NumClips += Stats.NumClips;
+        Totals.NumTracks += Stats.NumTracks;
+        Totals.NumConstantTracks += Stats.NumConstantTracks;
+        Totals.SourceKeys += Stats.SourceKeys;
+        Totals.StoredKeys += Stats.StoredKeys;
+        Totals.RawBytes += Stats.RawBytes;
+        Totals.CompiledBytes += Stats.CompiledBytes;
+        Totals.MaxError = FMath::Max(Totals.MaxError, Stats.MaxError);
+        Totals.MaxRotationError = FMath::Max(Totals.MaxRotationError, Stats.MaxRotationError);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("OnimCompile: %d compiled, %d up to date, %d failed; %d clips, %lld -> %lld bytes (%.1f:1), max error %.6f, max rotation error %.4f deg, %.2f s"),
+           NumCompiled, NumSkipped, NumFailed, Totals.NumClips, Totals.RawBytes, Totals.CompiledBytes, Totals.GetCompressionRatio(),
+           Totals.MaxError, FMath::RadiansToDegrees(Totals.MaxRotationError), FPlatformTime::Seconds() - StartTime);
+
+    return NumFailed > 0 ? 1 : 0;
+}
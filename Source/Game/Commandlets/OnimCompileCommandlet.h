@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OnimCompileCommandlet.generated.h"
+
+/**
+ * Onim Compile Commandlet
+ * Compiles the text .onim dictionaries under Data/Animations into the binary form the runtime maps
+ * (Data/Animations/<dictionary>.onimc). Up-to-date dictionaries are skipped unless -Force is given,
+ * which is also needed for new tolerances to take effect. Reports the compression ratio (against
+ * every frame stored as floats) and the largest sampled error per dictionary.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Game.uproject -run=OnimCompile -unattended
+ *       [-Dictionaries=move_player,jump_std] [-Force]
+ *       [-RotationTolerance=0.001] [-TranslationTolerance=0.0002]
+ */
+UCLASS()
+class GAME_API UOnimCompileCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UOnimCompileCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,133 @@
+#include "OnimParseBenchmarkCommandlet.h"
+#include "../Animation/Onim/OnimCompiler.h"
+#include "../Animation/Onim/OnimParser.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+UOnimParseBenchmarkCommandlet::UOnimParseBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UOnimParseBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 Iterations = 10;
+    double TargetMs = 200.0;
+    FString DictionaryList;
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+        FString::Printf(TEXT("OnimParseBenchmark_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    FParse::Value(*Params, TEXT("TargetMs="), TargetMs);
+    FParse::Value(*Params, TEXT("Dictionaries="), DictionaryList, false);
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+    Iterations = FMath::Max(Iterations, 1);
+
+    TArray<FString> Dictionaries;
+    if (DictionaryList.IsEmpty())
+    {
+        FOnimCompiler::GetDictionaryNames(Dictionaries);
+    }
+    else
+    {
+        DictionaryList.ParseIntoArray(Dictionaries, TEXT(","));
+    }
+
+    TArray<FString> Files;
+    for (const FString& Dictionary : Dictionaries)
+    {
+        FOnimCompiler::GetSourceFiles(Dictionary, Files);
+    }
+
+    if (Files.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("OnimParseBenchmark: No .onim files found under %s"), *FOnimCompiler::GetSourceRoot());
+        return 1;
+    }
+
+    int64 TotalBytes = 0;
+    for (const FString& File : Files)
+    {
+        TotalBytes += FMath::Max<int64>(IFileManager::Get().FileSize(*File), 0);
+    }
+
+    // Warm-up: faults the files into the page cache, sizes the reused clips and checks everything parses
+    TArray<FOnimClipSource> Clips;
+    TArray<FString> Errors;
+    if (FOnimParser::ParseFiles(Files, Clips, Errors, false) != Files.Num())
+    {
+        for (int32 Index = 0; Index < Files.Num(); ++Index)
+        {
+            if (!Errors[Index].IsEmpty())
+            {
+                UE_LOG(LogTemp, Error, TEXT("OnimParseBenchmark: %s: %s"), *Files[Index], *Errors[Index]);
+            }
+        }
+        return 1;
+    }
+
+    int64 TotalValues = 0;
+    for (const FOnimClipSource& Clip : Clips)
+    {
+        for (const FOnimTrackSource& Track : Clip.Tracks)
+        {
+            TotalValues += Track.Floats.Num() + Track.UInts.Num();
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("OnimParseBenchmark: %d files in %d dictionaries, %.2f MB, %lld values, %d iterations"),
+           Files.Num(), Dictionaries.Num(), TotalBytes / (1024.0 * 1024.0), TotalValues, Iterations);
+
+    FString CSV = TEXT("Mode,Iteration,Ms,MBPerSecond,MValuesPerSecond\n");
+    double SingleThreadMinMs = 0.0;
+
+    for (const bool bParallel : { false, true })
+    {
+        const TCHAR* ModeName = bParallel ? TEXT("Parallel") : TEXT("SingleThread");
+        double MinMs = TNumericLimits<double>::Max();
+        double TotalMs = 0.0;
+
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            const double StartTime = FPlatformTime::Seconds();
+            FOnimParser::ParseFiles(Files, Clips, Errors, bParallel);
+            const double Ms = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+            MinMs = FMath::Min(MinMs, Ms);
+            TotalMs += Ms;
+            CSV += FString::Printf(TEXT("%s,%d,%.3f,%.1f,%.2f\n"), ModeName, Iteration, Ms,
+                TotalBytes / (1024.0 * 1024.0) / (Ms / 1000.0), TotalValues / 1.0e6 / (Ms / 1000.0));
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("OnimParseBenchmark: %-12s min %.2f ms, avg %.2f ms, %.1f MB/s, %.1f M values/s"),
+               ModeName, MinMs, TotalMs / Iterations,
+               TotalBytes / (1024.0 * 1024.0) / (MinMs / 1000.0), TotalValues / 1.0e6 / (MinMs / 1000.0));
+
+        if (!bParallel)
+        {
+            SingleThreadMinMs = MinMs;
+        }
+    }
+
+    if (FFileHelper::SaveStringToFile(CSV, *OutputPath))
+    {
+        UE_LOG(LogTemp, Display, TEXT("OnimParseBenchmark: Wrote %d iterations to %s"), Iterations * 2, *OutputPath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("OnimParseBenchmark: Failed to write %s"), *OutputPath);
+    }
+
+    if (SingleThreadMinMs > TargetMs)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("OnimParseBenchmark: Single-threaded parse took %.2f ms, over the %.0f ms target"), SingleThreadMinMs, TargetMs);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OnimParseBenchmarkCommandlet.generated.h"
+
+/**
+ * Onim Parse Benchmark Commandlet
+ * Parses every .onim under Data/Animations (or the listed dictionaries) with FOnimParser, first on one
+ * thread and then one file per task, and reports time, MB/s and values/s for each mode. A warm-up pass
+ * runs first so the page cache and the reused clip buffers are hot. Fails if the single-threaded pass
+ * misses -TargetMs.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Game.uproject -run=OnimParseBenchmark -unattended
+ *       [-Dictionaries=move_player,jump_std] [-Iterations=10] [-TargetMs=200]
+ *       [-Output=Saved/Benchmarks/OnimParseBenchmark.csv]
+ */
+UCLASS()
+class GAME_API UOnimParseBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UOnimParseBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
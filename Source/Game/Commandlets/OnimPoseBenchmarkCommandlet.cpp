@@ -0,0 +1,212 @@
+#include "OnimPoseBenchmarkCommandlet.h"
+#include "../Animation/Onim/OnimCompiler.h"
+#include "../Animation/Onim/OnimCompiledDictionary.h"
+#include "../Animation/Onim/OnimPoseSampler.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+namespace OnimPoseBenchmarkPrivate
+{
+    FQuat4f RandomRotation(FRandomStream& Random)
+    {
+        return FQuat4f(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f)).GetNormalized();
+    }
+
+    /** Smooth random motion: each bone drifts a little per frame, as real clips do */
+    void BuildSyntheticClip(int32 NumBones, int32 NumFrames, int32 Seed, FOnimPoseClip& OutClip)
+    {
+        FRandomStream Random(Seed);
+        OutClip.Init(NumBones, NumFrames, (NumFrames - 1) / 30.0f);
+
+        for (int32 Bone = 0; Bone < NumBones; ++Bone)
+        {
+            FQuat4f Rotation = RandomRotation(Random);
+            const FQuat4f Step = FQuat4f(FVector3f(Random.GetUnitVector()), Random.FRandRange(0.005f, 0.05f));
+            const FVector3f Translation(Random.FRandRange(-20.0f, 20.0f), Random.FRandRange(-20.0f, 20.0f), Random.FRandRange(-20.0f, 20.0f));
+
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                OutClip.SetKey(Frame, Bone, Rotation, Translation * (1.0f + 0.01f * Frame));
+                Rotation = (Step * Rotation).GetNormalized();
+            }
+        }
+    }
+
+    bool BuildDictionaryClip(const FString& DictionaryName, const FString& ClipName, FOnimPoseClip& OutClip)
+    {
+        FOnimCompiledDictionary Dictionary;
+        if (!FOnimCompiler::OpenDictionary(DictionaryName, Dictionary))
+        {
+            return false;
+        }
+
+        const int32 ClipIndex = Dictionary.FindClip(ClipName);
+        if (ClipIndex == INDEX_NONE)
+        {
+            UE_LOG(LogTemp, Error, TEXT("OnimPoseBenchmark: Clip '%s' not found in '%s'"), *ClipName, *DictionaryName);
+            return false;
+        }
+
+        TArray<uint32> BoneIds;
+        for (const FOnimTrackRecord& Track : Dictionary.GetTracks(ClipIndex))
+        {
+            if ((EOnimTrackKind)Track.Kind == EOnimTrackKind::BoneRotation)
+            {
+                BoneIds.AddUnique(Dictionary.GetBoneId(Track));
+            }
+        }
+        return OutClip.Build(Dictionary, ClipIndex, BoneIds);
+    }
+
+    /** Largest rotation angle or translation component between two poses */
+    float GetMaxDifference(TConstArrayView<FTransform> A, TConstArrayView<FTransform> B)
+    {
+        double MaxDifference = 0.0;
+        for (int32 Bone = 0; Bone < A.Num(); ++Bone)
+        {
+            MaxDifference = FMath::Max(MaxDifference, A[Bone].GetRotation().AngularDistance(B[Bone].GetRotation()));
+            MaxDifference = FMath::Max(MaxDifference, (A[Bone].GetTranslation() - B[Bone].GetTranslation()).GetAbsMax());
+        }
+        return (float)MaxDifference;
+    }
+}
+
+UOnimPoseBenchmarkCommandlet::UOnimPoseBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UOnimPoseBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace OnimPoseBenchmarkPrivate;
+
+    int32 NumBones = 80;
+    int32 NumFrames = 120;
+    int32 NumPeds = 300;
+    int32 Iterations = 20;
+    FString DictionaryName;
+    FString ClipName;
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+        FString::Printf(TEXT("OnimPoseBenchmark_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+    FParse::Value(*Params, TEXT("Bones="), NumBones);
+    FParse::Value(*Params, TEXT("Frames="), NumFrames);
+    FParse::Value(*Params, TEXT("Peds="), NumPeds);
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    FParse::Value(*Params, TEXT("Dictionary="), DictionaryName);
+    FParse::Value(*Params, TEXT("Clip="), ClipName);
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+    NumBones = FMath::Max(NumBones, 1);
+    NumFrames = FMath::Max(NumFrames, 2);
+    NumPeds = FMath::Max(NumPeds, 1);
+    Iterations = FMath::Max(Iterations, 1);
+
+    // The blend target is a second synthetic clip on the same bone slots
+    FOnimPoseClip ClipA;
+    FOnimPoseClip ClipB;
+    if (!DictionaryName.IsEmpty())
+    {
+        if (!BuildDictionaryClip(DictionaryName, ClipName, ClipA))
+        {
+            UE_LOG(LogTemp, Error, TEXT("OnimPoseBenchmark: Failed to decode '%s' from '%s'"), *ClipName, *DictionaryName);
+            return 1;
+        }
+        BuildSyntheticClip(ClipA.GetNumBones(), ClipA.GetNumFrames(), 2, ClipB);
+    }
+    else
+    {
+        BuildSyntheticClip(NumBones, NumFrames, 1, ClipA);
+        BuildSyntheticClip(NumBones, NumFrames, 2, ClipB);
+    }
+    NumBones = ClipA.GetNumBones();
+
+    // One pose per ped, each at its own phase so frames are not all cache-hot
+    TArray<FTransform> ScalarPoses;
+    TArray<FTransform> VectorPoses;
+    ScalarPoses.SetNum(NumPeds * NumBones);
+    VectorPoses.SetNum(NumPeds * NumBones);
+
+    TArray<float> Times;
+    Times.SetNum(NumPeds);
+    FRandomStream Random(3);
+    for (float& Time : Times)
+    {
+        Time = Random.FRandRange(0.0f, ClipA.GetDuration());
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("OnimPoseBenchmark: %d bones, %d frames, %d peds, %d iterations, %d-wide lanes"),
+           NumBones, ClipA.GetNumFrames(), NumPeds, Iterations, PLATFORM_ALWAYS_HAS_AVX ? 8 : 4);
+
+    FString CSV = TEXT("Mode,Path,Iteration,Ms,NsPerBone\n");
+    const double BonesPerIteration = (double)NumPeds * NumBones;
+    bool bMatched = true;
+
+    for (const bool bBlend : { false, true })
+    {
+        const TCHAR* ModeName = bBlend ? TEXT("Blend") : TEXT("Single");
+        double MinMs[2] = { TNumericLimits<double>::Max(), TNumericLimits<double>::Max() };
+
+        for (int32 Path = 0; Path < 2; ++Path)
+        {
+            const bool bScalar = Path == 0;
+            TArray<FTransform>& Poses = bScalar ? ScalarPoses : VectorPoses;
+
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                const double StartTime = FPlatformTime::Seconds();
+                for (int32 Ped = 0; Ped < NumPeds; ++Ped)
+                {
+                    const TArrayView<FTransform> Pose(Poses.GetData() + Ped * NumBones, NumBones);
+                    const float TimeB = ClipB.GetDuration() - Times[Ped];
+                    if (bBlend && bScalar)
+                    {
+                        FOnimPoseSampler::SampleBlendedPoseScalar(ClipA, Times[Ped], ClipB, TimeB, 0.35f, Pose);
+                    }
+                    else if (bBlend)
+                    {
+                        FOnimPoseSampler::SampleBlendedPose(ClipA, Times[Ped], ClipB, TimeB, 0.35f, Pose);
+                    }
+                    else if (bScalar)
+                    {
+                        FOnimPoseSampler::SamplePoseScalar(ClipA, Times[Ped], Pose);
+                    }
+                    else
+                    {
+                        FOnimPoseSampler::SamplePose(ClipA, Times[Ped], Pose);
+                    }
+                }
+                const double Ms = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+                MinMs[Path] = FMath::Min(MinMs[Path], Ms);
+                CSV += FString::Printf(TEXT("%s,%s,%d,%.4f,%.2f\n"), ModeName, bScalar ? TEXT("Scalar") : TEXT("Vector"),
+                                       Iteration, Ms, Ms * 1.0e6 / BonesPerIteration);
+            }
+        }
+
+        // The vector paths use an approximate reciprocal square root, so allow a little drift
+        const float MaxDifference = GetMaxDifference(ScalarPoses, VectorPoses);
+        const bool bModeMatched = MaxDifference <= 1.0e-3f;
+        bMatched &= bModeMatched;
+
+        UE_LOG(LogTemp, Display, TEXT("OnimPoseBenchmark: %-6s scalar %.3f ms (%.2f ns/bone), vector %.3f ms (%.2f ns/bone), %.2fx, max difference %g%s"),
+               ModeName, MinMs[0], MinMs[0] * 1.0e6 / BonesPerIteration, MinMs[1], MinMs[1] * 1.0e6 / BonesPerIteration,
+               MinMs[0] / FMath::Max(MinMs[1], UE_DOUBLE_SMALL_NUMBER), MaxDifference, bModeMatched ? TEXT("") : TEXT(" MISMATCH"));
+    }
+
+    if (FFileHelper::SaveStringToFile(CSV, *OutputPath))
+    {
+        UE_LOG(LogTemp, Display, TEXT("OnimPoseBenchmark: Wrote %d iterations to %s"), Iterations * 4, *OutputPath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("OnimPoseBenchmark: Failed to write %s"), *OutputPath);
+    }
+
+    return bMatched ? 0 : 1;
+}
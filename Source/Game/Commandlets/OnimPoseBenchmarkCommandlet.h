@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OnimPoseBenchmarkCommandlet.generated.h"
+
+/**
+ * Onim Pose Benchmark Commandlet
+ * Times FOnimPoseSampler's vector kernels against the scalar reference for a crowd of peds, single clip
+ * and two-clip blend, and checks both paths produce the same pose. Uses a synthetic clip of random
+ * rotations unless a compiled clip is named, in which case its bone rotation tracks set the bone list.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Game.uproject -run=OnimPoseBenchmark -unattended
+ *       [-Bones=80] [-Frames=120] [-Peds=300] [-Iterations=20]
+ *       [-Dictionary=move_player -Clip=walk] [-Output=Saved/Benchmarks/OnimPoseBenchmark.csv]
+ */
+UCLASS()
+class GAME_API UOnimPoseBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UOnimPoseBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
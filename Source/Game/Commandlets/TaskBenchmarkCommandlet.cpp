@@ -0,0 +1,313 @@
+#include "TaskBenchmarkCommandlet.h"
+#include "../Peds/Ped.h"
+#include "../Tasks/TaskFactory.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+
+UTaskBenchmarkCommandlet::UTaskBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+
+    OneShotWeight = 50;
+    ComplexWeight = 30;
+    WildComplexWeight = 20;
+}
+
+int32 UTaskBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 PedCount = 100;
+    int32 FrameCount = 600;
+    float DeltaTime = 1.0f / 30.0f;
+    int32 GCInterval = 60;
+    int32 Seed = 1337;
+    FString MixString = TEXT("50,30,20");
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+        FString::Printf(TEXT("TaskBenchmark_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+    FParse::Value(*Params, TEXT("Peds="), PedCount);
+    FParse::Value(*Params, TEXT("Frames="), FrameCount);
+    FParse::Value(*Params, TEXT("DeltaTime="), DeltaTime);
+    FParse::Value(*Params, TEXT("GCInterval="), GCInterval);
+    FParse::Value(*Params, TEXT("Seed="), Seed);
+    FParse::Value(*Params, TEXT("Mix="), MixString, false);
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    TArray<FString> MixParts;
+    MixString.ParseIntoArray(MixParts, TEXT(","));
+    if (MixParts.Num() == 3)
+    {
+        OneShotWeight = FMath::Max(FCString::Atoi(*MixParts[0]), 0);
+        ComplexWeight = FMath::Max(FCString::Atoi(*MixParts[1]), 0);
+        WildComplexWeight = FMath::Max(FCString::Atoi(*MixParts[2]), 0);
+    }
+    if (OneShotWeight + ComplexWeight + WildComplexWeight <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("TaskBenchmark: Task mix '%s' has no positive weights"), *MixString);
+        return 1;
+    }
+
+    PedCount = FMath::Max(PedCount, 2);
+    FrameCount = FMath::Max(FrameCount, 1);
+    RandomStream.Initialize(Seed);
+
+    UE_LOG(LogTemp, Display, TEXT("TaskBenchmark: %d peds, %d frames, dt=%.4f, mix=%d/%d/%d, seed=%d"),
+           PedCount, FrameCount, DeltaTime, OneShotWeight, ComplexWeight, WildComplexWeight, Seed);
+
+    AddToRoot();
+
+    UWorld* World = CreateBenchmarkWorld();
+    if (!World)
+    {
+        UE_LOG(LogTemp, Error, TEXT("TaskBenchmark: Failed to create benchmark world"));
+        RemoveFromRoot();
+        return 1;
+    }
+
+    // Spawn the population on a grid; neighbours (i, i^1) are paired as opponents and targets
+    const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)PedCount));
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    for (int32 i = 0; i < PedCount; ++i)
+    {
+        const FVector Location((i % GridSize) * 400.0f, (i / GridSize) * 400.0f, 100.0f);
+        APed* Ped = World->SpawnActor<APed>(APed::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+        if (Ped)
+        {
+            Ped->SetCharacterName(FString::Printf(TEXT("BenchPed_%d"), i));
+            Peds.Add(Ped);
+        }
+    }
+
+    if (Peds.Num() < 2)
+    {
+        UE_LOG(LogTemp, Error, TEXT("TaskBenchmark: Spawned only %d peds"), Peds.Num());
+        DestroyBenchmarkWorld(World);
+        RemoveFromRoot();
+        return 1;
+    }
+
+    ActiveTasks.SetNumZeroed(Peds.Num());
+
+    FString CSV = TEXT("Frame,FrameMs,WorldTickMs,TaskTickMs,ActiveTasks,Started,StartFailed,Completed,Failed,UObjects,UObjectDelta,UsedPhysicalMB,MemDeltaKB,GCMs\n");
+
+    TArray<float> FrameTimes;
+    FrameTimes.Reserve(FrameCount);
+    int64 TotalStarted = 0;
+    int64 TotalStartFailed = 0;
+    int64 TotalCompleted = 0;
+    int64 TotalFailed = 0;
+    double TotalGCMs = 0.0;
+
+    int32 LastObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+    uint64 LastUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+    for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+    {
+        const double FrameStart = FPlatformTime::Seconds();
+        int32 Started = 0;
+        int32 StartFailed = 0;
+        int32 Completed = 0;
+        int32 Failed = 0;
+
+        // Churn: retire finished tasks and hand out new ones
+        for (int32 i = 0; i < ActiveTasks.Num(); ++i)
+        {
+            UBaseTask* Task = ActiveTasks[i];
+            if (Task && (Task->IsTaskActive() || Task->GetTaskState() == ETaskState::Paused))
+            {
+                continue;
+            }
+
+            if (Task && Task->IsTaskCompleted())
+            {
+                ++Completed;
+            }
+            else if (Task)
+            {
+                ++Failed;
+            }
+
+            bool bStartFailed = false;
+            ActiveTasks[i] = AssignRandomTask(i, bStartFailed);
+            if (ActiveTasks[i])
+            {
+                ++Started;
+            }
+            else if (bStartFailed)
+            {
+                ++StartFailed;
+            }
+        }
+
+        // World tick drives actors and world subsystems (e.g. the wild-complex analysis batch)
+        const double WorldTickStart = FPlatformTime::Seconds();
+        World->Tick(LEVELTICK_All, DeltaTime);
+        const double WorldTickEnd = FPlatformTime::Seconds();
+
+        int32 RunningTasks = 0;
+        for (UBaseTask* Task : ActiveTasks)
+        {
+            if (Task)
+            {
+                Task->TickTask(DeltaTime);
+                RunningTasks += Task->IsTaskActive() ? 1 : 0;
+            }
+        }
+        const double TaskTickEnd = FPlatformTime::Seconds();
+
+        double GCMs = 0.0;
+        if (GCInterval > 0 && (Frame + 1) % GCInterval == 0)
+        {
+            const double GCStart = FPlatformTime::Seconds();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+            GCMs = (FPlatformTime::Seconds() - GCStart) * 1000.0;
+            TotalGCMs += GCMs;
+        }
+
+        const double FrameMs = (FPlatformTime::Seconds() - FrameStart) * 1000.0;
+        const int32 ObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+        const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+        CSV += FString::Printf(TEXT("%d,%.4f,%.4f,%.4f,%d,%d,%d,%d,%d,%d,%d,%.2f,%.1f,%.4f\n"),
+            Frame, FrameMs,
+            (WorldTickEnd - WorldTickStart) * 1000.0,
+            (TaskTickEnd - WorldTickEnd) * 1000.0,
+            RunningTasks, Started, StartFailed, Completed, Failed,
+            ObjectCount, ObjectCount - LastObjectCount,
+            UsedPhysical / (1024.0 * 1024.0),
+            ((int64)UsedPhysical - (int64)LastUsedPhysical) / 1024.0,
+            GCMs);
+
+        FrameTimes.Add((float)FrameMs);
+        TotalStarted += Started;
+        TotalStartFailed += StartFailed;
+        TotalCompleted += Completed;
+        TotalFailed += Failed;
+        LastObjectCount = ObjectCount;
+        LastUsedPhysical = UsedPhysical;
+    }
+
+    if (FFileHelper::SaveStringToFile(CSV, *OutputPath))
+    {
+        UE_LOG(LogTemp, Display, TEXT("TaskBenchmark: Wrote %d frames to %s"), FrameCount, *OutputPath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("TaskBenchmark: Failed to write %s"), *OutputPath);
+    }
+
+    // Summary
+    FrameTimes.Sort();
+    float TotalFrameMs = 0.0f;
+    for (float FrameMs : FrameTimes)
+    {
+        TotalFrameMs += FrameMs;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("TaskBenchmark: avg %.3f ms, p50 %.3f ms, p95 %.3f ms, max %.3f ms"),
+           TotalFrameMs / FrameTimes.Num(),
+           FrameTimes[FrameTimes.Num() / 2],
+           FrameTimes[FMath::Min(FrameTimes.Num() - 1, (int32)(FrameTimes.Num() * 0.95f))],
+           FrameTimes.Last());
+    UE_LOG(LogTemp, Display, TEXT("TaskBenchmark: %lld started, %lld failed to start, %lld completed, %lld failed, %.3f ms total GC"),
+           TotalStarted, TotalStartFailed, TotalCompleted, TotalFailed, TotalGCMs);
+
+    DestroyBenchmarkWorld(World);
+    RemoveFromRoot();
+    return 0;
+}
+
+UBaseTask* UTaskBenchmarkCommandlet::AssignRandomTask(int32 Index, bool& bOutStartFailed)
+{
+    bOutStartFailed = false;
+
+    APed* Ped = Peds[Index];
+    APed* Partner = Peds[(Index ^ 1) < Peds.Num() ? (Index ^ 1) : 0];
+    if (!IsValid(Ped) || !IsValid(Partner))
+    {
+        return nullptr;
+    }
+
+    UBaseTask* Task = nullptr;
+    const int32 Roll = RandomStream.RandRange(0, OneShotWeight + ComplexWeight + WildComplexWeight - 1);
+
+    if (Roll < OneShotWeight)
+    {
+        switch (RandomStream.RandRange(0, 2))
+        {
+            case 0:
+                Task = UTaskFactory::CreateTurnTask(Ped, RandomStream.GetUnitVector().GetSafeNormal2D(), 180.0f);
+                break;
+            case 1:
+                Task = UTaskFactory::CreateLookAtTask(Ped, Partner, 1.0f);
+                break;
+            default:
+                Task = UTaskFactory::CreateMoveTowardsTask(Ped, Ped->GetActorLocation() + RandomStream.GetUnitVector() * 300.0f, 300.0f);
+                break;
+        }
+    }
+    else if (Roll < OneShotWeight + ComplexWeight)
+    {
+        Task = RandomStream.RandRange(0, 1) == 0
+            ? (UBaseTask*)UTaskFactory::CreateGraphTask(Ped, TEXT("Climb"))
+            : (UBaseTask*)UTaskFactory::CreateClimbTask(Ped, Partner, 150.0f);
+    }
+    else
+    {
+        Task = UTaskFactory::CreateFightAgainstTask(Ped, Partner, 10.0f);
+    }
+
+    if (Task && !Task->StartTask())
+    {
+        bOutStartFailed = true;
+        return nullptr;
+    }
+
+    return Task;
+}
+
+UWorld* UTaskBenchmarkCommandlet::CreateBenchmarkWorld()
+{
+    if (!GEngine)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("TaskBenchmarkWorld"));
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+    return World;
+}
+
+void UTaskBenchmarkCommandlet::DestroyBenchmarkWorld(UWorld* World)
+{
+    ActiveTasks.Empty();
+    Peds.Empty();
+
+    if (World)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TaskBenchmarkCommandlet.generated.h"
+
+class APed;
+class UBaseTask;
+
+/**
+ * Task Benchmark Commandlet
+ * Spawns a synthetic population of headless peds, keeps every ped busy with a weighted mix of
+ * OneShot/Complex/WildComplex tasks created through UTaskFactory, and writes per-frame cost,
+ * task churn, UObject/memory growth and GC time to CSV.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Game.uproject -run=TaskBenchmark -nullrhi -unattended
+ *       [-Peds=100] [-Frames=600] [-DeltaTime=0.0333] [-GCInterval=60]
+ *       [-Mix=50,30,20] [-Seed=1337] [-Output=Saved/Benchmarks/TaskBenchmark.csv]
+ */
+UCLASS()
+class GAME_API UTaskBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UTaskBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    /** Create and start a task for the ped at Index, picking the category from the weighted mix; bOutStartFailed is set when a created task refuses to start */
+    UBaseTask* AssignRandomTask(int32 Index, bool& bOutStartFailed);
+
+    UWorld* CreateBenchmarkWorld();
+    void DestroyBenchmarkWorld(UWorld* World);
+
+    UPROPERTY()
+    TArray<APed*> Peds;
+
+    UPROPERTY()
+    TArray<UBaseTask*> ActiveTasks;
+
+    FRandomStream RandomStream;
+    int32 OneShotWeight;
+    int32 ComplexWeight;
+    int32 WildComplexWeight;
+};
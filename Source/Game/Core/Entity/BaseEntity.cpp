@@ -2,42 +2,36 @@
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "TimerManager.h"
+#include "EntityIDManager.h"
+#include "EntityRegistrySubsystem.h"
+#include <atomic>
 
-// Initialize static ID counter
-int32 UBaseEntity::NextEntityID = 1;
+namespace BaseEntityIdentity
+{
+    /** Bumped for every runtime ID so a reused EntityID still gets a new runtime ID */
+    std::atomic<uint32> RuntimeIDGeneration(0);
+}
 
 UBaseEntity::UBaseEntity()
 {
     // ========== ENTITY IDENTITY SYSTEM ==========
-    // Generate unique Entity ID automatically
-    EntityID = NextEntityID++;
+    // Generate unique Entity ID automatically; safe on async loading and worker threads.
+    // Class defaults and archetypes don't consume IDs.
+    AllocatedEntityID = HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject) ? 0 : FEntityIDAllocator::Get().Allocate();
+    EntityID = AllocatedEntityID;
     EntityName = FString::Printf(TEXT("Entity_%d"), EntityID);
     EntityType = EEntityType::WorldObject;
     WorldOutlinerName = EntityName;
     DisplayName = EntityName;
-    UniqueRuntimeID = "";
+    UniqueRuntimeID = 0;
     OwnerActor = nullptr;
     SearchTags.Empty();
+    RegistrySlot = INDEX_NONE;
+    StateArrays = nullptr;
     
     // ========== EXISTING SYSTEM ==========
-    bIsActive = true;
-    bIsSpawned = false;
-    
-    // Health defaults
-    MaxHealth = 100.0f;
-    CurrentHealth = MaxHealth;
-    bIsAlive = true;
-    bIsInvulnerable = false;
-    
-    // Spatial defaults
-    WorldPosition = FVector::ZeroVector;
-    WorldRotation = FRotator::ZeroRotator;
-    WorldScale = FVector::OneVector;
-    
-    // State defaults
-    CurrentState = EEntityState::Idle;
-    PreviousState = EEntityState::Idle;
-    StateTimer = 0.0f;
+    // Health, spatial and state defaults come from FEntityHotStateRow
+    DetachedState = FEntityHotStateRow();
     
     // Internal flags
     bEntityInitialized = false;
@@ -54,6 +48,20 @@ UBaseEntity::~UBaseEntity()
     SearchTags.Empty();
 }
 
+void UBaseEntity::BeginDestroy()
+{
+    if (UEntityRegistrySubsystem* EntityRegistry = Registry.Get())
+    {
+        EntityRegistry->UnregisterEntity(this);
+    }
+
+    // Deferred: the ID isn't reused until the end of the frame
+    FEntityIDAllocator::Get().Release(AllocatedEntityID);
+    AllocatedEntityID = 0;
+
+    Super::BeginDestroy();
+}
+
 // ========== ENTITY IDENTITY MANAGEMENT FUNCTIONS ==========
 
 void UBaseEntity::SetupEntityIdentity(const FString& InEntityName, EEntityType InType, AActor* InOwnerActor)
@@ -82,8 +90,14 @@ void UBaseEntity::SetupEntityIdentity(const FString& InEntityName, EEntityType I
     
     // Add default search tags
     SearchTags.Empty();
-    SearchTags.Add(InEntityName);
-    SearchTags.Add(EntityTypeToString(InType));
+    SearchTags.Add(FName(*InEntityName));
+    SearchTags.Add(FName(*EntityTypeToString(InType)));
+    
+    // Index the entity in its world's registry (resyncs tags if already registered)
+    if (UEntityRegistrySubsystem* EntityRegistry = UEntityRegistrySubsystem::Get(this))
+    {
+        EntityRegistry->RegisterEntity(this);
+    }
     
     FString TypeString = EntityTypeToString(EntityType);
     UE_LOG(LogTemp, Log, TEXT("BaseEntity: Setup identity for %s (ID: %d, Type: %s)"), 
@@ -92,12 +106,10 @@ void UBaseEntity::SetupEntityIdentity(const FString& InEntityName, EEntityType I
 
 void UBaseEntity::GenerateUniqueRuntimeID()
 {
-    // Create a unique runtime ID combining entity name, type, and timestamp
-    FDateTime Now = FDateTime::Now();
-    FString TypeString = EntityTypeToString(EntityType);
-    UniqueRuntimeID = EntityName + TEXT("_") + TypeString + TEXT("_") + 
-                      FString::FromInt(EntityID) + TEXT("_") + 
-                      FString::Printf(TEXT("%lld"), Now.GetTicks());
+    // Generation in the high half keeps the ID unique across EntityID reuse; the low half lets
+    // the registry resolve it with a plain EntityID lookup
+    const uint32 Generation = BaseEntityIdentity::RuntimeIDGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+    UniqueRuntimeID = ((uint64)Generation << 32) | (uint32)EntityID;
 }
 
 void UBaseEntity::UpdateWorldOutlinerName(const FString& NewName)
@@ -115,26 +127,46 @@ void UBaseEntity::UpdateWorldOutlinerName(const FString& NewName)
     }
 }
 
-void UBaseEntity::AddSearchTag(const FString& Tag)
+void UBaseEntity::AddSearchTag(FName Tag)
 {
-    if (!Tag.IsEmpty() && !SearchTags.Contains(Tag))
+    if (!Tag.IsNone() && !HasSearchTag(Tag))
     {
         SearchTags.Add(Tag);
+        if (UEntityRegistrySubsystem* EntityRegistry = Registry.Get())
+        {
+            EntityRegistry->AddTag(this, Tag);
+        }
         UE_LOG(LogTemp, Verbose, TEXT("BaseEntity: Added search tag '%s' to entity %s"), 
-               *Tag, *EntityName);
+               *Tag.ToString(), *EntityName);
     }
 }
 
-void UBaseEntity::AddSearchTags(const TArray<FString>& Tags)
+void UBaseEntity::AddSearchTags(const TArray<FName>& Tags)
 {
-    for (const FString& Tag : Tags)
+    for (const FName& Tag : Tags)
     {
         AddSearchTag(Tag);
     }
 }
 
-bool UBaseEntity::HasSearchTag(const FString& Tag) const
+void UBaseEntity::RemoveSearchTag(FName Tag)
 {
+    if (SearchTags.RemoveSwap(Tag) > 0)
+    {
+        if (UEntityRegistrySubsystem* EntityRegistry = Registry.Get())
+        {
+            EntityRegistry->RemoveTag(this, Tag);
+        }
+    }
+}
+
+bool UBaseEntity::HasSearchTag(FName Tag) const
+{
+    // Registered entities answer from their tag bitset; FName compares are cheap for the rest
+    if (const UEntityRegistrySubsystem* EntityRegistry = Registry.Get())
+    {
+        return EntityRegistry->HasTag(this, Tag);
+    }
     return SearchTags.Contains(Tag);
 }
 
@@ -150,16 +182,21 @@ FString UBaseEntity::GetFullDisplayName() const
 
 FString UBaseEntity::GetDebugString() const
 {
-    FString TagsString = FString::Join(SearchTags, TEXT(", "));
+    TArray<FString> TagStrings;
+    for (const FName& Tag : SearchTags)
+    {
+        TagStrings.Add(Tag.ToString());
+    }
+    FString TagsString = FString::Join(TagStrings, TEXT(", "));
     FString TypeString = EntityTypeToString(EntityType);
     
-    return FString::Printf(TEXT("Entity[ID:%d, Name:'%s', Type:%s, WorldName:'%s', Display:'%s', RuntimeID:'%s', Tags:[%s]]"),
+    return FString::Printf(TEXT("Entity[ID:%d, Name:'%s', Type:%s, WorldName:'%s', Display:'%s', RuntimeID:%016llx, Tags:[%s]]"),
                            EntityID,
                            *EntityName,
                            *TypeString,
                            *WorldOutlinerName,
                            *DisplayName,
-                           *UniqueRuntimeID,
+                           UniqueRuntimeID,
                            *TagsString);
 }
 
@@ -220,10 +257,10 @@ void UBaseEntity::InitializeEntity()
     }
     
     // Set initial state
-    CurrentHealth = MaxHealth;
-    bIsAlive = true;
-    CurrentState = EEntityState::Idle;
-    StateTimer = 0.0f;
+    HotField(&FEntityStateArrays::Health, &FEntityHotStateRow::CurrentHealth) = GetMaxHealth();
+    HotField(&FEntityStateArrays::Alive, &FEntityHotStateRow::bIsAlive) = true;
+    HotField(&FEntityStateArrays::States, &FEntityHotStateRow::CurrentState) = EEntityState::Idle;
+    HotField(&FEntityStateArrays::StateTimers, &FEntityHotStateRow::StateTimer) = 0.0f;
     
     bEntityInitialized = true;
     
@@ -237,18 +274,27 @@ void UBaseEntity::SpawnEntity(const FVector& SpawnLocation, const FRotator& Spaw
         InitializeEntity();
     }
     
-    if (bIsSpawned)
+    if (IsSpawned())
     {
         UE_LOG(LogTemp, Warning, TEXT("BaseEntity: Entity %s is already spawned"), *EntityName);
         return;
     }
     
+    // Spawned entities take part in bulk updates, so make sure the world's registry knows about us
+    if (!StateArrays)
+    {
+        if (UEntityRegistrySubsystem* EntityRegistry = UEntityRegistrySubsystem::Get(this))
+        {
+            EntityRegistry->RegisterEntity(this);
+        }
+    }
+    
     // Set spawn transform
-    WorldPosition = SpawnLocation;
-    WorldRotation = SpawnRotation;
+    SetWorldPosition(SpawnLocation);
+    SetWorldRotation(SpawnRotation);
     
-    bIsSpawned = true;
-    bIsActive = true;
+    HotField(&FEntityStateArrays::Spawned, &FEntityHotStateRow::bIsSpawned) = true;
+    SetActive(true);
     
     // Call derived class event
     OnEntitySpawned();
@@ -258,21 +304,21 @@ void UBaseEntity::SpawnEntity(const FVector& SpawnLocation, const FRotator& Spaw
 
 void UBaseEntity::DestroyEntity()
 {
-    if (!bIsSpawned)
+    if (!IsSpawned())
     {
         UE_LOG(LogTemp, Warning, TEXT("BaseEntity: Entity %s is not spawned, cannot destroy"), *EntityName);
         return;
     }
     
     // Set death state if still alive
-    if (bIsAlive)
+    if (IsAlive())
     {
-        bIsAlive = false;
+        HotField(&FEntityStateArrays::Alive, &FEntityHotStateRow::bIsAlive) = false;
         OnEntityDeath();
     }
     
-    bIsSpawned = false;
-    bIsActive = false;
+    HotField(&FEntityStateArrays::Spawned, &FEntityHotStateRow::bIsSpawned) = false;
+    SetActive(false);
     
     // Call derived class event
     OnEntityDestroyed();
@@ -282,15 +328,16 @@ void UBaseEntity::DestroyEntity()
 
 void UBaseEntity::SetEntityState(EEntityState NewState)
 {
+    EEntityState& CurrentState = HotField(&FEntityStateArrays::States, &FEntityHotStateRow::CurrentState);
     if (CurrentState == NewState)
     {
         return;
     }
     
     EEntityState OldState = CurrentState;
-    PreviousState = CurrentState;
+    HotField(&FEntityStateArrays::PreviousStates, &FEntityHotStateRow::PreviousState) = CurrentState;
     CurrentState = NewState;
-    StateTimer = 0.0f;
+    HotField(&FEntityStateArrays::StateTimers, &FEntityHotStateRow::StateTimer) = 0.0f;
     
     // Call derived class event
     OnEntityStateChanged(OldState, NewState);
@@ -301,44 +348,45 @@ void UBaseEntity::SetEntityState(EEntityState NewState)
 
 void UBaseEntity::TakeDamage(float DamageAmount, AActor* DamageSource)
 {
-    if (!bIsAlive || bIsInvulnerable || DamageAmount <= 0.0f)
+    if (!IsAlive() || IsInvulnerable() || DamageAmount <= 0.0f)
     {
         return;
     }
     
-    float PreviousHealth = CurrentHealth;
-    CurrentHealth = FMath::Max(0.0f, CurrentHealth - DamageAmount);
+    float PreviousHealth = GetCurrentHealth();
+    const float NewHealth = FMath::Max(0.0f, PreviousHealth - DamageAmount);
+    HotField(&FEntityStateArrays::Health, &FEntityHotStateRow::CurrentHealth) = NewHealth;
     
     // Call derived class event
     OnEntityDamaged(DamageAmount, DamageSource);
     
     // Check for death
-    if (CurrentHealth <= 0.0f && bIsAlive)
+    if (GetCurrentHealth() <= 0.0f && IsAlive())
     {
-        bIsAlive = false;
+        HotField(&FEntityStateArrays::Alive, &FEntityHotStateRow::bIsAlive) = false;
         SetEntityState(EEntityState::Dead);
         OnEntityDeath();
     }
     
     UE_LOG(LogTemp, Log, TEXT("BaseEntity: Entity %s took %.1f damage (%.1f -> %.1f HP)"), 
-           *EntityName, DamageAmount, PreviousHealth, CurrentHealth);
+           *EntityName, DamageAmount, PreviousHealth, GetCurrentHealth());
 }
 
 void UBaseEntity::RestoreHealth(float HealAmount)
 {
-    if (!bIsAlive || HealAmount <= 0.0f)
+    if (!IsAlive() || HealAmount <= 0.0f)
     {
         return;
     }
     
-    float PreviousHealth = CurrentHealth;
-    CurrentHealth = FMath::Min(MaxHealth, CurrentHealth + HealAmount);
+    float PreviousHealth = GetCurrentHealth();
+    HotField(&FEntityStateArrays::Health, &FEntityHotStateRow::CurrentHealth) = FMath::Min(GetMaxHealth(), PreviousHealth + HealAmount);
     
     // Call derived class event
     OnEntityHealed(HealAmount);
     
     UE_LOG(LogTemp, Log, TEXT("BaseEntity: Entity %s healed %.1f HP (%.1f -> %.1f HP)"), 
-           *EntityName, HealAmount, PreviousHealth, CurrentHealth);
+           *EntityName, HealAmount, PreviousHealth, GetCurrentHealth());
 }
 
 void UBaseEntity::SetMaxHealth(float NewMaxHealth)
@@ -350,30 +398,31 @@ void UBaseEntity::SetMaxHealth(float NewMaxHealth)
     }
     
     float HealthPercentage = GetHealthPercentage();
-    MaxHealth = NewMaxHealth;
-    CurrentHealth = MaxHealth * (HealthPercentage / 100.0f);
+    HotField(&FEntityStateArrays::MaxHealth, &FEntityHotStateRow::MaxHealth) = NewMaxHealth;
+    HotField(&FEntityStateArrays::Health, &FEntityHotStateRow::CurrentHealth) = NewMaxHealth * (HealthPercentage / 100.0f);
     
     UE_LOG(LogTemp, Log, TEXT("BaseEntity: Entity %s max health set to %.1f (current: %.1f)"), 
-           *EntityName, MaxHealth, CurrentHealth);
+           *EntityName, GetMaxHealth(), GetCurrentHealth());
 }
 
 bool UBaseEntity::IsEntityValid() const
 {
-    return bEntityInitialized && bIsSpawned && bIsActive;
+    return bEntityInitialized && IsSpawned() && IsActive();
 }
 
 float UBaseEntity::GetHealthPercentage() const
 {
+    const float MaxHealth = GetMaxHealth();
     if (MaxHealth <= 0.0f)
     {
         return 0.0f;
     }
-    return (CurrentHealth / MaxHealth) * 100.0f;
+    return (GetCurrentHealth() / MaxHealth) * 100.0f;
 }
 
 float UBaseEntity::GetDistanceToLocation(const FVector& TargetLocation) const
 {
-    return FVector::Dist(WorldPosition, TargetLocation);
+    return FVector::Dist(GetWorldPosition(), TargetLocation);
 }
 
 float UBaseEntity::GetDistanceToEntity(const UBaseEntity* OtherEntity) const
@@ -382,7 +431,7 @@ float UBaseEntity::GetDistanceToEntity(const UBaseEntity* OtherEntity) const
     {
         return -1.0f;
     }
-    return GetDistanceToLocation(OtherEntity->WorldPosition);
+    return GetDistanceToLocation(OtherEntity->GetWorldPosition());
 }
 
 void UBaseEntity::UpdateEntity(float DeltaTime)
@@ -392,7 +441,7 @@ void UBaseEntity::UpdateEntity(float DeltaTime)
         return;
     }
     
-    StateTimer += DeltaTime;
+    HotField(&FEntityStateArrays::StateTimers, &FEntityHotStateRow::StateTimer) += DeltaTime;
     LastUpdateTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 }
 
@@ -434,9 +483,9 @@ bool UBaseEntity::ValidateEntityData() const
         return false;
     }
     
-    if (MaxHealth <= 0.0f)
+    if (GetMaxHealth() <= 0.0f)
     {
-        UE_LOG(LogTemp, Warning, TEXT("BaseEntity: Entity %s has invalid max health: %.1f"), *EntityName, MaxHealth);
+        UE_LOG(LogTemp, Warning, TEXT("BaseEntity: Entity %s has invalid max health: %.1f"), *EntityName, GetMaxHealth());
         return false;
     }
     
@@ -4,8 +4,11 @@
 #include "UObject/NoExportTypes.h"
 #include "Engine/Engine.h"
 #include "Core/Enums/GameWorldEnums.h"
+#include "EntityStateArrays.h"
 #include "BaseEntity.generated.h"
 
+class UEntityRegistrySubsystem;
+
 /**
  * Base Entity class that serves as foundation for all game entities
  * This provides common functionality for Peds, Vehicles, and WorldObjects
@@ -20,9 +23,8 @@ public:
     UBaseEntity();
     virtual ~UBaseEntity();
 
-private:
-    // Static ID counter for generating unique entity IDs
-    static int32 NextEntityID;
+    // UObject interface
+    virtual void BeginDestroy() override;
 
 public:
     // ========== IDENTITY SYSTEM ==========
@@ -45,7 +47,7 @@ public:
     FString DisplayName; // For UI and debugging (e.g., "Player Niko")
 
     UPROPERTY(EditAnywhere, Category = "Entity Identity")
-    FString UniqueRuntimeID; // Combination ID for cross-system lookup
+    uint64 UniqueRuntimeID; // Session-unique: generation in the high 32 bits, EntityID in the low 32
 
     // Actor Reference (set by owning actor)
     UPROPERTY(EditAnywhere, Category = "Entity Identity")
@@ -53,45 +55,68 @@ public:
 
     // Search and Classification Tags
     UPROPERTY(EditAnywhere, Category = "Entity Identity")
-    TArray<FString> SearchTags; // For queries ["Player", "Niko", "Human", etc.]
+    TArray<FName> SearchTags; // For queries ["Player", "Niko", "Human", etc.]; mirrored into the entity registry
 
     // ========== ENTITY STATE ==========
+    // While registered, health, spatial and state values live in the registry's SoA columns;
+    // otherwise in DetachedState. These accessors read whichever copy is current.
 
     // Health & Status
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
-    float MaxHealth;
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Health")
+    float GetMaxHealth() const { return HotField(&FEntityStateArrays::MaxHealth, &FEntityHotStateRow::MaxHealth); }
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Health")
+    float GetCurrentHealth() const { return HotField(&FEntityStateArrays::Health, &FEntityHotStateRow::CurrentHealth); }
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Health")
+    bool IsActive() const { return HotField(&FEntityStateArrays::Active, &FEntityHotStateRow::bIsActive); }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
-    float CurrentHealth;
+    UFUNCTION(BlueprintCallable, Category = "Entity Health")
+    void SetActive(bool bActive) { HotField(&FEntityStateArrays::Active, &FEntityHotStateRow::bIsActive) = bActive; }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
-    bool bIsActive;
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Health")
+    bool IsSpawned() const { return HotField(&FEntityStateArrays::Spawned, &FEntityHotStateRow::bIsSpawned); }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
-    bool bIsSpawned;
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Health")
+    bool IsAlive() const { return HotField(&FEntityStateArrays::Alive, &FEntityHotStateRow::bIsAlive); }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
-    bool bIsAlive;
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Health")
+    bool IsInvulnerable() const { return HotField(&FEntityStateArrays::Invulnerable, &FEntityHotStateRow::bIsInvulnerable); }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
-    bool bIsInvulnerable;
+    UFUNCTION(BlueprintCallable, Category = "Entity Health")
+    void SetInvulnerable(bool bInvulnerable) { HotField(&FEntityStateArrays::Invulnerable, &FEntityHotStateRow::bIsInvulnerable) = bInvulnerable; }
 
     // Spatial Properties
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Spatial")
-    FVector WorldPosition;
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Spatial")
+    FVector GetWorldPosition() const { return HotField(&FEntityStateArrays::Positions, &FEntityHotStateRow::WorldPosition); }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Spatial")
-    FRotator WorldRotation;
+    UFUNCTION(BlueprintCallable, Category = "Entity Spatial")
+    void SetWorldPosition(const FVector& NewPosition) { HotField(&FEntityStateArrays::Positions, &FEntityHotStateRow::WorldPosition) = NewPosition; }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Spatial")
-    FVector WorldScale;
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Spatial")
+    FRotator GetWorldRotation() const { return HotField(&FEntityStateArrays::Rotations, &FEntityHotStateRow::WorldRotation); }
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Spatial")
+    void SetWorldRotation(const FRotator& NewRotation) { HotField(&FEntityStateArrays::Rotations, &FEntityHotStateRow::WorldRotation) = NewRotation; }
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity Spatial")
+    FVector GetWorldScale() const { return HotField(&FEntityStateArrays::Scales, &FEntityHotStateRow::WorldScale); }
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Spatial")
+    void SetWorldScale(const FVector& NewScale) { HotField(&FEntityStateArrays::Scales, &FEntityHotStateRow::WorldScale) = NewScale; }
 
     // Entity State
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity State")
-    EEntityState CurrentState;
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity State")
+    EEntityState GetEntityState() const { return HotField(&FEntityStateArrays::States, &FEntityHotStateRow::CurrentState); }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity State")
-    float StateTimer;
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity State")
+    EEntityState GetPreviousEntityState() const { return HotField(&FEntityStateArrays::PreviousStates, &FEntityHotStateRow::PreviousState); }
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Entity State")
+    float GetStateTimer() const { return HotField(&FEntityStateArrays::StateTimers, &FEntityHotStateRow::StateTimer); }
+
+    /** Registry slot while registered, INDEX_NONE otherwise; indexes the registry's state columns */
+    int32 GetRegistrySlot() const { return StateArrays ? RegistrySlot : INDEX_NONE; }
 
     // ========== IDENTITY MANAGEMENT FUNCTIONS ==========
 
@@ -106,12 +131,15 @@ public:
 
     // Add search tags for entity queries
     UFUNCTION(BlueprintCallable, Category = "Entity Identity")
-    void AddSearchTag(const FString& Tag);
+    void AddSearchTag(FName Tag);
 
-    void AddSearchTags(const TArray<FString>& Tags);
+    void AddSearchTags(const TArray<FName>& Tags);
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Identity")
+    void RemoveSearchTag(FName Tag);
 
     // Query functions
-    bool HasSearchTag(const FString& Tag) const;
+    bool HasSearchTag(FName Tag) const;
 
     FString GetFullDisplayName() const; // e.g., "Player Niko"
 
@@ -180,9 +208,38 @@ protected:
     bool ValidateEntityData() const;
     void LogEntityStatus(const FString& Message) const;
 
+    // Defaults, and the live values while the entity isn't registered with a world
+    UPROPERTY(EditAnywhere, Category = "Entity State")
+    FEntityHotStateRow DetachedState;
+
 private:
+    friend class UEntityRegistrySubsystem;
+    friend class UEntityUpdateSubsystem;
+
+    /** Registered: the slot's element of Column; unregistered: the DetachedState field */
+    template<typename T>
+    FORCEINLINE T& HotField(TArray<T> FEntityStateArrays::* Column, T FEntityHotStateRow::* Field)
+    {
+        return StateArrays ? (StateArrays->*Column)[RegistrySlot] : DetachedState.*Field;
+    }
+
+    template<typename T>
+    FORCEINLINE const T& HotField(TArray<T> FEntityStateArrays::* Column, T FEntityHotStateRow::* Field) const
+    {
+        return StateArrays ? (StateArrays->*Column)[RegistrySlot] : DetachedState.*Field;
+    }
+
     // Internal state tracking
-    EEntityState PreviousState;
     float LastUpdateTime;
     bool bEntityInitialized;
+
+    // ID taken from FEntityIDAllocator at construction; released on destroy even if EntityID is overwritten
+    int32 AllocatedEntityID;
+
+    // Entity registry membership, set by UEntityRegistrySubsystem
+    TWeakObjectPtr<UEntityRegistrySubsystem> Registry;
+    int32 RegistrySlot;
+
+    /** The registry's state columns while registered; cleared by the registry before it goes away */
+    FEntityStateArrays* StateArrays;
 };
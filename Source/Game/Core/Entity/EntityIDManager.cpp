@@ -1,152 +1,747 @@
 #include "EntityIDManager.h"
 #include "Engine/World.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
 
 // Static instance initialization
 UEntityIDManager* UEntityIDManager::Instance = nullptr;
 
-UEntityIDManager::UEntityIDManager()
+// === FEntityIDBitmap ===
+
+namespace EntityIDBitmap
 {
-    // Initialize default values
-    CurrentIDCounter = 1; // Start from 1, reserve 0 for "Invalid"
-    MinEntityID = 1;
-    MaxEntityID = 999999999; // Allow up to ~1 billion entities
-    ReservedEntityIDs.Empty();
+    /** Mask of bits [First, First + Count) within one word */
+    FORCEINLINE uint64 RangeMask(int32 First, int32 Count)
+    {
+        return Count >= 64 ? ~0ull : (((1ull << Count) - 1) << First);
+    }
+
+    /** Clear bits at or above NumValidBits in the last word of a summary level */
+    void TrimSummary(TArray<uint64>& Level, int32 NumValidBits)
+    {
+        Level.SetNum((NumValidBits + 63) >> 6);
+        if (Level.Num() > 0 && (NumValidBits & 63) != 0)
+        {
+            Level.Last() &= RangeMask(0, NumValidBits & 63);
+        }
+    }
 }
 
-UEntityIDManager* UEntityIDManager::GetInstance()
+FEntityIDBitmap::FEntityIDBitmap()
 {
-    if (!Instance)
+    NumBits = 0;
+    NumTaken = 0;
+}
+
+void FEntityIDBitmap::Reset()
+{
+    Words.Empty();
+    FreeWords.Empty();
+    FreeSummary.Empty();
+    NumBits = 0;
+    NumTaken = 0;
+}
+
+int32 FEntityIDBitmap::FindFirstFree() const
+{
+    for (int32 SummaryIndex = 0; SummaryIndex < FreeSummary.Num(); ++SummaryIndex)
     {
-        Instance = NewObject<UEntityIDManager>();
-        Instance->AddToRoot(); // Prevent garbage collection
+        if (FreeSummary[SummaryIndex] != 0)
+        {
+            const int32 FreeWordIndex = (SummaryIndex << 6) + (int32)FMath::CountTrailingZeros64(FreeSummary[SummaryIndex]);
+            const int32 WordIndex = (FreeWordIndex << 6) + (int32)FMath::CountTrailingZeros64(FreeWords[FreeWordIndex]);
+            return (WordIndex << 6) + (int32)FMath::CountTrailingZeros64(~Words[WordIndex]);
+        }
     }
-    return Instance;
+    return INDEX_NONE;
 }
 
-int32 UEntityIDManager::GenerateNewEntityID()
+int32 FEntityIDBitmap::FindLastTaken() const
 {
-    // Find next available ID starting from current counter
-    int32 NewID = FindNextAvailableID(CurrentIDCounter);
-    
-    if (NewID > MaxEntityID)
+    for (int32 WordIndex = Words.Num() - 1; WordIndex >= 0; --WordIndex)
     {
-        // Wrap around and search from the beginning
-        NewID = FindNextAvailableID(MinEntityID);
-        
-        if (NewID > MaxEntityID)
+        uint64 Word = Words[WordIndex];
+        if (WordIndex == Words.Num() - 1 && (NumBits & 63) != 0)
         {
-            UE_LOG(LogTemp, Error, TEXT("EntityIDManager: No available Entity IDs! All %d IDs are taken."), MaxEntityID - MinEntityID + 1);
-            return 0; // Return invalid ID
+            Word &= EntityIDBitmap::RangeMask(0, NumBits & 63);
+        }
+        if (Word != 0)
+        {
+            return (WordIndex << 6) + 63 - (int32)FMath::CountLeadingZeros64(Word);
         }
     }
+    return INDEX_NONE;
+}
 
-    // Reserve the ID and update counter
-    ReservedEntityIDs.Add(NewID);
-    CurrentIDCounter = NewID + 1;
+void FEntityIDBitmap::SetTaken(int32 Index)
+{
+    check(Index >= 0 && Index < NumBits && !IsTaken(Index));
 
-    UE_LOG(LogTemp, VeryVerbose, TEXT("EntityIDManager: Generated new Entity ID: %d"), NewID);
-    return NewID;
+    const int32 WordIndex = Index >> 6;
+    Words[WordIndex] |= 1ull << (Index & 63);
+    ++NumTaken;
+
+    if (Words[WordIndex] == ~0ull)
+    {
+        UpdateSummary(WordIndex);
+    }
 }
 
-void UEntityIDManager::ReserveEntityID(int32 EntityID)
+void FEntityIDBitmap::SetFree(int32 Index)
 {
-    if (!IsIDInValidRange(EntityID))
+    check(Index >= 0 && Index < NumBits && IsTaken(Index));
+
+    const int32 WordIndex = Index >> 6;
+    const bool bWasFull = Words[WordIndex] == ~0ull;
+    Words[WordIndex] &= ~(1ull << (Index & 63));
+    --NumTaken;
+
+    if (bWasFull)
+    {
+        UpdateSummary(WordIndex);
+    }
+}
+
+void FEntityIDBitmap::Grow(int32 NewNumBits)
+{
+    if (NewNumBits <= NumBits)
     {
-        UE_LOG(LogTemp, Warning, TEXT("EntityIDManager: Attempted to reserve Entity ID %d which is outside valid range [%d, %d]"), 
-               EntityID, MinEntityID, MaxEntityID);
         return;
     }
 
-    if (ReservedEntityIDs.Contains(EntityID))
+    const int32 OldNumBits = NumBits;
+    const int32 NumWords = (NewNumBits + 63) >> 6;
+    while (Words.Num() < NumWords)
+    {
+        Words.Add(~0ull);
+    }
+    FreeWords.SetNumZeroed((NumWords + 63) >> 6);
+    FreeSummary.SetNumZeroed((FreeWords.Num() + 63) >> 6);
+    NumBits = NewNumBits;
+
+    // Clear the padding over the newly covered range, one word at a time
+    for (int32 Bit = OldNumBits; Bit < NewNumBits; Bit = ((Bit >> 6) + 1) << 6)
+    {
+        const int32 WordIndex = Bit >> 6;
+        const int32 First = Bit & 63;
+        const int32 Count = FMath::Min(64, NewNumBits - (WordIndex << 6)) - First;
+        Words[WordIndex] &= ~EntityIDBitmap::RangeMask(First, Count);
+        UpdateSummary(WordIndex);
+    }
+}
+
+void FEntityIDBitmap::Shrink(int32 NewNumBits)
+{
+    NewNumBits = FMath::Max(NewNumBits, 0);
+    if (NewNumBits >= NumBits)
     {
-        UE_LOG(LogTemp, Warning, TEXT("EntityIDManager: Entity ID %d is already reserved"), EntityID);
         return;
     }
 
-    ReservedEntityIDs.Add(EntityID);
-    UE_LOG(LogTemp, VeryVerbose, TEXT("EntityIDManager: Reserved Entity ID: %d"), EntityID);
+    const int32 NumWords = (NewNumBits + 63) >> 6;
+    Words.SetNum(NumWords);
+    NumBits = NewNumBits;
+
+    EntityIDBitmap::TrimSummary(FreeWords, NumWords);
+    EntityIDBitmap::TrimSummary(FreeSummary, FreeWords.Num());
+
+    if ((NewNumBits & 63) != 0)
+    {
+        Words.Last() |= ~EntityIDBitmap::RangeMask(0, NewNumBits & 63);
+    }
+    if (NumWords > 0)
+    {
+        UpdateSummary(NumWords - 1);
+    }
 }
 
-bool UEntityIDManager::IsEntityIDTaken(int32 EntityID) const
+void FEntityIDBitmap::GetTakenIndices(TArray<int32>& OutIndices) const
 {
-    return ReservedEntityIDs.Contains(EntityID);
+    OutIndices.Reserve(OutIndices.Num() + NumTaken);
+    for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+    {
+        uint64 Word = Words[WordIndex];
+        if (WordIndex == Words.Num() - 1 && (NumBits & 63) != 0)
+        {
+            Word &= EntityIDBitmap::RangeMask(0, NumBits & 63);
+        }
+        while (Word != 0)
+        {
+            OutIndices.Add((WordIndex << 6) + (int32)FMath::CountTrailingZeros64(Word));
+            Word &= Word - 1;
+        }
+    }
 }
 
-void UEntityIDManager::ReleaseEntityID(int32 EntityID)
+void FEntityIDBitmap::UpdateSummary(int32 WordIndex)
 {
-    if (ReservedEntityIDs.Remove(EntityID))
+    const int32 FreeWordIndex = WordIndex >> 6;
+    const uint64 FreeBit = 1ull << (WordIndex & 63);
+    if (Words[WordIndex] != ~0ull)
+    {
+        FreeWords[FreeWordIndex] |= FreeBit;
+    }
+    else
+    {
+        FreeWords[FreeWordIndex] &= ~FreeBit;
+    }
+
+    const uint64 SummaryBit = 1ull << (FreeWordIndex & 63);
+    if (FreeWords[FreeWordIndex] != 0)
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("EntityIDManager: Released Entity ID: %d"), EntityID);
+        FreeSummary[FreeWordIndex >> 6] |= SummaryBit;
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("EntityIDManager: Attempted to release Entity ID %d that was not reserved"), EntityID);
+        FreeSummary[FreeWordIndex >> 6] &= ~SummaryBit;
     }
 }
 
-void UEntityIDManager::SetIDRange(int32 MinID, int32 MaxID)
+// === FEntityIDAllocator ===
+
+/**
+ * IDs a thread has claimed from the shared pool but not handed out yet
+ * A slot is emptied (set to 0) by whichever side takes it first: the owning thread issuing the ID, or
+ * the allocator revoking it under the lock. Next and Num are only touched by the owning thread.
+ */
+struct FEntityIDThreadBlock
+{
+    std::atomic<int32> IDs[FEntityIDAllocator::AllocationBatchSize] = {};
+    int32 Next = 0;
+    int32 Num = 0;
+    bool bRegistered = false;
+
+    ~FEntityIDThreadBlock();
+};
+
+namespace EntityIDAllocator
 {
+    /** Cleared when the allocator is destroyed so late thread exits don't touch it */
+    std::atomic<bool> bAllocatorAlive(false);
+
+    thread_local FEntityIDThreadBlock ThreadBlock;
+}
+
+FEntityIDThreadBlock::~FEntityIDThreadBlock()
+{
+    // Hand unused IDs back when the thread exits
+    if (bRegistered && EntityIDAllocator::bAllocatorAlive.load(std::memory_order_acquire))
+    {
+        FEntityIDAllocator::Get().UnregisterThreadBlock(*this);
+    }
+}
+
+FEntityIDAllocator& FEntityIDAllocator::Get()
+{
+    static FEntityIDAllocator Allocator;
+    return Allocator;
+}
+
+FEntityIDAllocator::FEntityIDAllocator()
+{
+    MinEntityID = 1; // Start from 1, reserve 0 for "Invalid"
+    MaxEntityID = 999999999; // Allow up to ~1 billion entities
+    EntityIDAllocator::bAllocatorAlive.store(true, std::memory_order_release);
+}
+
+FEntityIDAllocator::~FEntityIDAllocator()
+{
+    EntityIDAllocator::bAllocatorAlive.store(false, std::memory_order_release);
+}
+
+int32 FEntityIDAllocator::Allocate()
+{
+    FEntityIDThreadBlock& Block = EntityIDAllocator::ThreadBlock;
+    while (true)
+    {
+        // Slots revoked by SetRange/Clear read as 0 and are skipped; the allocator already took those IDs back
+        while (Block.Next < Block.Num)
+        {
+            const int32 NewID = Block.IDs[Block.Next++].exchange(0, std::memory_order_acq_rel);
+            if (NewID != 0)
+            {
+                UE_LOG(LogTemp, VeryVerbose, TEXT("EntityIDManager: Generated new Entity ID: %d"), NewID);
+                return NewID;
+            }
+        }
+
+        Block.Next = 0;
+        Block.Num = ClaimBatch(Block);
+        if (Block.Num == 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("EntityIDManager: No available Entity IDs! All %d IDs are taken."), GetMaxID() - GetMinID() + 1);
+            return 0; // Return invalid ID
+        }
+    }
+}
+
+void FEntityIDAllocator::Release(int32 EntityID)
+{
+    if (EntityID != 0)
+    {
+        PendingReleases.Enqueue(EntityID);
+    }
+}
+
+bool FEntityIDAllocator::Reserve(int32 EntityID)
+{
+    FScopeLock ScopeLock(&Lock);
+    return ReserveLocked(EntityID);
+}
+
+bool FEntityIDAllocator::IsTaken(int32 EntityID) const
+{
+    FScopeLock ScopeLock(&Lock);
+    return IsTakenLocked(EntityID);
+}
+
+int32 FEntityIDAllocator::GetNextAvailableID() const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    const int32 Index = IDBitmap.FindFirstFree();
+    if (Index != INDEX_NONE)
+    {
+        return MinEntityID + Index;
+    }
+
+    // Next ID past the high-water mark, skipping distant reservations that sit right on it
+    int32 NextID = MinEntityID + IDBitmap.Num();
+    while (NextID <= MaxEntityID && DistantReservedIDs.Contains(NextID))
+    {
+        ++NextID;
+    }
+    return NextID <= MaxEntityID ? NextID : 0;
+}
+
+int32 FEntityIDAllocator::GetNumTaken() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return IDBitmap.GetNumTaken() + DistantReservedIDs.Num();
+}
+
+int32 FEntityIDAllocator::GetMinID() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return MinEntityID;
+}
+
+int32 FEntityIDAllocator::GetMaxID() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return MaxEntityID;
+}
+
+int32 FEntityIDAllocator::GetHighWaterMark() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return MinEntityID + IDBitmap.Num();
+}
+
+void FEntityIDAllocator::ReclaimReleasedIDs()
+{
+    check(IsInGameThread());
+    if (PendingReleases.IsEmpty())
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    int32 EntityID;
+    while (PendingReleases.Dequeue(EntityID))
+    {
+        if (ReleaseLocked(EntityID))
+        {
+            UE_LOG(LogTemp, VeryVerbose, TEXT("EntityIDManager: Released Entity ID: %d"), EntityID);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("EntityIDManager: Attempted to release Entity ID %d that was not reserved"), EntityID);
+        }
+    }
+}
+
+bool FEntityIDAllocator::SetRange(int32 MinID, int32 MaxID)
+{
+    check(IsInGameThread());
     if (MinID >= MaxID)
     {
         UE_LOG(LogTemp, Error, TEXT("EntityIDManager: Invalid ID range: Min (%d) must be less than Max (%d)"), MinID, MaxID);
-        return;
+        return false;
     }
 
+    ReclaimReleasedIDs();
+
+    FScopeLock ScopeLock(&Lock);
+
+    // IDs claimed by threads but never issued go back to the pool instead of being carried over
+    TArray<int32> UnissuedIDs;
+    RevokeThreadBlocksLocked(UnissuedIDs);
+    for (int32 EntityID : UnissuedIDs)
+    {
+        ReleaseLocked(EntityID);
+    }
+
+    // The bitmap is indexed relative to MinEntityID, so rebuild it from the live IDs
+    TArray<int32> LiveIndices;
+    IDBitmap.GetTakenIndices(LiveIndices);
+    const int32 OldMinEntityID = MinEntityID;
+    const TSet<int32> OldDistantIDs = MoveTemp(DistantReservedIDs);
+
+    IDBitmap.Reset();
+    DistantReservedIDs.Reset();
     MinEntityID = MinID;
     MaxEntityID = MaxID;
-    
-    // Ensure current counter is within valid range
-    if (CurrentIDCounter < MinEntityID)
+
+    int32 NumDropped = 0;
+    auto Rereserve = [this, &NumDropped](int32 EntityID)
     {
-        CurrentIDCounter = MinEntityID;
+        if (IsIDInValidRange(EntityID))
+        {
+            ReserveLocked(EntityID);
+        }
+        else
+        {
+            ++NumDropped;
+        }
+    };
+
+    for (int32 Index : LiveIndices)
+    {
+        Rereserve(OldMinEntityID + Index);
     }
-    else if (CurrentIDCounter > MaxEntityID)
+    for (int32 EntityID : OldDistantIDs)
+    {
+        Rereserve(EntityID);
+    }
+
+    if (NumDropped > 0)
     {
-        CurrentIDCounter = MinEntityID;
+        UE_LOG(LogTemp, Warning, TEXT("EntityIDManager: %d reserved Entity IDs fall outside the new range and were released"), NumDropped);
     }
 
     UE_LOG(LogTemp, Log, TEXT("EntityIDManager: Set ID range to [%d, %d]"), MinEntityID, MaxEntityID);
+    return true;
 }
 
-int32 UEntityIDManager::GetNextAvailableID() const
+void FEntityIDAllocator::TrimToHighestTaken()
 {
-    return FindNextAvailableID(CurrentIDCounter);
+    check(IsInGameThread());
+    ReclaimReleasedIDs();
+
+    // IDs are always handed out lowest-first, so the bitmap can be trimmed back to the highest live ID
+    FScopeLock ScopeLock(&Lock);
+    const int32 LastTaken = IDBitmap.FindLastTaken();
+    IDBitmap.Shrink(Align(LastTaken + 1, BitmapChunkSize));
+    UE_LOG(LogTemp, Log, TEXT("EntityIDManager: Reset ID counter to %d"), MinEntityID + IDBitmap.Num());
 }
 
-int32 UEntityIDManager::GetTotalActiveEntities() const
+int32 FEntityIDAllocator::Clear()
 {
-    return ReservedEntityIDs.Num();
+    check(IsInGameThread());
+
+    // Releases queued before the clear refer to IDs that no longer exist
+    int32 EntityID;
+    while (PendingReleases.Dequeue(EntityID))
+    {
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    TArray<int32> UnissuedIDs;
+    RevokeThreadBlocksLocked(UnissuedIDs);
+
+    const int32 PreviousCount = IDBitmap.GetNumTaken() + DistantReservedIDs.Num() - UnissuedIDs.Num();
+    IDBitmap.Reset();
+    DistantReservedIDs.Empty();
+    return PreviousCount;
 }
 
-void UEntityIDManager::ResetIDCounter()
+void FEntityIDAllocator::ExportState(int32& OutMinID, int32& OutMaxID, TArray<int32>& OutTakenIDs) const
 {
-    CurrentIDCounter = MinEntityID;
-    UE_LOG(LogTemp, Log, TEXT("EntityIDManager: Reset ID counter to %d"), CurrentIDCounter);
+    FScopeLock ScopeLock(&Lock);
+    OutMinID = MinEntityID;
+    OutMaxID = MaxEntityID;
+
+    const int32 StartNum = OutTakenIDs.Num();
+    IDBitmap.GetTakenIndices(OutTakenIDs);
+    for (int32 i = StartNum; i < OutTakenIDs.Num(); ++i)
+    {
+        OutTakenIDs[i] += MinEntityID;
+    }
+    OutTakenIDs.Append(DistantReservedIDs.Array());
+
+    // IDs cached in thread blocks are taken in the bitmap but belong to no entity yet
+    TSet<int32> UnissuedIDs;
+    for (const FEntityIDThreadBlock* Block : ThreadBlocks)
+    {
+        for (const std::atomic<int32>& Slot : Block->IDs)
+        {
+            const int32 EntityID = Slot.load(std::memory_order_acquire);
+            if (EntityID != 0)
+            {
+                UnissuedIDs.Add(EntityID);
+            }
+        }
+    }
+    if (UnissuedIDs.Num() > 0)
+    {
+        for (int32 i = OutTakenIDs.Num() - 1; i >= StartNum; --i)
+        {
+            if (UnissuedIDs.Contains(OutTakenIDs[i]))
+            {
+                OutTakenIDs.RemoveAt(i, EAllowShrinking::No);
+            }
+        }
+    }
 }
 
-void UEntityIDManager::ClearAllReservedIDs()
+bool FEntityIDAllocator::ImportState(int32 MinID, int32 MaxID, TArrayView<const int32> TakenIDs)
 {
-    int32 PreviousCount = ReservedEntityIDs.Num();
-    ReservedEntityIDs.Empty();
-    CurrentIDCounter = MinEntityID;
-    UE_LOG(LogTemp, Log, TEXT("EntityIDManager: Cleared %d reserved Entity IDs"), PreviousCount);
+    check(IsInGameThread());
+    if (MinID >= MaxID)
+    {
+        UE_LOG(LogTemp, Error, TEXT("EntityIDManager: Invalid ID range: Min (%d) must be less than Max (%d)"), MinID, MaxID);
+        return false;
+    }
+
+    Clear();
+
+    FScopeLock ScopeLock(&Lock);
+    MinEntityID = MinID;
+    MaxEntityID = MaxID;
+
+    int32 NumRejected = 0;
+    for (int32 EntityID : TakenIDs)
+    {
+        if (!IsIDInValidRange(EntityID) || IsTakenLocked(EntityID))
+        {
+            ++NumRejected;
+            continue;
+        }
+        ReserveLocked(EntityID);
+    }
+
+    if (NumRejected > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("EntityIDManager: %d saved Entity IDs were out of range or duplicated"), NumRejected);
+    }
+    return true;
+}
+
+int32 FEntityIDAllocator::ClaimBatch(FEntityIDThreadBlock& Block)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    if (!Block.bRegistered)
+    {
+        ThreadBlocks.Add(&Block);
+        Block.bRegistered = true;
+    }
+
+    int32 Count = 0;
+    while (Count < AllocationBatchSize)
+    {
+        const int32 NewID = AllocateLocked();
+        if (NewID == 0)
+        {
+            break;
+        }
+        Block.IDs[Count++].store(NewID, std::memory_order_release);
+    }
+    return Count;
+}
+
+void FEntityIDAllocator::UnregisterThreadBlock(FEntityIDThreadBlock& Block)
+{
+    FScopeLock ScopeLock(&Lock);
+    ThreadBlocks.RemoveSwap(&Block, EAllowShrinking::No);
+    Block.bRegistered = false;
+
+    // Never issued, so they can go straight back rather than waiting for ReclaimReleasedIDs
+    for (std::atomic<int32>& Slot : Block.IDs)
+    {
+        const int32 EntityID = Slot.exchange(0, std::memory_order_acq_rel);
+        if (EntityID != 0)
+        {
+            ReleaseLocked(EntityID);
+        }
+    }
+}
+
+void FEntityIDAllocator::RevokeThreadBlocksLocked(TArray<int32>& OutIDs)
+{
+    for (FEntityIDThreadBlock* Block : ThreadBlocks)
+    {
+        for (std::atomic<int32>& Slot : Block->IDs)
+        {
+            const int32 EntityID = Slot.exchange(0, std::memory_order_acq_rel);
+            if (EntityID != 0)
+            {
+                OutIDs.Add(EntityID);
+            }
+        }
+    }
+}
+
+int32 FEntityIDAllocator::AllocateLocked()
+{
+    // Lowest released ID first; only grow the bitmap when every covered ID is taken
+    int32 Index = IDBitmap.FindFirstFree();
+    while (Index == INDEX_NONE)
+    {
+        if (!GrowBitmap(IDBitmap.Num() + 1))
+        {
+            return 0;
+        }
+        Index = IDBitmap.FindFirstFree();
+    }
+
+    IDBitmap.SetTaken(Index);
+    return MinEntityID + Index;
+}
+
+bool FEntityIDAllocator::ReserveLocked(int32 EntityID)
+{
+    if (!IsIDInValidRange(EntityID))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("EntityIDManager: Attempted to reserve Entity ID %d which is outside valid range [%d, %d]"),
+               EntityID, MinEntityID, MaxEntityID);
+        return false;
+    }
+
+    if (IsTakenLocked(EntityID))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("EntityIDManager: Entity ID %d is already reserved"), EntityID);
+        return false;
+    }
+
+    const int32 Index = EntityID - MinEntityID;
+    if (Index >= IDBitmap.Num())
+    {
+        // Far-off fixed IDs stay out of the bitmap so one reservation can't balloon it
+        if (Index - IDBitmap.Num() >= MaxBitmapJump)
+        {
+            DistantReservedIDs.Add(EntityID);
+            UE_LOG(LogTemp, VeryVerbose, TEXT("EntityIDManager: Reserved Entity ID: %d"), EntityID);
+            return true;
+        }
+        GrowBitmap(Index + 1);
+    }
+
+    IDBitmap.SetTaken(Index);
+    UE_LOG(LogTemp, VeryVerbose, TEXT("EntityIDManager: Reserved Entity ID: %d"), EntityID);
+    return true;
 }
 
-bool UEntityIDManager::IsIDInValidRange(int32 EntityID) const
+bool FEntityIDAllocator::ReleaseLocked(int32 EntityID)
 {
-    return EntityID >= MinEntityID && EntityID <= MaxEntityID;
+    const int32 Index = EntityID - MinEntityID;
+    if (IsIDInValidRange(EntityID) && Index < IDBitmap.Num() && IDBitmap.IsTaken(Index))
+    {
+        IDBitmap.SetFree(Index);
+        return true;
+    }
+    return DistantReservedIDs.Remove(EntityID) > 0;
 }
 
-int32 UEntityIDManager::FindNextAvailableID(int32 StartID) const
+bool FEntityIDAllocator::IsTakenLocked(int32 EntityID) const
 {
-    for (int32 ID = StartID; ID <= MaxEntityID; ++ID)
+    if (!IsIDInValidRange(EntityID))
     {
-        if (!ReservedEntityIDs.Contains(ID))
+        return false;
+    }
+
+    const int32 Index = EntityID - MinEntityID;
+    return Index < IDBitmap.Num() ? IDBitmap.IsTaken(Index) : DistantReservedIDs.Contains(EntityID);
+}
+
+bool FEntityIDAllocator::GrowBitmap(int32 MinNumBits)
+{
+    const int64 RangeSize = (int64)MaxEntityID - MinEntityID + 1;
+    if (IDBitmap.Num() >= RangeSize)
+    {
+        return false;
+    }
+
+    const int32 OldNumBits = IDBitmap.Num();
+    const int32 NewNumBits = (int32)FMath::Min<int64>(Align((int64)MinNumBits, BitmapChunkSize), RangeSize);
+    IDBitmap.Grow(NewNumBits);
+
+    // Fold in distant reservations the bitmap now covers
+    if (DistantReservedIDs.Num() > 0)
+    {
+        for (auto It = DistantReservedIDs.CreateIterator(); It; ++It)
         {
-            return ID;
+            const int32 Index = *It - MinEntityID;
+            if (Index >= OldNumBits && Index < NewNumBits)
+            {
+                IDBitmap.SetTaken(Index);
+                It.RemoveCurrent();
+            }
         }
     }
-    
-    // No available ID found in range
-    return MaxEntityID + 1; // Return out-of-range value to indicate failure
+    return true;
+}
+
+// === UEntityIDManager ===
+
+UEntityIDManager::UEntityIDManager()
+{
+}
+
+UEntityIDManager* UEntityIDManager::GetInstance()
+{
+    check(IsInGameThread());
+    if (!Instance)
+    {
+        Instance = NewObject<UEntityIDManager>();
+        Instance->AddToRoot(); // Prevent garbage collection
+    }
+    return Instance;
+}
+
+int32 UEntityIDManager::GenerateNewEntityID()
+{
+    return FEntityIDAllocator::Get().Allocate();
+}
+
+void UEntityIDManager::ReserveEntityID(int32 EntityID)
+{
+    FEntityIDAllocator::Get().Reserve(EntityID);
+}
+
+bool UEntityIDManager::IsEntityIDTaken(int32 EntityID) const
+{
+    return FEntityIDAllocator::Get().IsTaken(EntityID);
+}
+
+void UEntityIDManager::ReleaseEntityID(int32 EntityID)
+{
+    FEntityIDAllocator::Get().Release(EntityID);
+}
+
+void UEntityIDManager::SetIDRange(int32 MinID, int32 MaxID)
+{
+    FEntityIDAllocator::Get().SetRange(MinID, MaxID);
+}
+
+int32 UEntityIDManager::GetNextAvailableID() const
+{
+    return FEntityIDAllocator::Get().GetNextAvailableID();
+}
+
+int32 UEntityIDManager::GetTotalActiveEntities() const
+{
+    return FEntityIDAllocator::Get().GetNumTaken();
+}
+
+void UEntityIDManager::ResetIDCounter()
+{
+    FEntityIDAllocator::Get().TrimToHighestTaken();
+}
+
+void UEntityIDManager::ClearAllReservedIDs()
+{
+    const int32 PreviousCount = FEntityIDAllocator::Get().Clear();
+    UE_LOG(LogTemp, Log, TEXT("EntityIDManager: Cleared %d reserved Entity IDs"), PreviousCount);
 }
@@ -2,11 +2,170 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
 #include "EntityIDManager.generated.h"
 
+struct FEntityIDThreadBlock;
+
 /**
- * Singleton class that manages unique Entity IDs across the entire game
- * Provides incremental ID generation for all entities
+ * Three-level occupancy bitmap used by FEntityIDAllocator
+ * Level 0 holds one bit per ID (1 = taken). A level 1 bit is set while its level 0 word still has a
+ * free ID, and a level 2 bit while its level 1 word is non-zero, so the lowest free ID is found with
+ * two count-trailing-zeros after a scan of the top level (4 words per million IDs).
+ * Bits past NumBits in the last word are kept set so they are never handed out.
+ */
+struct GAME_API FEntityIDBitmap
+{
+public:
+    FEntityIDBitmap();
+
+    void Reset();
+
+    /** Number of IDs covered; everything at or above is untracked */
+    int32 Num() const { return NumBits; }
+
+    int32 GetNumTaken() const { return NumTaken; }
+
+    bool IsTaken(int32 Index) const { return (Words[Index >> 6] >> (Index & 63)) & 1; }
+
+    /** Lowest free index, INDEX_NONE if every covered ID is taken */
+    int32 FindFirstFree() const;
+
+    /** Highest taken index, INDEX_NONE if none */
+    int32 FindLastTaken() const;
+
+    void SetTaken(int32 Index);
+    void SetFree(int32 Index);
+
+    /** Extend coverage; new IDs start free */
+    void Grow(int32 NewNumBits);
+
+    /** Drop coverage above NewNumBits; those IDs must be free */
+    void Shrink(int32 NewNumBits);
+
+    /** Append every taken index to OutIndices */
+    void GetTakenIndices(TArray<int32>& OutIndices) const;
+
+private:
+    void UpdateSummary(int32 WordIndex);
+
+    TArray<uint64> Words;
+    TArray<uint64> FreeWords;
+    TArray<uint64> FreeSummary;
+    int32 NumBits;
+    int32 NumTaken;
+};
+
+/**
+ * Entity ID Allocator
+ * The one source of entity IDs, safe to call from any thread. Each thread claims IDs from the shared
+ * bitmap in batches of AllocationBatchSize and hands them out from a thread-local block, so the
+ * common allocation touches no lock, only an uncontended atomic exchange on the thread's own block.
+ * SetRange/Clear revoke IDs still sitting in blocks and take them back, so a reset leaks none of them.
+ * Releases are queued lock-free and only return to the pool in ReclaimReleasedIDs, which the game
+ * module runs at the end of every frame; an ID released during a frame is never reused in the same frame.
+ * Counts include IDs sitting unused in thread blocks (at most AllocationBatchSize per thread).
+ */
+class GAME_API FEntityIDAllocator
+{
+public:
+    static FEntityIDAllocator& Get();
+
+    FEntityIDAllocator();
+    ~FEntityIDAllocator();
+
+    // === Any Thread ===
+
+    /** Next free ID, 0 once the range is exhausted */
+    int32 Allocate();
+
+    /** Queue an ID for reuse; it stays taken until the next ReclaimReleasedIDs */
+    void Release(int32 EntityID);
+
+    /** Mark a fixed ID as taken; false if it is out of range or already taken */
+    bool Reserve(int32 EntityID);
+
+    bool IsTaken(int32 EntityID) const;
+
+    int32 GetNextAvailableID() const;
+    int32 GetNumTaken() const;
+    int32 GetMinID() const;
+    int32 GetMaxID() const;
+
+    /** Lowest ID the bitmap doesn't cover yet */
+    int32 GetHighWaterMark() const;
+
+    // === Game Thread ===
+
+    /** Return queued releases to the pool */
+    void ReclaimReleasedIDs();
+
+    /** Rebuild the pool for a new range; IDs outside it are dropped and IDs cached in thread blocks are returned */
+    bool SetRange(int32 MinID, int32 MaxID);
+
+    /** Trim the bitmap back to the highest taken ID */
+    void TrimToHighestTaken();
+
+    /** Forget every taken ID and revoke IDs cached in thread blocks; returns the number of issued IDs forgotten */
+    int32 Clear();
+
+    /** Copy out the range and every issued or reserved ID; IDs cached unissued in thread blocks are left out */
+    void ExportState(int32& OutMinID, int32& OutMaxID, TArray<int32>& OutTakenIDs) const;
+
+    /** Replace the pool with a saved state; queued releases and thread blocks are discarded */
+    bool ImportState(int32 MinID, int32 MaxID, TArrayView<const int32> TakenIDs);
+
+    /** IDs a thread claims from the shared pool at once */
+    static constexpr int32 AllocationBatchSize = 64;
+
+private:
+    friend struct FEntityIDThreadBlock;
+
+    /** Refill a thread's block with up to AllocationBatchSize IDs under the lock, registering it on first use; returns the number claimed */
+    int32 ClaimBatch(FEntityIDThreadBlock& Block);
+
+    /** Called at thread exit: forget the block and return its unissued IDs */
+    void UnregisterThreadBlock(FEntityIDThreadBlock& Block);
+
+    /** Empty every registered block, appending the IDs they still held to OutIDs. Lock must be held */
+    void RevokeThreadBlocksLocked(TArray<int32>& OutIDs);
+
+    int32 AllocateLocked();
+    bool ReserveLocked(int32 EntityID);
+    bool ReleaseLocked(int32 EntityID);
+    bool IsTakenLocked(int32 EntityID) const;
+    bool IsIDInValidRange(int32 EntityID) const { return EntityID >= MinEntityID && EntityID <= MaxEntityID; }
+
+    /** Extend the bitmap by at least one chunk (up to MaxEntityID); false when the range is exhausted */
+    bool GrowBitmap(int32 MinNumBits);
+
+    mutable FCriticalSection Lock;
+
+    // Occupancy of [MinEntityID, MinEntityID + IDBitmap.Num())
+    FEntityIDBitmap IDBitmap;
+
+    // Fixed IDs reserved far above the high-water mark; folded into the bitmap once it grows past them
+    TSet<int32> DistantReservedIDs;
+
+    int32 MinEntityID;
+    int32 MaxEntityID;
+
+    /** Every thread block that has claimed IDs, so resets can revoke what they still hold */
+    TArray<FEntityIDThreadBlock*> ThreadBlocks;
+
+    TQueue<int32, EQueueMode::Mpsc> PendingReleases;
+
+    /** IDs are tracked in chunks to keep growth rare */
+    static constexpr int32 BitmapChunkSize = 4096;
+
+    /** Fixed IDs further than this above the high-water mark go to DistantReservedIDs */
+    static constexpr int32 MaxBitmapJump = 1 << 20;
+};
+
+/**
+ * Blueprint-facing singleton for entity IDs
+ * Thin wrapper over FEntityIDAllocator; native code on any thread should call the allocator directly.
  */
 UCLASS(BlueprintType)
 class GAME_API UEntityIDManager : public UObject
@@ -16,7 +175,7 @@ class GAME_API UEntityIDManager : public UObject
 public:
     UEntityIDManager();
 
-    // Singleton access
+    // Singleton access (game thread)
     UFUNCTION(BlueprintCallable, Category = "Entity ID Manager")
     static UEntityIDManager* GetInstance();
 
@@ -24,12 +183,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Entity ID Manager")
     int32 GenerateNewEntityID();
 
+
     UFUNCTION(BlueprintCallable, Category = "Entity ID Manager")
     void ReserveEntityID(int32 EntityID);
 
     UFUNCTION(BlueprintCallable, Category = "Entity ID Manager")
     bool IsEntityIDTaken(int32 EntityID) const;
 
+    /** The ID becomes available again at the end of the frame */
     UFUNCTION(BlueprintCallable, Category = "Entity ID Manager")
     void ReleaseEntityID(int32 EntityID);
 
@@ -51,26 +212,6 @@ public:
     void ClearAllReservedIDs();
 
 protected:
-    // Current ID counter for incremental generation
-    UPROPERTY(BlueprintReadOnly, Category = "Entity ID Manager")
-    int32 CurrentIDCounter;
-
-    // ID range limits
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity ID Manager")
-    int32 MinEntityID;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity ID Manager")
-    int32 MaxEntityID;
-
-    // Set of currently reserved/taken IDs
-    UPROPERTY()
-    TSet<int32> ReservedEntityIDs;
-
     // Singleton instance
     static UEntityIDManager* Instance;
-
-private:
-    // Internal helpers
-    bool IsIDInValidRange(int32 EntityID) const;
-    int32 FindNextAvailableID(int32 StartID) const;
 };
@@ -0,0 +1,322 @@
+#include "EntityRegistrySubsystem.h"
+#include "BaseEntity.h"
+#include "EntitySnapshot.h"
+#include "Engine/World.h"
+#include "Misc/Paths.h"
+
+UEntityRegistrySubsystem::UEntityRegistrySubsystem()
+{
+}
+
+UEntityRegistrySubsystem* UEntityRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UEntityRegistrySubsystem>() : nullptr;
+}
+
+void UEntityRegistrySubsystem::Deinitialize()
+{
+    // Hand each entity its state back so it keeps working without a registry
+    for (int32 Slot = 0; Slot < Entities.Num(); ++Slot)
+    {
+        UBaseEntity* Entity = Entities[Slot];
+        Entity->DetachedState = StateArrays.GetRow(Slot);
+        Entity->StateArrays = nullptr;
+        Entity->RegistrySlot = INDEX_NONE;
+        Entity->Registry.Reset();
+    }
+
+    Entities.Empty();
+    StateArrays.Empty();
+    EntityTagBits.Empty();
+    SlotByEntityID.Empty();
+    TagIndexByName.Empty();
+    TagNames.Empty();
+    TagMembers.Empty();
+
+    Super::Deinitialize();
+}
+
+// === Registration ===
+
+bool UEntityRegistrySubsystem::RegisterEntity(UBaseEntity* Entity)
+{
+    if (!Entity || Entity->EntityID == 0)
+    {
+        return false;
+    }
+
+    if (Entity->Registry.IsValid() && Entity->Registry.Get() != this)
+    {
+        Entity->Registry->UnregisterEntity(Entity);
+    }
+
+    int32 Slot = Entity->Registry.Get() == this ? Entity->RegistrySlot : INDEX_NONE;
+    const bool bNewEntity = Slot == INDEX_NONE;
+    if (bNewEntity)
+    {
+        if (const int32* ExistingSlot = SlotByEntityID.Find(Entity->EntityID))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("EntityRegistry: Entity ID %d is already registered to %s"),
+                   Entity->EntityID, *Entities[*ExistingSlot]->EntityName);
+            return false;
+        }
+
+        Slot = Entities.Add(Entity);
+        StateArrays.Add(Entity->DetachedState);
+        EntityTagBits.AddDefaulted();
+        SlotByEntityID.Add(Entity->EntityID, Slot);
+        Entity->RegistrySlot = Slot;
+        Entity->Registry = this;
+        Entity->StateArrays = &StateArrays;
+    }
+    else
+    {
+        ClearTags(Entity);
+    }
+
+    // The entity's tag list is the source of truth; mirror it into the bitsets
+    for (const FName& Tag : Entity->SearchTags)
+    {
+        AddTag(Entity, Tag);
+    }
+
+    if (bNewEntity)
+    {
+        OnEntityRegistered.Broadcast(Entity);
+    }
+    return true;
+}
+
+void UEntityRegistrySubsystem::UnregisterEntity(UBaseEntity* Entity)
+{
+    if (!Entity || Entity->Registry.Get() != this || !Entities.IsValidIndex(Entity->RegistrySlot))
+    {
+        return;
+    }
+
+    OnEntityUnregistered.Broadcast(Entity);
+
+    const int32 Slot = Entity->RegistrySlot;
+    const int32 LastSlot = Entities.Num() - 1;
+    ClearTags(Entity);
+
+    // Move the last entity's tag memberships into the freed slot
+    if (Slot != LastSlot)
+    {
+        UBaseEntity* MovedEntity = Entities[LastSlot];
+        for (TConstSetBitIterator<> It(EntityTagBits[LastSlot]); It; ++It)
+        {
+            TBitArray<>& Members = TagMembers[It.GetIndex()];
+            WriteBit(Members, LastSlot, false);
+            WriteBit(Members, Slot, true);
+        }
+        MovedEntity->RegistrySlot = Slot;
+        SlotByEntityID.Add(MovedEntity->EntityID, Slot);
+    }
+
+    Entity->DetachedState = StateArrays.GetRow(Slot);
+    Entity->StateArrays = nullptr;
+
+    Entities.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    StateArrays.RemoveAtSwap(Slot);
+    EntityTagBits.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    SlotByEntityID.Remove(Entity->EntityID);
+    Entity->RegistrySlot = INDEX_NONE;
+    Entity->Registry.Reset();
+}
+
+// === Snapshots ===
+
+bool UEntityRegistrySubsystem::SaveSnapshot(const FString& FilePath)
+{
+    return FEntitySnapshot::Write(FilePath.IsEmpty() ? GetQuickSavePath() : FilePath, *this);
+}
+
+int32 UEntityRegistrySubsystem::LoadSnapshot(const FString& FilePath, bool bRestoreIDAllocator)
+{
+    FEntitySnapshotReader Reader;
+    if (!Reader.Open(FilePath.IsEmpty() ? GetQuickSavePath() : FilePath))
+    {
+        return 0;
+    }
+    return FEntitySnapshot::Apply(Reader, *this, bRestoreIDAllocator);
+}
+
+FString UEntityRegistrySubsystem::GetQuickSavePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("Snapshots/QuickSave.esnap");
+}
+
+// === Lookup ===
+
+UBaseEntity* UEntityRegistrySubsystem::FindEntityByID(int32 EntityID) const
+{
+    const int32 Slot = FindSlot(EntityID);
+    return Slot != INDEX_NONE ? Entities[Slot] : nullptr;
+}
+
+UBaseEntity* UEntityRegistrySubsystem::FindEntityByRuntimeID(uint64 UniqueRuntimeID) const
+{
+    UBaseEntity* Entity = FindEntityByID((int32)(uint32)UniqueRuntimeID);
+    return Entity && Entity->UniqueRuntimeID == UniqueRuntimeID ? Entity : nullptr;
+}
+
+int32 UEntityRegistrySubsystem::FindSlot(int32 EntityID) const
+{
+    const int32* Slot = SlotByEntityID.Find(EntityID);
+    return Slot ? *Slot : INDEX_NONE;
+}
+
+// === Tags ===
+
+int32 UEntityRegistrySubsystem::FindTagIndex(FName Tag) const
+{
+    const int32* TagIndex = TagIndexByName.Find(Tag);
+    return TagIndex ? *TagIndex : INDEX_NONE;
+}
+
+void UEntityRegistrySubsystem::AddTag(UBaseEntity* Entity, FName Tag)
+{
+    if (!Entity || Entity->Registry.Get() != this || Tag.IsNone())
+    {
+        return;
+    }
+
+    const int32 TagIndex = GetOrAddTagIndex(Tag);
+    WriteBit(EntityTagBits[Entity->RegistrySlot], TagIndex, true);
+    WriteBit(TagMembers[TagIndex], Entity->RegistrySlot, true);
+}
+
+void UEntityRegistrySubsystem::RemoveTag(UBaseEntity* Entity, FName Tag)
+{
+    const int32 TagIndex = FindTagIndex(Tag);
+    if (!Entity || Entity->Registry.Get() != this || TagIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    WriteBit(EntityTagBits[Entity->RegistrySlot], TagIndex, false);
+    WriteBit(TagMembers[TagIndex], Entity->RegistrySlot, false);
+}
+
+void UEntityRegistrySubsystem::ClearTags(UBaseEntity* Entity)
+{
+    if (!Entity || Entity->Registry.Get() != this)
+    {
+        return;
+    }
+
+    TBitArray<>& TagBits = EntityTagBits[Entity->RegistrySlot];
+    for (TConstSetBitIterator<> It(TagBits); It; ++It)
+    {
+        WriteBit(TagMembers[It.GetIndex()], Entity->RegistrySlot, false);
+    }
+    TagBits.Empty();
+}
+
+bool UEntityRegistrySubsystem::HasTag(const UBaseEntity* Entity, FName Tag) const
+{
+    const int32 TagIndex = FindTagIndex(Tag);
+    if (!Entity || Entity->Registry.Get() != this || TagIndex == INDEX_NONE)
+    {
+        return false;
+    }
+    return ReadBit(EntityTagBits[Entity->RegistrySlot], TagIndex);
+}
+
+TArray<UBaseEntity*> UEntityRegistrySubsystem::GetEntitiesWithTag(FName Tag) const
+{
+    TArray<UBaseEntity*> Result;
+    FindEntitiesWithAllTags(MakeArrayView(&Tag, 1), Result);
+    return Result;
+}
+
+int32 UEntityRegistrySubsystem::FindEntitiesWithAllTags(TArrayView<const FName> Tags, TArray<UBaseEntity*>& OutEntities) const
+{
+    if (Tags.Num() == 0)
+    {
+        return 0;
+    }
+
+    // Start from the shortest member set; ANDing with MinSize never grows the intersection
+    TArray<const TBitArray<>*, TInlineAllocator<8>> MemberSets;
+    for (const FName& Tag : Tags)
+    {
+        const int32 TagIndex = FindTagIndex(Tag);
+        if (TagIndex == INDEX_NONE)
+        {
+            return 0;
+        }
+        MemberSets.Add(&TagMembers[TagIndex]);
+    }
+    MemberSets.Sort([](const TBitArray<>& A, const TBitArray<>& B) { return A.Num() < B.Num(); });
+
+    if (MemberSets.Num() == 1)
+    {
+        return AppendSlots(*MemberSets[0], OutEntities);
+    }
+
+    TBitArray<> Intersection = *MemberSets[0];
+    for (int32 i = 1; i < MemberSets.Num(); ++i)
+    {
+        Intersection.CombineWithBitwiseAND(*MemberSets[i], EBitwiseOperatorFlags::MinSize);
+    }
+    return AppendSlots(Intersection, OutEntities);
+}
+
+int32 UEntityRegistrySubsystem::FindEntitiesWithAnyTag(TArrayView<const FName> Tags, TArray<UBaseEntity*>& OutEntities) const
+{
+    TBitArray<> Union;
+    for (const FName& Tag : Tags)
+    {
+        const int32 TagIndex = FindTagIndex(Tag);
+        if (TagIndex != INDEX_NONE)
+        {
+            Union.CombineWithBitwiseOR(TagMembers[TagIndex], EBitwiseOperatorFlags::MaxSize);
+        }
+    }
+    return AppendSlots(Union, OutEntities);
+}
+
+int32 UEntityRegistrySubsystem::CountEntitiesWithTag(FName Tag) const
+{
+    const int32 TagIndex = FindTagIndex(Tag);
+    return TagIndex != INDEX_NONE ? TagMembers[TagIndex].CountSetBits() : 0;
+}
+
+int32 UEntityRegistrySubsystem::GetOrAddTagIndex(FName Tag)
+{
+    if (const int32* TagIndex = TagIndexByName.Find(Tag))
+    {
+        return *TagIndex;
+    }
+
+    const int32 TagIndex = TagNames.Add(Tag);
+    TagMembers.AddDefaulted();
+    TagIndexByName.Add(Tag, TagIndex);
+    return TagIndex;
+}
+
+void UEntityRegistrySubsystem::WriteBit(TBitArray<>& Bits, int32 Index, bool bValue)
+{
+    if (Index >= Bits.Num())
+    {
+        if (!bValue)
+        {
+            return;
+        }
+        Bits.Add(false, Index + 1 - Bits.Num());
+    }
+    Bits[Index] = bValue;
+}
+
+int32 UEntityRegistrySubsystem::AppendSlots(const TBitArray<>& SlotBits, TArray<UBaseEntity*>& OutEntities) const
+{
+    const int32 StartNum = OutEntities.Num();
+    for (TConstSetBitIterator<> It(SlotBits); It; ++It)
+    {
+        OutEntities.Add(Entities[It.GetIndex()]);
+    }
+    return OutEntities.Num() - StartNum;
+}
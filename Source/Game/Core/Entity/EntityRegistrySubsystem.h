@@ -0,0 +1,134 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EntityStateArrays.h"
+#include "EntityRegistrySubsystem.generated.h"
+
+class UBaseEntity;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRegistryEntityChanged, UBaseEntity*);
+
+/**
+ * Entity Registry Subsystem
+ * Index of every registered UBaseEntity in a world. Entities live in a packed array (removal swaps
+ * the last entity into the hole), with a map from EntityID to slot. Search tags are interned to
+ * small integer indices; each entity keeps a bitset of its tags and each tag keeps a bitset of the
+ * slots carrying it, so multi-tag queries are a bitwise AND followed by a walk of the set bits.
+ * The registry also owns the hot state of its entities as slot-aligned SoA columns; UBaseEntity
+ * reads and writes them through its accessors, and bulk systems can sweep them directly.
+ *
+ * Entities register themselves from SetupEntityIdentity or SpawnEntity and unregister in BeginDestroy.
+ * Game thread only.
+ */
+UCLASS()
+class GAME_API UEntityRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UEntityRegistrySubsystem();
+
+    /** Registry of the entity's world, nullptr if it has none */
+    static UEntityRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+    // USubsystem interface
+    virtual void Deinitialize() override;
+
+    // === Registration ===
+
+    /** Add an entity, or resync its tags if it is already registered */
+    bool RegisterEntity(UBaseEntity* Entity);
+
+    void UnregisterEntity(UBaseEntity* Entity);
+
+    int32 GetNumEntities() const { return Entities.Num(); }
+
+    /** Packed entity array; slots change when entities are removed */
+    const TArray<UBaseEntity*>& GetEntities() const { return Entities; }
+
+    /** Fired after an entity is added; tag resyncs of registered entities don't fire it */
+    FOnRegistryEntityChanged OnEntityRegistered;
+
+    /** Fired before an entity is removed, while its slot is still valid */
+    FOnRegistryEntityChanged OnEntityUnregistered;
+
+    // === Hot State ===
+
+    /** SoA state columns, aligned with GetEntities() */
+    FEntityStateArrays& GetStateArrays() { return StateArrays; }
+    const FEntityStateArrays& GetStateArrays() const { return StateArrays; }
+
+    // === Snapshots ===
+
+    /** Write every registered entity and the ID allocator state; empty path = quick-save slot */
+    UFUNCTION(BlueprintCallable, Category = "Entity Registry")
+    bool SaveSnapshot(const FString& FilePath);
+
+    /** Restore registered entities from a snapshot; returns the number restored */
+    UFUNCTION(BlueprintCallable, Category = "Entity Registry")
+    int32 LoadSnapshot(const FString& FilePath, bool bRestoreIDAllocator = true);
+
+    static FString GetQuickSavePath();
+
+    // === Lookup ===
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Registry")
+    UBaseEntity* FindEntityByID(int32 EntityID) const;
+
+    /** The runtime ID carries the EntityID in its low 32 bits, so this is one map lookup plus a compare */
+    UBaseEntity* FindEntityByRuntimeID(uint64 UniqueRuntimeID) const;
+
+    /** Slot of a registered entity, INDEX_NONE otherwise */
+    int32 FindSlot(int32 EntityID) const;
+
+    // === Tags ===
+
+    /** Interned index of a tag, INDEX_NONE if no entity ever had it */
+    int32 FindTagIndex(FName Tag) const;
+
+    int32 GetNumTags() const { return TagNames.Num(); }
+
+    void AddTag(UBaseEntity* Entity, FName Tag);
+    void RemoveTag(UBaseEntity* Entity, FName Tag);
+    void ClearTags(UBaseEntity* Entity);
+    bool HasTag(const UBaseEntity* Entity, FName Tag) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Registry")
+    TArray<UBaseEntity*> GetEntitiesWithTag(FName Tag) const;
+
+    /** Append every entity carrying all of the tags to OutEntities; returns the number added */
+    int32 FindEntitiesWithAllTags(TArrayView<const FName> Tags, TArray<UBaseEntity*>& OutEntities) const;
+
+    /** Append every entity carrying at least one of the tags to OutEntities; returns the number added */
+    int32 FindEntitiesWithAnyTag(TArrayView<const FName> Tags, TArray<UBaseEntity*>& OutEntities) const;
+
+    int32 CountEntitiesWithTag(FName Tag) const;
+
+private:
+    int32 GetOrAddTagIndex(FName Tag);
+
+    /** Set or clear one bit, growing the array only when setting */
+    static void WriteBit(TBitArray<>& Bits, int32 Index, bool bValue);
+    static bool ReadBit(const TBitArray<>& Bits, int32 Index) { return Index < Bits.Num() && Bits[Index]; }
+
+    int32 AppendSlots(const TBitArray<>& SlotBits, TArray<UBaseEntity*>& OutEntities) const;
+
+    /** Entities are unregistered in BeginDestroy, so the packed array never holds a dead pointer */
+    TArray<UBaseEntity*> Entities;
+
+    /** Hot state of each slot; row N belongs to Entities[N] */
+    FEntityStateArrays StateArrays;
+
+    /** Per slot: bit per tag index */
+    TArray<TBitArray<>> EntityTagBits;
+
+    TMap<int32, int32> SlotByEntityID;
+
+    // Interned tags
+    TMap<FName, int32> TagIndexByName;
+    TArray<FName> TagNames;
+
+    /** Per tag index: bit per slot */
+    TArray<TBitArray<>> TagMembers;
+};
@@ -0,0 +1,338 @@
+#include "EntitySnapshot.h"
+#include "EntityRegistrySubsystem.h"
+#include "EntityIDManager.h"
+#include "BaseEntity.h"
+#include "HAL/PlatformTime.h"
+
+using namespace EntitySnapshot;
+
+// === FEntitySnapshot ===
+
+bool FEntitySnapshot::Write(const FString& FilePath, const UEntityRegistrySubsystem& Registry)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const TArray<UBaseEntity*>& Entities = Registry.GetEntities();
+    const FEntityStateArrays& State = Registry.GetStateArrays();
+    const int32 NumEntities = Entities.Num();
+
+    // Identity side tables are built in memory; the state columns are written straight from the registry
+    TArray<FEntitySnapshotRecord> Records;
+    Records.SetNumUninitialized(NumEntities);
+    TArray<uint8> Strings;
+    TArray<FStringRef> TagNames;
+    TMap<FName, uint32> TagIndices;
+    TArray<uint32> TagRefs;
+
+    auto AppendString = [&Strings](const FString& String)
+    {
+        FTCHARToUTF8 Utf8(*String);
+        const FStringRef Ref = { (uint32)Strings.Num(), (uint32)Utf8.Length() };
+        Strings.Append((const uint8*)Utf8.Get(), Utf8.Length());
+        return Ref;
+    };
+
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        const UBaseEntity* Entity = Entities[Index];
+        FEntitySnapshotRecord& Record = Records[Index];
+        FMemory::Memzero(Record);
+        Record.UniqueRuntimeID = Entity->UniqueRuntimeID;
+        Record.EntityID = Entity->EntityID;
+        Record.Name = AppendString(Entity->EntityName);
+        Record.FirstTag = (uint32)TagRefs.Num();
+        Record.NumTags = (uint16)FMath::Min(Entity->SearchTags.Num(), (int32)MAX_uint16);
+        Record.EntityType = (uint8)Entity->EntityType;
+
+        for (int32 TagIndex = 0; TagIndex < Record.NumTags; ++TagIndex)
+        {
+            const FName Tag = Entity->SearchTags[TagIndex];
+            uint32* NameIndex = TagIndices.Find(Tag);
+            if (!NameIndex)
+            {
+                NameIndex = &TagIndices.Add(Tag, (uint32)TagNames.Add(AppendString(Tag.ToString())));
+            }
+            TagRefs.Add(*NameIndex);
+        }
+    }
+
+    TArray<uint8> Flags;
+    Flags.SetNumUninitialized(NumEntities);
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        Flags[Index] = (State.Active[Index] ? Flag_Active : 0) |
+                       (State.Spawned[Index] ? Flag_Spawned : 0) |
+                       (State.Alive[Index] ? Flag_Alive : 0) |
+                       (State.Invulnerable[Index] ? Flag_Invulnerable : 0);
+    }
+
+    FIDAllocatorHeader IDHeader;
+    FMemory::Memzero(IDHeader);
+    TArray<int32> TakenIDs;
+    FEntityIDAllocator::Get().ExportState(IDHeader.MinID, IDHeader.MaxID, TakenIDs);
+    IDHeader.NumTakenIDs = TakenIDs.Num();
+
+    // Section order matches ESection
+    FSectionedFileWriter Writer(sizeof(FEntitySnapshotHeader), SectionAlignment);
+    Writer.BeginSection((uint32)ESection::IDAllocator);
+    Writer.AddChunk(&IDHeader, sizeof(IDHeader));
+    Writer.AddChunk(TakenIDs.GetData(), (int64)TakenIDs.Num() * sizeof(int32));
+    Writer.AddArray((uint32)ESection::Entities, Records);
+    Writer.AddArray((uint32)ESection::Strings, Strings);
+    Writer.AddArray((uint32)ESection::TagNames, TagNames);
+    Writer.AddArray((uint32)ESection::TagRefs, TagRefs);
+    Writer.AddArray((uint32)ESection::MaxHealth, State.MaxHealth);
+    Writer.AddArray((uint32)ESection::Health, State.Health);
+    Writer.AddArray((uint32)ESection::Flags, Flags);
+    Writer.AddArray((uint32)ESection::States, State.States);
+    Writer.AddArray((uint32)ESection::PreviousStates, State.PreviousStates);
+    Writer.AddArray((uint32)ESection::StateTimers, State.StateTimers);
+    Writer.AddArray((uint32)ESection::Positions, State.Positions);
+    Writer.AddArray((uint32)ESection::Rotations, State.Rotations);
+    Writer.AddArray((uint32)ESection::Scales, State.Scales);
+    check(Writer.NumSections() == (int32)ESection::Count);
+
+    // Lay the whole file out before writing anything so it streams out in order
+    const int64 FileSize = Writer.Layout();
+
+    FEntitySnapshotHeader Header;
+    FMemory::Memzero(Header);
+    Header.Magic = Magic;
+    Header.Version = Version;
+    Header.RealSize = (uint8)sizeof(FVector::FReal);
+    Header.NumSections = (uint8)Writer.NumSections();
+    Header.NumEntities = (uint32)NumEntities;
+    Header.FileSize = (uint64)FileSize;
+
+    if (!Writer.Write(FilePath, &Header, TEXT("EntitySnapshot")))
+    {
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("EntitySnapshot: Wrote %d entities (%lld bytes) to '%s' in %.2f ms"),
+           NumEntities, FileSize, *FilePath, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return true;
+}
+
+int32 FEntitySnapshot::Apply(const FEntitySnapshotReader& Reader, UEntityRegistrySubsystem& Registry, bool bRestoreIDAllocator)
+{
+    if (!Reader.IsOpen())
+    {
+        return 0;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    if (bRestoreIDAllocator)
+    {
+        // Live entities keep their IDs, so they're reserved on top of the saved pool
+        FEntityIDAllocator& Allocator = FEntityIDAllocator::Get();
+        Allocator.ImportState(Reader.GetMinID(), Reader.GetMaxID(), Reader.GetTakenIDs());
+        for (const UBaseEntity* Entity : Registry.GetEntities())
+        {
+            if (!Allocator.IsTaken(Entity->EntityID))
+            {
+                Allocator.Reserve(Entity->EntityID);
+            }
+        }
+    }
+
+    // Records from another session won't match by runtime ID; fall back to the entity name
+    TMap<FString, UBaseEntity*> EntitiesByName;
+    EntitiesByName.Reserve(Registry.GetNumEntities());
+    for (UBaseEntity* Entity : Registry.GetEntities())
+    {
+        EntitiesByName.Add(Entity->EntityName, Entity);
+    }
+
+    const TArrayView<const FEntitySnapshotRecord> Records = Reader.GetRecords();
+    const TArrayView<const uint8> Flags = Reader.GetFlags();
+    FEntityStateArrays& State = Registry.GetStateArrays();
+    int32 NumRestored = 0;
+
+    for (int32 Index = 0; Index < Records.Num(); ++Index)
+    {
+        const FEntitySnapshotRecord& Record = Records[Index];
+        UBaseEntity* Entity = Registry.FindEntityByRuntimeID(Record.UniqueRuntimeID);
+        if (!Entity)
+        {
+            const FUtf8StringView Name = Reader.GetName(Index);
+            UBaseEntity** Found = EntitiesByName.Find(FString(Name.Len(), Name.GetData()));
+            Entity = Found ? *Found : nullptr;
+        }
+        if (!Entity)
+        {
+            continue;
+        }
+
+        const int32 Slot = Entity->GetRegistrySlot();
+        State.MaxHealth[Slot] = Reader.GetMaxHealth()[Index];
+        State.Health[Slot] = Reader.GetHealth()[Index];
+        State.Active[Slot] = (Flags[Index] & Flag_Active) != 0;
+        State.Spawned[Slot] = (Flags[Index] & Flag_Spawned) != 0;
+        State.Alive[Slot] = (Flags[Index] & Flag_Alive) != 0;
+        State.Invulnerable[Slot] = (Flags[Index] & Flag_Invulnerable) != 0;
+        State.States[Slot] = Reader.GetStates()[Index];
+        State.PreviousStates[Slot] = Reader.GetPreviousStates()[Index];
+        State.StateTimers[Slot] = Reader.GetStateTimers()[Index];
+        State.Positions[Slot] = Reader.GetPositions()[Index];
+        State.Rotations[Slot] = Reader.GetRotations()[Index];
+        State.Scales[Slot] = Reader.GetScales()[Index];
+
+        Entity->EntityType = (EEntityType)Record.EntityType;
+        Entity->SearchTags.Reset();
+        Reader.GetTags(Index, Entity->SearchTags);
+        Registry.RegisterEntity(Entity); // Resyncs the tag bitsets
+
+        ++NumRestored;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("EntitySnapshot: Restored %d of %d entities in %.2f ms"),
+           NumRestored, Records.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return NumRestored;
+}
+
+// === FEntitySnapshotReader ===
+
+FEntitySnapshotReader::FEntitySnapshotReader()
+{
+    NumEntities = 0;
+    IDHeader = nullptr;
+}
+
+FEntitySnapshotReader::~FEntitySnapshotReader()
+{
+    Close();
+}
+
+bool FEntitySnapshotReader::Open(const FString& FilePath)
+{
+    Close();
+
+    if (!File.Open(FilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("EntitySnapshot: Could not open '%s'"), *FilePath);
+        return false;
+    }
+
+    if (!Validate())
+    {
+        UE_LOG(LogTemp, Error, TEXT("EntitySnapshot: '%s' is not a valid version %d snapshot"), *FilePath, (int32)Version);
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void FEntitySnapshotReader::Close()
+{
+    File.Close();
+    NumEntities = 0;
+    IDHeader = nullptr;
+
+    Records = {};
+    Strings = {};
+    TagNames = {};
+    TagRefs = {};
+    TakenIDs = {};
+    MaxHealth = {};
+    Health = {};
+    Flags = {};
+    States = {};
+    PreviousStates = {};
+    StateTimers = {};
+    Positions = {};
+    Rotations = {};
+    Scales = {};
+}
+
+FUtf8StringView FEntitySnapshotReader::GetString(const FStringRef& Ref) const
+{
+    return FUtf8StringView((const UTF8CHAR*)Strings.GetData() + Ref.Offset, (int32)Ref.Length);
+}
+
+void FEntitySnapshotReader::GetTags(int32 Index, TArray<FName>& OutTags) const
+{
+    const FEntitySnapshotRecord& Record = Records[Index];
+    OutTags.Reserve(OutTags.Num() + Record.NumTags);
+    for (uint32 TagRef = Record.FirstTag; TagRef < Record.FirstTag + Record.NumTags; ++TagRef)
+    {
+        OutTags.Add(FName(GetString(TagNames[TagRefs[TagRef]])));
+    }
+}
+
+bool FEntitySnapshotReader::Validate()
+{
+    const FEntitySnapshotHeader* Header = File.GetHeader<FEntitySnapshotHeader>();
+    if (!Header || Header->Magic != Magic || Header->Version != Version || Header->RealSize != sizeof(FVector::FReal) ||
+        Header->FileSize != (uint64)File.GetSize() || Header->NumEntities > (uint32)MAX_int32 ||
+        !File.ReadSectionTable(sizeof(FEntitySnapshotHeader), Header->NumSections, (uint32)ESection::Count, SectionAlignment))
+    {
+        return false;
+    }
+
+    NumEntities = (int32)Header->NumEntities;
+
+    TArrayView<const FIDAllocatorHeader> IDHeaderView;
+    if (!File.GetSectionView((uint32)ESection::IDAllocator, 1, IDHeaderView))
+    {
+        return false;
+    }
+    IDHeader = IDHeaderView.GetData();
+
+    const bool bSectionsValid =
+        File.GetSectionView((uint32)ESection::IDAllocator, IDHeader->NumTakenIDs, TakenIDs, sizeof(FIDAllocatorHeader)) &&
+        File.GetSectionView((uint32)ESection::Entities, NumEntities, Records) &&
+        File.GetSectionView((uint32)ESection::Strings, Strings) &&
+        File.GetSectionView((uint32)ESection::TagNames, TagNames) &&
+        File.GetSectionView((uint32)ESection::TagRefs, TagRefs) &&
+        File.GetSectionView((uint32)ESection::MaxHealth, NumEntities, MaxHealth) &&
+        File.GetSectionView((uint32)ESection::Health, NumEntities, Health) &&
+        File.GetSectionView((uint32)ESection::Flags, NumEntities, Flags) &&
+        File.GetSectionView((uint32)ESection::States, NumEntities, States) &&
+        File.GetSectionView((uint32)ESection::PreviousStates, NumEntities, PreviousStates) &&
+        File.GetSectionView((uint32)ESection::StateTimers, NumEntities, StateTimers) &&
+        File.GetSectionView((uint32)ESection::Positions, NumEntities, Positions) &&
+        File.GetSectionView((uint32)ESection::Rotations, NumEntities, Rotations) &&
+        File.GetSectionView((uint32)ESection::Scales, NumEntities, Scales);
+    if (!bSectionsValid)
+    {
+        return false;
+    }
+
+    // Cross-references, so the accessors can index without checks
+    auto IsStringValid = [this](const FStringRef& Ref)
+    {
+        return (uint64)Ref.Offset + Ref.Length <= (uint64)Strings.Num();
+    };
+
+    for (const FStringRef& TagName : TagNames)
+    {
+        if (!IsStringValid(TagName))
+        {
+            return false;
+        }
+    }
+    for (uint32 TagRef : TagRefs)
+    {
+        if (TagRef >= (uint32)TagNames.Num())
+        {
+            return false;
+        }
+    }
+    for (const FEntitySnapshotRecord& Record : Records)
+    {
+        if (!IsStringValid(Record.Name) || (uint64)Record.FirstTag + Record.NumTags > (uint64)TagRefs.Num() ||
+            Record.EntityType > (uint8)EEntityType::Invalid)
+        {
+            return false;
+        }
+    }
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        if ((uint8)States[Index] > (uint8)EEntityState::Invalid || (uint8)PreviousStates[Index] > (uint8)EEntityState::Invalid)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/GameWorldEnums.h"
+#include "Core/Utils/SectionedFile.h"
+
+class UEntityRegistrySubsystem;
+
+/**
+ * Entity Snapshot
+ * Versioned binary snapshot of a world's entities: ID allocator state, entity table (identity and
+ * tags), and the registry's SoA state columns. Layout:
+ *
+ *   FEntitySnapshotHeader
+ *   FSectionedFileSection[NumSections]
+ *   sections, each starting on a 16-byte boundary
+ *
+ * Every section size follows from the entity/tag/string counts, so the writer lays the file out up
+ * front and streams it in one pass with no seeking. The reader memory-maps the file and hands out
+ * views straight into the mapping; state columns are stored in the same layout as
+ * FEntityStateArrays so loading them is a bounds check, not a parse.
+ */
+namespace EntitySnapshot
+{
+    static constexpr uint32 Magic = 0x504E5345; // "ESNP"
+    static constexpr uint16 Version = 1;
+    static constexpr int64 SectionAlignment = 16;
+
+    enum class ESection : uint32
+    {
+        IDAllocator,    // FIDAllocatorHeader + int32 TakenIDs[]
+        Entities,       // FEntitySnapshotRecord[NumEntities]
+        Strings,        // UTF-8 blob referenced by records and tag names
+        TagNames,       // FStringRef[] into Strings
+        TagRefs,        // uint32 tag name indices, ranges referenced by records
+        MaxHealth,      // float[NumEntities]
+        Health,         // float[NumEntities]
+        Flags,          // uint8[NumEntities], EStateFlags
+        States,         // EEntityState[NumEntities]
+        PreviousStates, // EEntityState[NumEntities]
+        StateTimers,    // float[NumEntities]
+        Positions,      // FVector[NumEntities]
+        Rotations,      // FRotator[NumEntities]
+        Scales,         // FVector[NumEntities]
+        Count
+    };
+
+    enum EStateFlags : uint8
+    {
+        Flag_Active = 1 << 0,
+        Flag_Spawned = 1 << 1,
+        Flag_Alive = 1 << 2,
+        Flag_Invulnerable = 1 << 3
+    };
+
+    struct FIDAllocatorHeader
+    {
+        int32 MinID;
+        int32 MaxID;
+        int32 NumTakenIDs;
+        int32 Reserved;
+    };
+
+    struct FStringRef
+    {
+        uint32 Offset;
+        uint32 Length;
+    };
+}
+
+struct FEntitySnapshotHeader
+{
+    uint32 Magic;
+    uint16 Version;
+    /** sizeof(FVector::FReal); snapshots don't load across precision builds */
+    uint8 RealSize;
+    uint8 NumSections;
+    uint32 NumEntities;
+    uint32 Reserved;
+    uint64 FileSize;
+};
+
+/** One entity's identity; state lives in the column sections at the same index */
+struct FEntitySnapshotRecord
+{
+    uint64 UniqueRuntimeID;
+    int32 EntityID;
+    EntitySnapshot::FStringRef Name;
+    uint32 FirstTag;
+    uint16 NumTags;
+    uint8 EntityType;
+    uint8 Reserved;
+};
+
+static_assert(sizeof(FEntitySnapshotHeader) == 24, "Snapshot header layout changed; bump EntitySnapshot::Version");
+static_assert(sizeof(FEntitySnapshotRecord) == 32, "Snapshot record layout changed; bump EntitySnapshot::Version");
+
+/**
+ * Read-only view of a snapshot file
+ * Opens the file through FSectionedFileReader and validates every section and cross-reference before
+ * handing out views. Views stay valid for the reader's lifetime.
+ */
+class GAME_API FEntitySnapshotReader
+{
+public:
+    FEntitySnapshotReader();
+    ~FEntitySnapshotReader();
+
+    bool Open(const FString& FilePath);
+    void Close();
+
+    bool IsOpen() const { return File.IsOpen(); }
+    bool IsMemoryMapped() const { return File.IsMemoryMapped(); }
+
+    int32 Num() const { return NumEntities; }
+
+    // === Identity ===
+
+    TArrayView<const FEntitySnapshotRecord> GetRecords() const { return Records; }
+    FUtf8StringView GetString(const EntitySnapshot::FStringRef& Ref) const;
+    FUtf8StringView GetName(int32 Index) const { return GetString(Records[Index].Name); }
+
+    /** Append the record's tags to OutTags; FNames are created here, the rest of the reader is zero-copy */
+    void GetTags(int32 Index, TArray<FName>& OutTags) const;
+
+    // === State Columns ===
+
+    TArrayView<const float> GetMaxHealth() const { return MaxHealth; }
+    TArrayView<const float> GetHealth() const { return Health; }
+    TArrayView<const uint8> GetFlags() const { return Flags; }
+    TArrayView<const EEntityState> GetStates() const { return States; }
+    TArrayView<const EEntityState> GetPreviousStates() const { return PreviousStates; }
+    TArrayView<const float> GetStateTimers() const { return StateTimers; }
+    TArrayView<const FVector> GetPositions() const { return Positions; }
+    TArrayView<const FRotator> GetRotations() const { return Rotations; }
+    TArrayView<const FVector> GetScales() const { return Scales; }
+
+    // === ID Allocator ===
+
+    int32 GetMinID() const { return IDHeader ? IDHeader->MinID : 0; }
+    int32 GetMaxID() const { return IDHeader ? IDHeader->MaxID : 0; }
+    TArrayView<const int32> GetTakenIDs() const { return TakenIDs; }
+
+private:
+    bool Validate();
+
+    FSectionedFileReader File;
+    int32 NumEntities;
+
+    const EntitySnapshot::FIDAllocatorHeader* IDHeader;
+
+    TArrayView<const FEntitySnapshotRecord> Records;
+    TArrayView<const uint8> Strings;
+    TArrayView<const EntitySnapshot::FStringRef> TagNames;
+    TArrayView<const uint32> TagRefs;
+    TArrayView<const int32> TakenIDs;
+
+    TArrayView<const float> MaxHealth;
+    TArrayView<const float> Health;
+    TArrayView<const uint8> Flags;
+    TArrayView<const EEntityState> States;
+    TArrayView<const EEntityState> PreviousStates;
+    TArrayView<const float> StateTimers;
+    TArrayView<const FVector> Positions;
+    TArrayView<const FRotator> Rotations;
+    TArrayView<const FVector> Scales;
+};
+
+/**
+ * Entity Snapshot Writer / Applier
+ */
+class GAME_API FEntitySnapshot
+{
+public:
+    /** Write the registry's entities and the ID allocator state to FilePath in one streaming pass */
+    static bool Write(const FString& FilePath, const UEntityRegistrySubsystem& Registry);
+
+    /**
+     * Apply a snapshot to the registered entities. Records are matched by UniqueRuntimeID, then by
+     * EntityName; matched entities get the saved state and tags. With bRestoreIDAllocator the
+     * allocator is replaced by the saved state and every live entity ID is re-reserved on top.
+     * Returns the number of entities restored
+     */
+    static int32 Apply(const FEntitySnapshotReader& Reader, UEntityRegistrySubsystem& Registry, bool bRestoreIDAllocator);
+};
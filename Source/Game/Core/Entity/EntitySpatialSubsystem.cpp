@@ -0,0 +1,417 @@
+#include "EntitySpatialSubsystem.h"
+#include "EntityRegistrySubsystem.h"
+#include "BaseEntity.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+UEntitySpatialSubsystem::UEntitySpatialSubsystem()
+{
+    CellSize = 1000.0f;
+    InvCellSize = 1.0f / CellSize;
+    LastCellMoves = 0;
+}
+
+UEntitySpatialSubsystem* UEntitySpatialSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UEntitySpatialSubsystem>() : nullptr;
+}
+
+void UEntitySpatialSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    UEntityRegistrySubsystem* EntityRegistry = Collection.InitializeDependency<UEntityRegistrySubsystem>();
+    if (!EntityRegistry)
+    {
+        return;
+    }
+
+    Registry = EntityRegistry;
+    EntityRegisteredHandle = EntityRegistry->OnEntityRegistered.AddUObject(this, &UEntitySpatialSubsystem::AddEntity);
+    EntityUnregisteredHandle = EntityRegistry->OnEntityUnregistered.AddUObject(this, &UEntitySpatialSubsystem::RemoveEntity);
+
+    // Pick up anything that registered before us
+    for (UBaseEntity* Entity : EntityRegistry->GetEntities())
+    {
+        AddEntity(Entity);
+    }
+}
+
+void UEntitySpatialSubsystem::Deinitialize()
+{
+    if (UEntityRegistrySubsystem* EntityRegistry = Registry.Get())
+    {
+        EntityRegistry->OnEntityRegistered.Remove(EntityRegisteredHandle);
+        EntityRegistry->OnEntityUnregistered.Remove(EntityUnregisteredHandle);
+    }
+    Registry.Reset();
+
+    Items.Empty();
+    ItemByEntityID.Empty();
+    Cells.Empty();
+
+    Super::Deinitialize();
+}
+
+void UEntitySpatialSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!FMath::IsNearlyEqual(InvCellSize * CellSize, 1.0f))
+    {
+        Rebuild();
+    }
+
+    LastCellMoves = 0;
+    for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+    {
+        LastCellMoves += RefreshItem(ItemIndex) ? 1 : 0;
+    }
+}
+
+TStatId UEntitySpatialSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEntitySpatialSubsystem, STATGROUP_Tickables);
+}
+
+// === Queries ===
+
+template<typename VisitorType>
+void UEntitySpatialSubsystem::ForEachItemInRect(const FVector& Min, const FVector& Max, VisitorType&& Visitor) const
+{
+    const int32 MinX = ToCell(Min.X);
+    const int32 MinY = ToCell(Min.Y);
+    const int32 MaxX = ToCell(Max.X);
+    const int32 MaxY = ToCell(Max.Y);
+
+    // A huge rectangle covers more cells than exist; walk the occupied ones instead
+    const int64 NumRectCells = ((int64)MaxX - MinX + 1) * ((int64)MaxY - MinY + 1);
+    if (NumRectCells > Cells.Num())
+    {
+        for (const TPair<uint64, FCell>& Cell : Cells)
+        {
+            const int32 CellX = GetCellX(Cell.Key);
+            const int32 CellY = GetCellY(Cell.Key);
+            if (CellX >= MinX && CellX <= MaxX && CellY >= MinY && CellY <= MaxY)
+            {
+                for (int32 ItemIndex : Cell.Value)
+                {
+                    Visitor(ItemIndex);
+                }
+            }
+        }
+        return;
+    }
+
+    for (int32 CellX = MinX; CellX <= MaxX; ++CellX)
+    {
+        for (int32 CellY = MinY; CellY <= MaxY; ++CellY)
+        {
+            if (const FCell* Cell = Cells.Find(MakeCellKey(CellX, CellY)))
+            {
+                for (int32 ItemIndex : *Cell)
+                {
+                    Visitor(ItemIndex);
+                }
+            }
+        }
+    }
+}
+
+int32 UEntitySpatialSubsystem::FindEntitiesInRadius(const FVector& Center, float Radius, TArray<UBaseEntity*>& OutEntities, EEntityType Type) const
+{
+    const int32 StartNum = OutEntities.Num();
+    const double RadiusSquared = FMath::Square((double)Radius);
+    const FVector Extent(Radius, Radius, 0.0);
+
+    ForEachItemInRect(Center - Extent, Center + Extent, [&](int32 ItemIndex)
+    {
+        const FItem& Item = Items[ItemIndex];
+        if (MatchesType(Item, Type) && FVector::DistSquared(Item.Position, Center) <= RadiusSquared)
+        {
+            OutEntities.Add(Item.Entity);
+        }
+    });
+    return OutEntities.Num() - StartNum;
+}
+
+int32 UEntitySpatialSubsystem::FindEntitiesInBox(const FBox& Box, TArray<UBaseEntity*>& OutEntities, EEntityType Type) const
+{
+    const int32 StartNum = OutEntities.Num();
+
+    ForEachItemInRect(Box.Min, Box.Max, [&](int32 ItemIndex)
+    {
+        const FItem& Item = Items[ItemIndex];
+        if (MatchesType(Item, Type) && Box.IsInsideOrOn(Item.Position))
+        {
+            OutEntities.Add(Item.Entity);
+        }
+    });
+    return OutEntities.Num() - StartNum;
+}
+
+int32 UEntitySpatialSubsystem::FindNearestEntities(const FVector& Center, int32 Count, TArray<UBaseEntity*>& OutEntities, float MaxRadius,
+                                                   EEntityType Type, const UBaseEntity* Exclude) const
+{
+    if (Count <= 0 || Items.Num() == 0)
+    {
+        return 0;
+    }
+
+    // Max-heap of the best Count candidates so far; its top is the one to beat
+    struct FCandidate
+    {
+        double DistanceSquared;
+        int32 ItemIndex;
+    };
+    const auto FurtherFirst = [](const FCandidate& A, const FCandidate& B) { return A.DistanceSquared > B.DistanceSquared; };
+    TArray<FCandidate, TInlineAllocator<16>> Heap;
+
+    const double MaxRadiusSquared = MaxRadius > 0.0f ? FMath::Square((double)MaxRadius) : TNumericLimits<double>::Max();
+    const auto Consider = [&](int32 ItemIndex)
+    {
+        const FItem& Item = Items[ItemIndex];
+        if (Item.Entity == Exclude || !MatchesType(Item, Type))
+        {
+            return;
+        }
+
+        const double DistanceSquared = FVector::DistSquared(Item.Position, Center);
+        if (DistanceSquared > MaxRadiusSquared)
+        {
+            return;
+        }
+
+        if (Heap.Num() < Count)
+        {
+            Heap.HeapPush({ DistanceSquared, ItemIndex }, FurtherFirst);
+        }
+        else if (DistanceSquared < Heap.HeapTop().DistanceSquared)
+        {
+            Heap.HeapPopDiscard(FurtherFirst);
+            Heap.HeapPush({ DistanceSquared, ItemIndex }, FurtherFirst);
+        }
+    };
+
+    // Walk square rings of cells outwards. Anything beyond ring R is more than R * CellSize away, so
+    // once the heap is full and its worst entry is within that, no later ring can improve it
+    const int32 CenterX = ToCell(Center.X);
+    const int32 CenterY = ToCell(Center.Y);
+    const int32 MaxRing = MaxRadius > 0.0f ? FMath::CeilToInt32(MaxRadius * InvCellSize) : MAX_int32;
+    const auto VisitCell = [&](int32 CellX, int32 CellY, int32& InOutVisited)
+    {
+        if (const FCell* Cell = Cells.Find(MakeCellKey(CellX, CellY)))
+        {
+            InOutVisited += Cell->Num();
+            for (int32 ItemIndex : *Cell)
+            {
+                Consider(ItemIndex);
+            }
+        }
+    };
+
+    int32 NumVisited = 0;
+    int64 NumLookups = 0;
+    for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+    {
+        if (NumLookups > Cells.Num())
+        {
+            // Sparse world: the rings cost more than a plain scan of every item
+            Heap.Reset();
+            for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+            {
+                Consider(ItemIndex);
+            }
+            break;
+        }
+
+        if (Ring == 0)
+        {
+            VisitCell(CenterX, CenterY, NumVisited);
+            NumLookups += 1;
+        }
+        else
+        {
+            for (int32 Offset = -Ring; Offset <= Ring; ++Offset)
+            {
+                VisitCell(CenterX + Offset, CenterY - Ring, NumVisited);
+                VisitCell(CenterX + Offset, CenterY + Ring, NumVisited);
+            }
+            for (int32 Offset = -Ring + 1; Offset < Ring; ++Offset)
+            {
+                VisitCell(CenterX - Ring, CenterY + Offset, NumVisited);
+                VisitCell(CenterX + Ring, CenterY + Offset, NumVisited);
+            }
+            NumLookups += 8 * Ring;
+        }
+
+        if (NumVisited >= Items.Num())
+        {
+            break;
+        }
+        if (Heap.Num() == Count && Heap.HeapTop().DistanceSquared <= FMath::Square((double)Ring * CellSize))
+        {
+            break;
+        }
+    }
+
+    Heap.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSquared < B.DistanceSquared; });
+    for (const FCandidate& Candidate : Heap)
+    {
+        OutEntities.Add(Items[Candidate.ItemIndex].Entity);
+    }
+    return Heap.Num();
+}
+
+UBaseEntity* UEntitySpatialSubsystem::FindNearestEntity(const FVector& Center, float MaxRadius, EEntityType Type, const UBaseEntity* Exclude) const
+{
+    TArray<UBaseEntity*> Result;
+    FindNearestEntities(Center, 1, Result, MaxRadius, Type, Exclude);
+    return Result.Num() > 0 ? Result[0] : nullptr;
+}
+
+int32 UEntitySpatialSubsystem::FindActorsInRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, EEntityType Type) const
+{
+    const int32 StartNum = OutActors.Num();
+    const double RadiusSquared = FMath::Square((double)Radius);
+    const FVector Extent(Radius, Radius, 0.0);
+
+    ForEachItemInRect(Center - Extent, Center + Extent, [&](int32 ItemIndex)
+    {
+        const FItem& Item = Items[ItemIndex];
+        if (MatchesType(Item, Type) && FVector::DistSquared(Item.Position, Center) <= RadiusSquared)
+        {
+            if (AActor* Actor = Item.Entity->GetOwnerActor())
+            {
+                OutActors.Add(Actor);
+            }
+        }
+    });
+    return OutActors.Num() - StartNum;
+}
+
+TArray<UBaseEntity*> UEntitySpatialSubsystem::GetEntitiesInRadius(FVector Center, float Radius) const
+{
+    TArray<UBaseEntity*> Result;
+    FindEntitiesInRadius(Center, Radius, Result);
+    return Result;
+}
+
+TArray<UBaseEntity*> UEntitySpatialSubsystem::GetNearestEntities(FVector Center, int32 Count, float MaxRadius) const
+{
+    TArray<UBaseEntity*> Result;
+    FindNearestEntities(Center, Count, Result, MaxRadius);
+    return Result;
+}
+
+// === Maintenance ===
+
+void UEntitySpatialSubsystem::UpdateEntity(UBaseEntity* Entity)
+{
+    if (const int32* ItemIndex = Entity ? ItemByEntityID.Find(Entity->EntityID) : nullptr)
+    {
+        RefreshItem(*ItemIndex);
+    }
+}
+
+void UEntitySpatialSubsystem::Rebuild()
+{
+    CellSize = FMath::Max(CellSize, 1.0f);
+    InvCellSize = 1.0f / CellSize;
+
+    Cells.Reset();
+    for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+    {
+        FItem& Item = Items[ItemIndex];
+        Item.Position = ReadPosition(Item.Entity);
+        Item.Type = Item.Entity->EntityType;
+        InsertIntoCell(ItemIndex, GetCellKey(Item.Position));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("EntitySpatial: Rebuilt %d entities into %d cells of %.0f cm"), Items.Num(), Cells.Num(), CellSize);
+}
+
+void UEntitySpatialSubsystem::AddEntity(UBaseEntity* Entity)
+{
+    if (!Entity || ItemByEntityID.Contains(Entity->EntityID))
+    {
+        return;
+    }
+
+    const int32 ItemIndex = Items.AddUninitialized();
+    FItem& Item = Items[ItemIndex];
+    Item.Entity = Entity;
+    Item.Position = ReadPosition(Entity);
+    Item.Type = Entity->EntityType;
+    ItemByEntityID.Add(Entity->EntityID, ItemIndex);
+    InsertIntoCell(ItemIndex, GetCellKey(Item.Position));
+}
+
+void UEntitySpatialSubsystem::RemoveEntity(UBaseEntity* Entity)
+{
+    int32 ItemIndex = INDEX_NONE;
+    if (!Entity || !ItemByEntityID.RemoveAndCopyValue(Entity->EntityID, ItemIndex))
+    {
+        return;
+    }
+
+    RemoveFromCell(ItemIndex);
+
+    // Move the last item into the hole and repoint its cell entry
+    const int32 LastIndex = Items.Num() - 1;
+    if (ItemIndex != LastIndex)
+    {
+        Items[ItemIndex] = Items[LastIndex];
+        const FItem& Moved = Items[ItemIndex];
+        Cells.FindChecked(Moved.CellKey)[Moved.IndexInCell] = ItemIndex;
+        ItemByEntityID.Add(Moved.Entity->EntityID, ItemIndex);
+    }
+    Items.Pop(EAllowShrinking::No);
+}
+
+bool UEntitySpatialSubsystem::RefreshItem(int32 ItemIndex)
+{
+    FItem& Item = Items[ItemIndex];
+    Item.Position = ReadPosition(Item.Entity);
+    Item.Type = Item.Entity->EntityType;
+
+    const uint64 CellKey = GetCellKey(Item.Position);
+    if (CellKey == Item.CellKey)
+    {
+        return false;
+    }
+
+    RemoveFromCell(ItemIndex);
+    InsertIntoCell(ItemIndex, CellKey);
+    return true;
+}
+
+FVector UEntitySpatialSubsystem::ReadPosition(const UBaseEntity* Entity)
+{
+    const AActor* OwnerActor = Entity->GetOwnerActor();
+    return OwnerActor ? OwnerActor->GetActorLocation() : Entity->GetWorldPosition();
+}
+
+void UEntitySpatialSubsystem::InsertIntoCell(int32 ItemIndex, uint64 CellKey)
+{
+    FItem& Item = Items[ItemIndex];
+    Item.CellKey = CellKey;
+    Item.IndexInCell = Cells.FindOrAdd(CellKey).Add(ItemIndex);
+}
+
+void UEntitySpatialSubsystem::RemoveFromCell(int32 ItemIndex)
+{
+    const FItem& Item = Items[ItemIndex];
+    FCell& Cell = Cells.FindChecked(Item.CellKey);
+
+    Cell.RemoveAtSwap(Item.IndexInCell, 1, EAllowShrinking::No);
+    if (Cell.IsValidIndex(Item.IndexInCell))
+    {
+        Items[Cell[Item.IndexInCell]].IndexInCell = Item.IndexInCell;
+    }
+    else if (Cell.Num() == 0)
+    {
+        Cells.Remove(Item.CellKey);
+    }
+}
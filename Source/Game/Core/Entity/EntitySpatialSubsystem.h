@@ -0,0 +1,132 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/Enums/GameWorldEnums.h"
+#include "EntitySpatialSubsystem.generated.h"
+
+class UBaseEntity;
+class UEntityRegistrySubsystem;
+
+/**
+ * Entity Spatial Subsystem
+ * Uniform spatial hash over every registered entity, for proximity queries that would otherwise scan
+ * all actors. The grid is 2D: XY cells of CellSize, keyed into a hash map so only occupied cells
+ * exist; heights are checked per entity. Entities enter and leave with the entity registry.
+ *
+ * Each tick positions are read from the owning actor (or the registry's position column for
+ * entities without one), and an entity only changes cells when it crosses a cell boundary. Queries
+ * see positions as of the last tick; call UpdateEntity after a teleport to move an entity sooner.
+ * Game thread only.
+ */
+UCLASS()
+class GAME_API UEntitySpatialSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UEntitySpatialSubsystem();
+
+    /** Spatial index of the object's world, nullptr if it has none */
+    static UEntitySpatialSubsystem* Get(const UObject* WorldContextObject);
+
+    // UTickableWorldSubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // === Queries ===
+    // Type filters by entity type; EEntityType::Invalid matches every type.
+
+    /** Append entities within Radius of Center; returns the number added */
+    int32 FindEntitiesInRadius(const FVector& Center, float Radius, TArray<UBaseEntity*>& OutEntities, EEntityType Type = EEntityType::Invalid) const;
+
+    /** Append entities inside Box; returns the number added */
+    int32 FindEntitiesInBox(const FBox& Box, TArray<UBaseEntity*>& OutEntities, EEntityType Type = EEntityType::Invalid) const;
+
+    /**
+     * Append up to Count entities nearest to Center, nearest first. MaxRadius <= 0 searches
+     * unbounded; Exclude (usually the asking entity) is skipped. Returns the number added
+     */
+    int32 FindNearestEntities(const FVector& Center, int32 Count, TArray<UBaseEntity*>& OutEntities, float MaxRadius = 0.0f,
+                              EEntityType Type = EEntityType::Invalid, const UBaseEntity* Exclude = nullptr) const;
+
+    UBaseEntity* FindNearestEntity(const FVector& Center, float MaxRadius = 0.0f, EEntityType Type = EEntityType::Invalid, const UBaseEntity* Exclude = nullptr) const;
+
+    /** Owning actors of the entities within Radius; entities without a live actor are skipped */
+    int32 FindActorsInRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, EEntityType Type = EEntityType::Invalid) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Spatial")
+    TArray<UBaseEntity*> GetEntitiesInRadius(FVector Center, float Radius) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Spatial")
+    TArray<UBaseEntity*> GetNearestEntities(FVector Center, int32 Count, float MaxRadius = 0.0f) const;
+
+    // === Maintenance ===
+
+    /** Re-read one entity's position and move it between cells now rather than at the next tick */
+    void UpdateEntity(UBaseEntity* Entity);
+
+    /** Re-bucket every entity, e.g. after changing CellSize */
+    void Rebuild();
+
+    int32 GetNumEntities() const { return Items.Num(); }
+    int32 GetNumCells() const { return Cells.Num(); }
+
+    /** Entities that changed cells during the last tick */
+    int32 GetLastCellMoves() const { return LastCellMoves; }
+
+    /** Cell edge in cm; roughly the most common query radius works well */
+    UPROPERTY(EditAnywhere, Category = "Entity Spatial")
+    float CellSize;
+
+private:
+    struct FItem
+    {
+        UBaseEntity* Entity;
+        FVector Position;
+        uint64 CellKey;
+        int32 IndexInCell;
+        EEntityType Type;
+    };
+
+    typedef TArray<int32, TInlineAllocator<8>> FCell;
+
+    void AddEntity(UBaseEntity* Entity);
+    void RemoveEntity(UBaseEntity* Entity);
+
+    /** Refresh an item's position and type, moving it if it crossed into another cell; true if it moved */
+    bool RefreshItem(int32 ItemIndex);
+
+    static FVector ReadPosition(const UBaseEntity* Entity);
+
+    int32 ToCell(double Coordinate) const { return FMath::FloorToInt32(Coordinate * InvCellSize); }
+    uint64 GetCellKey(const FVector& Position) const { return MakeCellKey(ToCell(Position.X), ToCell(Position.Y)); }
+    static uint64 MakeCellKey(int32 X, int32 Y) { return ((uint64)(uint32)X << 32) | (uint32)Y; }
+    static int32 GetCellX(uint64 CellKey) { return (int32)(uint32)(CellKey >> 32); }
+    static int32 GetCellY(uint64 CellKey) { return (int32)(uint32)CellKey; }
+
+    void InsertIntoCell(int32 ItemIndex, uint64 CellKey);
+    void RemoveFromCell(int32 ItemIndex);
+
+    /** Call Visitor(ItemIndex) for every item in the cells overlapping the XY rectangle [Min, Max] */
+    template<typename VisitorType>
+    void ForEachItemInRect(const FVector& Min, const FVector& Max, VisitorType&& Visitor) const;
+
+    bool MatchesType(const FItem& Item, EEntityType Type) const { return Type == EEntityType::Invalid || Item.Type == Type; }
+
+    TWeakObjectPtr<UEntityRegistrySubsystem> Registry;
+    FDelegateHandle EntityRegisteredHandle;
+    FDelegateHandle EntityUnregisteredHandle;
+
+    /** Packed items; removal swaps the last item into the hole */
+    TArray<FItem> Items;
+    TMap<int32, int32> ItemByEntityID;
+
+    /** Occupied cells only; a cell is dropped when its last item leaves */
+    TMap<uint64, FCell> Cells;
+
+    float InvCellSize;
+    int32 LastCellMoves;
+};
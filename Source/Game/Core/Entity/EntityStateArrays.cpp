@@ -0,0 +1,99 @@
+#include "EntityStateArrays.h"
+
+int32 FEntityStateArrays::Add(const FEntityHotStateRow& Row)
+{
+    MaxHealth.Add(Row.MaxHealth);
+    Health.Add(Row.CurrentHealth);
+    Active.Add(Row.bIsActive);
+    Spawned.Add(Row.bIsSpawned);
+    Alive.Add(Row.bIsAlive);
+    Invulnerable.Add(Row.bIsInvulnerable);
+    Positions.Add(Row.WorldPosition);
+    Rotations.Add(Row.WorldRotation);
+    Scales.Add(Row.WorldScale);
+    States.Add(Row.CurrentState);
+    PreviousStates.Add(Row.PreviousState);
+    return StateTimers.Add(Row.StateTimer);
+}
+
+void FEntityStateArrays::RemoveAtSwap(int32 Slot)
+{
+    MaxHealth.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Health.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Active.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Spawned.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Alive.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Invulnerable.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Positions.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Rotations.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Scales.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    States.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    PreviousStates.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    StateTimers.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+}
+
+FEntityHotStateRow FEntityStateArrays::GetRow(int32 Slot) const
+{
+    FEntityHotStateRow Row;
+    Row.MaxHealth = MaxHealth[Slot];
+    Row.CurrentHealth = Health[Slot];
+    Row.bIsActive = Active[Slot];
+    Row.bIsSpawned = Spawned[Slot];
+    Row.bIsAlive = Alive[Slot];
+    Row.bIsInvulnerable = Invulnerable[Slot];
+    Row.WorldPosition = Positions[Slot];
+    Row.WorldRotation = Rotations[Slot];
+    Row.WorldScale = Scales[Slot];
+    Row.CurrentState = States[Slot];
+    Row.PreviousState = PreviousStates[Slot];
+    Row.StateTimer = StateTimers[Slot];
+    return Row;
+}
+
+void FEntityStateArrays::SetRow(int32 Slot, const FEntityHotStateRow& Row)
+{
+    MaxHealth[Slot] = Row.MaxHealth;
+    Health[Slot] = Row.CurrentHealth;
+    Active[Slot] = Row.bIsActive;
+    Spawned[Slot] = Row.bIsSpawned;
+    Alive[Slot] = Row.bIsAlive;
+    Invulnerable[Slot] = Row.bIsInvulnerable;
+    Positions[Slot] = Row.WorldPosition;
+    Rotations[Slot] = Row.WorldRotation;
+    Scales[Slot] = Row.WorldScale;
+    States[Slot] = Row.CurrentState;
+    PreviousStates[Slot] = Row.PreviousState;
+    StateTimers[Slot] = Row.StateTimer;
+}
+
+void FEntityStateArrays::Reserve(int32 Number)
+{
+    MaxHealth.Reserve(Number);
+    Health.Reserve(Number);
+    Active.Reserve(Number);
+    Spawned.Reserve(Number);
+    Alive.Reserve(Number);
+    Invulnerable.Reserve(Number);
+    Positions.Reserve(Number);
+    Rotations.Reserve(Number);
+    Scales.Reserve(Number);
+    States.Reserve(Number);
+    PreviousStates.Reserve(Number);
+    StateTimers.Reserve(Number);
+}
+
+void FEntityStateArrays::Empty()
+{
+    MaxHealth.Empty();
+    Health.Empty();
+    Active.Empty();
+    Spawned.Empty();
+    Alive.Empty();
+    Invulnerable.Empty();
+    Positions.Empty();
+    Rotations.Empty();
+    Scales.Empty();
+    States.Empty();
+    PreviousStates.Empty();
+    StateTimers.Empty();
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/GameWorldEnums.h"
+#include "EntityStateArrays.generated.h"
+
+/**
+ * One entity's hot state as a plain row
+ * Holds the defaults and the live values of an entity that isn't registered with a world;
+ * copied into FEntityStateArrays on registration and back out on unregistration.
+ */
+USTRUCT(BlueprintType)
+struct GAME_API FEntityHotStateRow
+{
+    GENERATED_BODY()
+
+    // Health & Status
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
+    float MaxHealth = 100.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
+    float CurrentHealth = 100.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
+    bool bIsActive = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
+    bool bIsSpawned = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
+    bool bIsAlive = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Health")
+    bool bIsInvulnerable = false;
+
+    // Spatial Properties
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Spatial")
+    FVector WorldPosition = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Spatial")
+    FRotator WorldRotation = FRotator::ZeroRotator;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity Spatial")
+    FVector WorldScale = FVector::OneVector;
+
+    // Entity State
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity State")
+    EEntityState CurrentState = EEntityState::Idle;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity State")
+    EEntityState PreviousState = EEntityState::Idle;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity State")
+    float StateTimer = 0.0f;
+};
+
+/**
+ * Structure-of-arrays storage for the hot state of every entity in a world
+ * Owned by UEntityRegistrySubsystem and indexed by registry slot, so every column is dense and
+ * slot-aligned. Bulk systems read and write whole columns instead of touching each UBaseEntity.
+ */
+struct GAME_API FEntityStateArrays
+{
+    // Health & Status
+    TArray<float> MaxHealth;
+    TArray<float> Health;
+    TArray<bool> Active;
+    TArray<bool> Spawned;
+    TArray<bool> Alive;
+    TArray<bool> Invulnerable;
+
+    // Spatial
+    TArray<FVector> Positions;
+    TArray<FRotator> Rotations;
+    TArray<FVector> Scales;
+
+    // State
+    TArray<EEntityState> States;
+    TArray<EEntityState> PreviousStates;
+    TArray<float> StateTimers;
+
+    int32 Num() const { return Health.Num(); }
+
+    /** Append a row; returns its slot */
+    int32 Add(const FEntityHotStateRow& Row);
+
+    /** Move the last row into Slot, matching TArray::RemoveAtSwap on the registry's entity array */
+    void RemoveAtSwap(int32 Slot);
+
+    FEntityHotStateRow GetRow(int32 Slot) const;
+    void SetRow(int32 Slot, const FEntityHotStateRow& Row);
+
+    void Reserve(int32 Number);
+    void Empty();
+};
@@ -0,0 +1,630 @@
+#include "EntityStateRecorder.h"
+#include "EntityRegistrySubsystem.h"
+#include "BaseEntity.h"
+#include "Tasks/TaskManager.h"
+#include "Tasks/TaskTypeRegistry.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+
+namespace EntityStateRecorderCodec
+{
+    static constexpr uint8 NoTask = 0xFF;
+
+    FORCEINLINE uint32 ZigZag(int32 Value)
+    {
+        return ((uint32)Value << 1) ^ (uint32)(Value >> 31);
+    }
+
+    FORCEINLINE int32 UnZigZag(uint32 Value)
+    {
+        return (int32)(Value >> 1) ^ -(int32)(Value & 1);
+    }
+
+    FORCEINLINE void WriteVarUInt(TArray<uint8>& Out, uint32 Value)
+    {
+        while (Value >= 0x80)
+        {
+            Out.Add((uint8)(Value | 0x80));
+            Value >>= 7;
+        }
+        Out.Add((uint8)Value);
+    }
+
+    FORCEINLINE uint32 ReadVarUInt(const uint8*& Ptr)
+    {
+        uint32 Value = 0;
+        int32 Shift = 0;
+        uint8 Byte;
+        do
+        {
+            Byte = *Ptr++;
+            Value |= (uint32)(Byte & 0x7F) << Shift;
+            Shift += 7;
+        } while (Byte & 0x80);
+        return Value;
+    }
+
+    /** Wrapping difference, so deltas of far-apart values never overflow */
+    FORCEINLINE int32 Delta(int32 New, int32 Old)
+    {
+        return (int32)((uint32)New - (uint32)Old);
+    }
+
+    FORCEINLINE int32 Apply(int32 Old, int32 Delta)
+    {
+        return (int32)((uint32)Old + (uint32)Delta);
+    }
+
+    FORCEINLINE int32 Quantize(double Value, float Precision)
+    {
+        return (int32)FMath::Clamp<double>(FMath::RoundToDouble(Value / Precision), (double)MIN_int32, (double)MAX_int32);
+    }
+}
+
+using namespace EntityStateRecorderCodec;
+
+UEntityStateRecorder::UEntityStateRecorder()
+{
+    MemoryBudgetKB = 4096;
+    KeyframeInterval = 30;
+    PositionPrecision = 0.5f;
+    HealthPrecision = 0.1f;
+    bValidateSamples = false;
+
+    bRecording = false;
+    FramesSinceKeyframe = 0;
+    LastRecordTimeMs = 0.0f;
+    WriteOffset = 0;
+}
+
+void UEntityStateRecorder::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!bRecording)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    UEntityRegistrySubsystem* Registry = World ? World->GetSubsystem<UEntityRegistrySubsystem>() : nullptr;
+    if (Registry)
+    {
+        RecordFrame(*Registry, World->GetTimeSeconds());
+    }
+}
+
+TStatId UEntityStateRecorder::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEntityStateRecorder, STATGROUP_Tickables);
+}
+
+void UEntityStateRecorder::Deinitialize()
+{
+    StopRecording();
+    ClearHistory();
+    Ring.Empty();
+
+    Super::Deinitialize();
+}
+
+// === Recording ===
+
+void UEntityStateRecorder::StartRecording()
+{
+    const int64 Capacity = FMath::Max(MemoryBudgetKB, 64) * 1024ll;
+    if (Ring.Num() != Capacity)
+    {
+        ClearHistory();
+        Ring.SetNumUninitialized(Capacity);
+    }
+
+    bRecording = true;
+    UE_LOG(LogTemp, Log, TEXT("EntityStateRecorder: Recording into a %lld KB ring"), Capacity / 1024);
+}
+
+void UEntityStateRecorder::StopRecording()
+{
+    bRecording = false;
+}
+
+void UEntityStateRecorder::ClearHistory()
+{
+    Frames.Empty();
+    WriteOffset = 0;
+    FramesSinceKeyframe = 0;
+    PreviousIDs.Reset();
+    PreviousSample.Reset();
+    LastLocations.Reset();
+}
+
+int64 UEntityStateRecorder::GetUsedBytes() const
+{
+    int64 UsedBytes = 0;
+    for (int32 Index = 0; Index < Frames.Num(); ++Index)
+    {
+        UsedBytes += Frames[Index].Size;
+    }
+    return UsedBytes;
+}
+
+void UEntityStateRecorder::RecordFrame(UEntityRegistrySubsystem& Registry, double Time)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    const bool bEntitySetChanged = Sample(Registry);
+
+#if !UE_BUILD_SHIPPING
+    if (bValidateSamples)
+    {
+        ensureMsgf(ValidateMovedEntities(Registry, bEntitySetChanged), TEXT("EntityStateRecorder: A moved entity recorded no position delta"));
+    }
+#endif
+    const bool bPrecisionChanged = Frames.Num() > 0 &&
+        (Frames.Last().PositionPrecision != PositionPrecision || Frames.Last().HealthPrecision != HealthPrecision);
+    bool bKeyframe = Frames.Num() == 0 || bEntitySetChanged || bPrecisionChanged || FramesSinceKeyframe + 1 >= KeyframeInterval;
+
+    int64 Offset = INDEX_NONE;
+    while (true)
+    {
+        Scratch.Reset();
+        bKeyframe ? EncodeKeyframe() : EncodeDelta();
+        if (Scratch.Num() == 0)
+        {
+            Scratch.Add(0); // Every frame occupies at least one byte of the ring
+        }
+
+        Offset = AllocateFrameBytes(Scratch.Num());
+        if (Offset == INDEX_NONE || bKeyframe || Frames.Num() > 0)
+        {
+            break;
+        }
+
+        // Eviction took the frame this delta was based on; store a keyframe instead
+        bKeyframe = true;
+    }
+
+    if (Offset == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("EntityStateRecorder: A %d byte frame doesn't fit the %d KB budget; recording stopped"),
+               Scratch.Num(), MemoryBudgetKB);
+        StopRecording();
+        return;
+    }
+
+    FMemory::Memcpy(Ring.GetData() + Offset, Scratch.GetData(), Scratch.Num());
+    WriteOffset = Offset + Scratch.Num();
+
+    FFrame& Frame = Frames.AddDefaulted_GetRef();
+    Frame.Time = Time;
+    Frame.Offset = Offset;
+    Frame.Size = Scratch.Num();
+    Frame.NumEntities = CurrentIDs.Num();
+    Frame.bKeyframe = bKeyframe;
+    Frame.PositionPrecision = PositionPrecision;
+    Frame.HealthPrecision = HealthPrecision;
+
+    FramesSinceKeyframe = bKeyframe ? 0 : FramesSinceKeyframe + 1;
+    Swap(PreviousIDs, CurrentIDs);
+    Swap(PreviousSample, CurrentSample);
+
+    LastRecordTimeMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+bool UEntityStateRecorder::Sample(UEntityRegistrySubsystem& Registry)
+{
+    const TArray<UBaseEntity*>& Entities = Registry.GetEntities();
+    const FEntityStateArrays& State = Registry.GetStateArrays();
+    const int32 NumEntities = Entities.Num();
+
+    CurrentIDs.SetNumUninitialized(NumEntities);
+    CurrentSample.SetNumUninitialized(NumEntities);
+
+    bool bEntitySetChanged = NumEntities != PreviousIDs.Num();
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        const int32 EntityID = Entities[Index]->EntityID;
+        bEntitySetChanged |= !bEntitySetChanged && PreviousIDs[Index] != EntityID;
+        CurrentIDs[Index] = EntityID;
+
+        // The transform columns only change through SetWorldPosition; a moving actor's own transform is current
+        const AActor* OwnerActor = Entities[Index]->GetOwnerActor();
+        const FVector Position = OwnerActor ? OwnerActor->GetActorLocation() : State.Positions[Index];
+        const FRotator Rotation = OwnerActor ? OwnerActor->GetActorRotation() : State.Rotations[Index];
+
+        FQuantizedState& Quantized = CurrentSample[Index];
+        Quantized.Position[0] = Quantize(Position.X, PositionPrecision);
+        Quantized.Position[1] = Quantize(Position.Y, PositionPrecision);
+        Quantized.Position[2] = Quantize(Position.Z, PositionPrecision);
+        Quantized.Rotation[0] = FRotator::CompressAxisToShort(Rotation.Pitch);
+        Quantized.Rotation[1] = FRotator::CompressAxisToShort(Rotation.Yaw);
+        Quantized.Rotation[2] = FRotator::CompressAxisToShort(Rotation.Roll);
+        Quantized.Health = Quantize(State.Health[Index], HealthPrecision);
+        Quantized.State = (uint8)State.States[Index];
+    }
+
+    // Resolving task managers walks actor components, so only do it when the entity set changes
+    if (bEntitySetChanged || TaskManagers.Num() != NumEntities)
+    {
+        TaskManagers.SetNum(NumEntities);
+        for (int32 Index = 0; Index < NumEntities; ++Index)
+        {
+            AActor* OwnerActor = Entities[Index]->GetOwnerActor();
+            TaskManagers[Index] = OwnerActor ? OwnerActor->FindComponentByClass<UTaskManager>() : nullptr;
+        }
+    }
+
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        CurrentSample[Index].TaskTypeId = SampleTaskTypeId(Index);
+    }
+
+    return bEntitySetChanged;
+}
+
+bool UEntityStateRecorder::ValidateMovedEntities(const UEntityRegistrySubsystem& Registry, bool bEntitySetChanged)
+{
+    // Locations are tracked here independently of Sample, so a sample that stops following its source shows up
+    const TArray<UBaseEntity*>& Entities = Registry.GetEntities();
+    const int32 NumEntities = Entities.Num();
+    const bool bComparable = !bEntitySetChanged && LastLocations.Num() == NumEntities && PreviousSample.Num() == NumEntities;
+    LastLocations.SetNumUninitialized(NumEntities, EAllowShrinking::No);
+
+    bool bValid = true;
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        const AActor* OwnerActor = Entities[Index]->GetOwnerActor();
+        const FVector Location = OwnerActor ? OwnerActor->GetActorLocation() : Entities[Index]->GetWorldPosition();
+
+        // A full quantum along any axis always changes that axis' quantised value
+        if (bComparable && (Location - LastLocations[Index]).GetAbsMax() >= PositionPrecision &&
+            FMemory::Memcmp(CurrentSample[Index].Position, PreviousSample[Index].Position, sizeof(FQuantizedState::Position)) == 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("EntityStateRecorder: Entity %d moved %.1f cm but its sample didn't change"),
+                   CurrentIDs[Index], FVector::Dist(Location, LastLocations[Index]));
+            bValid = false;
+        }
+        LastLocations[Index] = Location;
+    }
+    return bValid;
+}
+
+uint8 UEntityStateRecorder::SampleTaskTypeId(int32 Index)
+{
+    const UTaskManager* TaskManager = TaskManagers[Index].Get();
+    const UBaseTask* Task = TaskManager ? TaskManager->GetCurrentTask() : nullptr;
+    if (!Task)
+    {
+        return NoTask;
+    }
+
+    const UClass* TaskClass = Task->GetClass();
+    if (const uint8* TypeId = TaskTypeIdCache.Find(TaskClass))
+    {
+        return *TypeId;
+    }
+    return TaskTypeIdCache.Add(TaskClass, (uint8)FTaskTypeRegistry::FindTypeIdForClass(TaskClass));
+}
+
+void UEntityStateRecorder::EncodeKeyframe()
+{
+    int32 PreviousID = 0;
+    for (int32 Index = 0; Index < CurrentIDs.Num(); ++Index)
+    {
+        const FQuantizedState& Quantized = CurrentSample[Index];
+        WriteVarUInt(Scratch, ZigZag(Delta(CurrentIDs[Index], PreviousID)));
+        PreviousID = CurrentIDs[Index];
+
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            WriteVarUInt(Scratch, ZigZag(Quantized.Position[Axis]));
+        }
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            WriteVarUInt(Scratch, Quantized.Rotation[Axis]);
+        }
+        WriteVarUInt(Scratch, ZigZag(Quantized.Health));
+        Scratch.Add(Quantized.State);
+        Scratch.Add(Quantized.TaskTypeId);
+    }
+}
+
+void UEntityStateRecorder::EncodeDelta()
+{
+    // Changed-entity bitmask up front, then only the changed entities
+    const int32 NumEntities = CurrentIDs.Num();
+    const int32 MaskOffset = Scratch.AddZeroed((NumEntities + 7) >> 3);
+
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        const FQuantizedState& Quantized = CurrentSample[Index];
+        const FQuantizedState& Previous = PreviousSample[Index];
+
+        uint8 FieldMask = 0;
+        if (Quantized.Position[0] != Previous.Position[0] || Quantized.Position[1] != Previous.Position[1] || Quantized.Position[2] != Previous.Position[2])
+        {
+            FieldMask |= Field_Position;
+        }
+        if (Quantized.Rotation[0] != Previous.Rotation[0] || Quantized.Rotation[1] != Previous.Rotation[1] || Quantized.Rotation[2] != Previous.Rotation[2])
+        {
+            FieldMask |= Field_Rotation;
+        }
+        FieldMask |= Quantized.Health != Previous.Health ? Field_Health : 0;
+        FieldMask |= Quantized.State != Previous.State ? Field_State : 0;
+        FieldMask |= Quantized.TaskTypeId != Previous.TaskTypeId ? Field_Task : 0;
+
+        if (FieldMask == 0)
+        {
+            continue;
+        }
+
+        Scratch[MaskOffset + (Index >> 3)] |= 1 << (Index & 7);
+        Scratch.Add(FieldMask);
+        if (FieldMask & Field_Position)
+        {
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                WriteVarUInt(Scratch, ZigZag(Delta(Quantized.Position[Axis], Previous.Position[Axis])));
+            }
+        }
+        if (FieldMask & Field_Rotation)
+        {
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                WriteVarUInt(Scratch, ZigZag((int16)(Quantized.Rotation[Axis] - Previous.Rotation[Axis])));
+            }
+        }
+        if (FieldMask & Field_Health)
+        {
+            WriteVarUInt(Scratch, ZigZag(Delta(Quantized.Health, Previous.Health)));
+        }
+        if (FieldMask & Field_State)
+        {
+            Scratch.Add(Quantized.State);
+        }
+        if (FieldMask & Field_Task)
+        {
+            Scratch.Add(Quantized.TaskTypeId);
+        }
+    }
+}
+
+int64 UEntityStateRecorder::AllocateFrameBytes(int32 Size)
+{
+    const int64 Capacity = Ring.Num();
+    if (Size > Capacity)
+    {
+        return INDEX_NONE;
+    }
+
+    while (Frames.Num() > 0)
+    {
+        // Live bytes run from the oldest frame to WriteOffset, possibly wrapping past the end.
+        // Gaps are kept strictly positive so WriteOffset == Oldest never means "full"
+        const int64 Oldest = Frames.First().Offset;
+        if (WriteOffset > Oldest)
+        {
+            if (Capacity - WriteOffset >= Size)
+            {
+                return WriteOffset;
+            }
+            if (Oldest > Size)
+            {
+                return 0;
+            }
+        }
+        else if (Oldest - WriteOffset > Size)
+        {
+            return WriteOffset;
+        }
+
+        EvictOldestFrame();
+    }
+    return 0;
+}
+
+void UEntityStateRecorder::EvictOldestFrame()
+{
+    // History must start on a keyframe, so deltas that lost their base go too
+    Frames.PopFront();
+    while (Frames.Num() > 0 && !Frames.First().bKeyframe)
+    {
+        Frames.PopFront();
+    }
+}
+
+// === Scrubbing ===
+
+double UEntityStateRecorder::DecodeAtTime(double Time, TArray<FEntityRecordedState>& OutStates) const
+{
+    OutStates.Reset();
+    const int32 FrameIndex = FindFrameAtTime(Time);
+    if (FrameIndex == INDEX_NONE)
+    {
+        return -1.0;
+    }
+
+    TArray<int32> IDs;
+    TArray<FQuantizedState> States;
+    DecodeRange(FindKeyframeAtOrBefore(FrameIndex), FrameIndex, IDs, States);
+    Dequantize(Frames[FrameIndex], IDs, States, OutStates);
+    return Frames[FrameIndex].Time;
+}
+
+bool UEntityStateRecorder::ExportWindow(double StartTime, double EndTime, const FString& FilePath) const
+{
+    if (Frames.Num() == 0 || EndTime < StartTime)
+    {
+        return false;
+    }
+
+    // Start from the frame in effect at StartTime, decoding forward from its keyframe
+    int32 FirstFrame = FindFrameAtTime(StartTime);
+    FirstFrame = FirstFrame == INDEX_NONE ? 0 : FirstFrame;
+
+    FString Csv = TEXT("Time,EntityID,X,Y,Z,Pitch,Yaw,Roll,Health,State,Task\n");
+    TArray<int32> IDs;
+    TArray<FQuantizedState> States;
+    TArray<FEntityRecordedState> Decoded;
+
+    int32 FrameIndex = FindKeyframeAtOrBefore(FirstFrame);
+    DecodeRange(FrameIndex, FirstFrame, IDs, States);
+    for (FrameIndex = FirstFrame; FrameIndex < Frames.Num() && Frames[FrameIndex].Time <= EndTime; ++FrameIndex)
+    {
+        if (FrameIndex > FirstFrame)
+        {
+            DecodeRange(FrameIndex, FrameIndex, IDs, States);
+        }
+
+        const FFrame& Frame = Frames[FrameIndex];
+        Dequantize(Frame, IDs, States, Decoded);
+        for (const FEntityRecordedState& State : Decoded)
+        {
+            const FName TaskName = FTaskTypeRegistry::GetTypeName((ETaskTypeId)State.TaskTypeId);
+            Csv += FString::Printf(TEXT("%.4f,%d,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%s,%s\n"),
+                                   Frame.Time, State.EntityID,
+                                   State.Position.X, State.Position.Y, State.Position.Z,
+                                   State.Rotation.Pitch, State.Rotation.Yaw, State.Rotation.Roll,
+                                   State.Health, *UEnum::GetValueAsString(State.State), *TaskName.ToString());
+        }
+    }
+
+    if (!FFileHelper::SaveStringToFile(Csv, *FilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("EntityStateRecorder: Failed to export to '%s'"), *FilePath);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("EntityStateRecorder: Exported frames %.3f-%.3f to '%s'"), StartTime, EndTime, *FilePath);
+    return true;
+}
+
+void UEntityStateRecorder::DecodeRange(int32 KeyframeIndex, int32 FrameIndex, TArray<int32>& OutIDs, TArray<FQuantizedState>& OutStates) const
+{
+    for (int32 Index = KeyframeIndex; Index <= FrameIndex; ++Index)
+    {
+        const FFrame& Frame = Frames[Index];
+        const int32 NumEntities = Frame.NumEntities;
+        const uint8* Ptr = Ring.GetData() + Frame.Offset;
+
+        if (Frame.bKeyframe)
+        {
+            OutIDs.SetNumUninitialized(NumEntities);
+            OutStates.SetNumUninitialized(NumEntities);
+
+            int32 PreviousID = 0;
+            for (int32 Entity = 0; Entity < NumEntities; ++Entity)
+            {
+                FQuantizedState& State = OutStates[Entity];
+                PreviousID = Apply(PreviousID, UnZigZag(ReadVarUInt(Ptr)));
+                OutIDs[Entity] = PreviousID;
+
+                for (int32 Axis = 0; Axis < 3; ++Axis)
+                {
+                    State.Position[Axis] = UnZigZag(ReadVarUInt(Ptr));
+                }
+                for (int32 Axis = 0; Axis < 3; ++Axis)
+                {
+                    State.Rotation[Axis] = (uint16)ReadVarUInt(Ptr);
+                }
+                State.Health = UnZigZag(ReadVarUInt(Ptr));
+                State.State = *Ptr++;
+                State.TaskTypeId = *Ptr++;
+            }
+            continue;
+        }
+
+        check(OutStates.Num() == NumEntities);
+        const uint8* ChangedMask = Ptr;
+        Ptr += (NumEntities + 7) >> 3;
+
+        for (int32 Entity = 0; Entity < NumEntities; ++Entity)
+        {
+            if (!(ChangedMask[Entity >> 3] & (1 << (Entity & 7))))
+            {
+                continue;
+            }
+
+            FQuantizedState& State = OutStates[Entity];
+            const uint8 FieldMask = *Ptr++;
+            if (FieldMask & Field_Position)
+            {
+                for (int32 Axis = 0; Axis < 3; ++Axis)
+                {
+                    State.Position[Axis] = Apply(State.Position[Axis], UnZigZag(ReadVarUInt(Ptr)));
+                }
+            }
+            if (FieldMask & Field_Rotation)
+            {
+                for (int32 Axis = 0; Axis < 3; ++Axis)
+                {
+                    State.Rotation[Axis] = (uint16)(State.Rotation[Axis] + UnZigZag(ReadVarUInt(Ptr)));
+                }
+            }
+            if (FieldMask & Field_Health)
+            {
+                State.Health = Apply(State.Health, UnZigZag(ReadVarUInt(Ptr)));
+            }
+            if (FieldMask & Field_State)
+            {
+                State.State = *Ptr++;
+            }
+            if (FieldMask & Field_Task)
+            {
+                State.TaskTypeId = *Ptr++;
+            }
+        }
+    }
+}
+
+void UEntityStateRecorder::Dequantize(const FFrame& Frame, const TArray<int32>& IDs, const TArray<FQuantizedState>& States, TArray<FEntityRecordedState>& OutStates) const
+{
+    OutStates.SetNum(States.Num());
+    for (int32 Index = 0; Index < States.Num(); ++Index)
+    {
+        const FQuantizedState& State = States[Index];
+        FEntityRecordedState& Out = OutStates[Index];
+        Out.EntityID = IDs[Index];
+        Out.Position = FVector(State.Position[0], State.Position[1], State.Position[2]) * Frame.PositionPrecision;
+        Out.Rotation = FRotator(FRotator::DecompressAxisFromShort(State.Rotation[0]),
+                                FRotator::DecompressAxisFromShort(State.Rotation[1]),
+                                FRotator::DecompressAxisFromShort(State.Rotation[2]));
+        Out.Health = State.Health * Frame.HealthPrecision;
+        Out.State = (EEntityState)State.State;
+        Out.TaskTypeId = State.TaskTypeId;
+    }
+}
+
+int32 UEntityStateRecorder::FindFrameAtTime(double Time) const
+{
+    // Frames are in time order; find the last one at or before Time
+    int32 Low = 0;
+    int32 High = Frames.Num() - 1;
+    int32 Result = INDEX_NONE;
+    while (Low <= High)
+    {
+        const int32 Mid = (Low + High) / 2;
+        if (Frames[Mid].Time <= Time)
+        {
+            Result = Mid;
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid - 1;
+        }
+    }
+    return Result;
+}
+
+int32 UEntityStateRecorder::FindKeyframeAtOrBefore(int32 FrameIndex) const
+{
+    // The oldest frame is always a keyframe, so this terminates
+    while (FrameIndex > 0 && !Frames[FrameIndex].bKeyframe)
+    {
+        --FrameIndex;
+    }
+    return FrameIndex;
+}
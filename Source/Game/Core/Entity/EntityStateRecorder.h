@@ -0,0 +1,184 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/RingBuffer.h"
+#include "Core/Enums/GameWorldEnums.h"
+#include "EntityStateRecorder.generated.h"
+
+class UEntityRegistrySubsystem;
+class UTaskManager;
+
+/** One entity's recorded state, decoded back from the quantised history */
+struct GAME_API FEntityRecordedState
+{
+    int32 EntityID = 0;
+    FVector Position = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    float Health = 0.0f;
+    EEntityState State = EEntityState::Idle;
+    /** ETaskTypeId of the running task, 0xFF when idle */
+    uint8 TaskTypeId = 0xFF;
+};
+
+/**
+ * Entity State Recorder
+ * Keeps the last few seconds of entity state (transform, health, EEntityState, running task) for
+ * debugging and rollback. Each frame samples the owning actors' transforms (the registry's transform
+ * columns for actorless entities) and the registry's health and state columns, quantises them, and
+ * stores them either as a keyframe or as per-field deltas against the previous frame: a changed-entity
+ * bitmask followed by a field mask and zig-zag varint deltas for each changed entity. A keyframe is
+ * forced every KeyframeInterval frames and whenever the set of registered entities changes.
+ *
+ * Frames live in a fixed-size byte ring of MemoryBudgetKB; the oldest frames are evicted as new ones
+ * arrive, always up to the next keyframe so the history starts decodable. Game thread only.
+ */
+UCLASS()
+class GAME_API UEntityStateRecorder : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UEntityStateRecorder();
+
+    // UTickableWorldSubsystem interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual void Deinitialize() override;
+
+    // === Recording ===
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Recorder")
+    void StartRecording();
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Recorder")
+    void StopRecording();
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Recorder")
+    bool IsRecording() const { return bRecording; }
+
+    /** Drop all recorded frames */
+    UFUNCTION(BlueprintCallable, Category = "Entity Recorder")
+    void ClearHistory();
+
+    // === Scrubbing ===
+
+    int32 GetNumFrames() const { return Frames.Num(); }
+    double GetOldestTime() const { return Frames.Num() > 0 ? Frames.First().Time : 0.0; }
+    double GetNewestTime() const { return Frames.Num() > 0 ? Frames.Last().Time : 0.0; }
+
+    /** Bytes of the ring currently holding frames */
+    int64 GetUsedBytes() const;
+
+    /** Decode the latest frame at or before Time; returns its timestamp, or a negative value if none */
+    double DecodeAtTime(double Time, TArray<FEntityRecordedState>& OutStates) const;
+
+    /** Write every recorded frame in [StartTime, EndTime] as CSV, one row per entity per frame */
+    UFUNCTION(BlueprintCallable, Category = "Entity Recorder")
+    bool ExportWindow(double StartTime, double EndTime, const FString& FilePath) const;
+
+    // === Stats ===
+
+    /** Wall time spent sampling and encoding the last frame in milliseconds */
+    float GetLastRecordTimeMs() const { return LastRecordTimeMs; }
+
+    // === Settings ===
+
+    /** Size of the frame ring; also the hard cap on recorder memory */
+    UPROPERTY(EditAnywhere, Category = "Entity Recorder")
+    int32 MemoryBudgetKB;
+
+    UPROPERTY(EditAnywhere, Category = "Entity Recorder")
+    int32 KeyframeInterval;
+
+    /** Position quantum in cm */
+    UPROPERTY(EditAnywhere, Category = "Entity Recorder")
+    float PositionPrecision;
+
+    /** Health quantum in HP */
+    UPROPERTY(EditAnywhere, Category = "Entity Recorder")
+    float HealthPrecision;
+
+    /** Check every frame that entities which moved a full position quantum were recorded as moved (non-shipping builds) */
+    UPROPERTY(EditAnywhere, Category = "Entity Recorder")
+    bool bValidateSamples;
+
+private:
+    /** Quantised sample of one entity */
+    struct FQuantizedState
+    {
+        int32 Position[3];
+        uint16 Rotation[3];
+        int32 Health;
+        uint8 State;
+        uint8 TaskTypeId;
+    };
+
+    struct FFrame
+    {
+        double Time;
+        int64 Offset;
+        int32 Size;
+        int32 NumEntities;
+        bool bKeyframe;
+        /** Quantisation settings in effect when the frame was written */
+        float PositionPrecision;
+        float HealthPrecision;
+    };
+
+    enum EFieldMask : uint8
+    {
+        Field_Position = 1 << 0,
+        Field_Rotation = 1 << 1,
+        Field_Health = 1 << 2,
+        Field_State = 1 << 3,
+        Field_Task = 1 << 4
+    };
+
+    void RecordFrame(UEntityRegistrySubsystem& Registry, double Time);
+
+    /** Quantise the current registry state into CurrentSample; true if the entity set changed */
+    bool Sample(UEntityRegistrySubsystem& Registry);
+
+    uint8 SampleTaskTypeId(int32 Index);
+
+    /** Check the new sample against each entity's location last frame; logs and returns false if a move went unrecorded */
+    bool ValidateMovedEntities(const UEntityRegistrySubsystem& Registry, bool bEntitySetChanged);
+
+    void EncodeKeyframe();
+    void EncodeDelta();
+
+    /** Reserve Size contiguous bytes in the ring, evicting old frames; INDEX_NONE if it can never fit */
+    int64 AllocateFrameBytes(int32 Size);
+    void EvictOldestFrame();
+
+    /** Decode frames [KeyframeIndex, FrameIndex] into quantised states */
+    void DecodeRange(int32 KeyframeIndex, int32 FrameIndex, TArray<int32>& OutIDs, TArray<FQuantizedState>& OutStates) const;
+    void Dequantize(const FFrame& Frame, const TArray<int32>& IDs, const TArray<FQuantizedState>& States, TArray<FEntityRecordedState>& OutStates) const;
+
+    /** Index of the latest frame at or before Time, INDEX_NONE if Time is before the history */
+    int32 FindFrameAtTime(double Time) const;
+    int32 FindKeyframeAtOrBefore(int32 FrameIndex) const;
+
+    bool bRecording;
+    int32 FramesSinceKeyframe;
+    float LastRecordTimeMs;
+
+    TArray<uint8> Ring;
+    int64 WriteOffset;
+    TRingBuffer<FFrame> Frames;
+
+    // Sampling state
+    TArray<int32> CurrentIDs;
+    TArray<FQuantizedState> CurrentSample;
+    TArray<int32> PreviousIDs;
+    TArray<FQuantizedState> PreviousSample;
+    TArray<uint8> Scratch;
+
+    /** Entity locations seen by the last ValidateMovedEntities */
+    TArray<FVector> LastLocations;
+
+    /** Task manager of each sampled entity, refreshed when the entity set changes */
+    TArray<TWeakObjectPtr<UTaskManager>> TaskManagers;
+    TMap<const UClass*, uint8> TaskTypeIdCache;
+};
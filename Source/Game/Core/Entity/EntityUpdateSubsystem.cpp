@@ -0,0 +1,241 @@
+#include "EntityUpdateSubsystem.h"
+#include "EntityRegistrySubsystem.h"
+#include "BaseEntity.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+UEntityUpdateSubsystem::UEntityUpdateSubsystem()
+{
+    DenseSweepThreshold = 0.25f;
+    NextEffectHandle = 1;
+    LastDeathCount = 0;
+    LastKernelTimeMs = 0.0f;
+}
+
+void UEntityUpdateSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    UEntityRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UEntityRegistrySubsystem>() : nullptr;
+    if (!Registry || Registry->GetNumEntities() == 0)
+    {
+        PendingEvents.Reset();
+        return;
+    }
+
+    RunKernel(*Registry, DeltaTime);
+}
+
+TStatId UEntityUpdateSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEntityUpdateSubsystem, STATGROUP_Tickables);
+}
+
+// === Health Events ===
+
+void UEntityUpdateSubsystem::QueueDamage(UBaseEntity* Entity, float DamageAmount)
+{
+    if (Entity && DamageAmount > 0.0f)
+    {
+        PendingEvents.Add({ Entity->EntityID, DamageAmount, 0.0f });
+    }
+}
+
+void UEntityUpdateSubsystem::QueueHeal(UBaseEntity* Entity, float HealAmount)
+{
+    if (Entity && HealAmount > 0.0f)
+    {
+        PendingEvents.Add({ Entity->EntityID, 0.0f, HealAmount });
+    }
+}
+
+// === Health Effects ===
+
+int32 UEntityUpdateSubsystem::AddHealthEffect(UBaseEntity* Entity, float DamagePerSecond, float Duration)
+{
+    if (!Entity || DamagePerSecond == 0.0f)
+    {
+        return 0;
+    }
+
+    const int32 Handle = NextEffectHandle++;
+    HealthEffects.Add({ Handle, Entity->EntityID, DamagePerSecond, Duration > 0.0f ? Duration : -1.0f });
+    return Handle;
+}
+
+void UEntityUpdateSubsystem::RemoveHealthEffect(int32 EffectHandle)
+{
+    const int32 Index = HealthEffects.IndexOfByPredicate([EffectHandle](const FHealthEffect& Effect) { return Effect.Handle == EffectHandle; });
+    if (Index != INDEX_NONE)
+    {
+        HealthEffects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+}
+
+int32 UEntityUpdateSubsystem::RemoveHealthEffects(UBaseEntity* Entity)
+{
+    if (!Entity)
+    {
+        return 0;
+    }
+
+    const int32 EntityID = Entity->EntityID;
+    return HealthEffects.RemoveAllSwap([EntityID](const FHealthEffect& Effect) { return Effect.EntityID == EntityID; }, false);
+}
+
+// === Kernel ===
+
+void UEntityUpdateSubsystem::RunKernel(UEntityRegistrySubsystem& Registry, float DeltaTime)
+{
+    const double KernelStartTime = FPlatformTime::Seconds();
+
+    FEntityStateArrays& State = Registry.GetStateArrays();
+    const int32 NumSlots = State.Num();
+
+    // State timers: one branch-free sweep over every slot
+    {
+        float* RESTRICT Timers = State.StateTimers.GetData();
+        const bool* RESTRICT Spawned = State.Spawned.GetData();
+        const bool* RESTRICT Active = State.Active.GetData();
+        for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+        {
+            Timers[Slot] += (Spawned[Slot] & Active[Slot]) ? DeltaTime : 0.0f;
+        }
+    }
+
+    // Gather this frame's damage and healing into the per-slot accumulators
+    DamageAccum.Reset();
+    DamageAccum.AddZeroed(NumSlots);
+    HealAccum.Reset();
+    HealAccum.AddZeroed(NumSlots);
+    TouchedBits.Init(false, NumSlots);
+    TouchedSlots.Reset();
+
+    for (int32 Index = HealthEffects.Num() - 1; Index >= 0; --Index)
+    {
+        FHealthEffect& Effect = HealthEffects[Index];
+        const int32 Slot = Registry.FindSlot(Effect.EntityID);
+        if (Slot == INDEX_NONE || !State.Alive[Slot])
+        {
+            HealthEffects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            continue;
+        }
+
+        // The last partial frame of a timed effect only applies the time it had left
+        const float ActiveTime = Effect.RemainingTime >= 0.0f ? FMath::Min(DeltaTime, Effect.RemainingTime) : DeltaTime;
+        const float Amount = Effect.DamagePerSecond * ActiveTime;
+        Accumulate(Slot, FMath::Max(Amount, 0.0f), FMath::Max(-Amount, 0.0f));
+
+        if (Effect.RemainingTime >= 0.0f)
+        {
+            Effect.RemainingTime -= DeltaTime;
+            if (Effect.RemainingTime <= 0.0f)
+            {
+                HealthEffects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            }
+        }
+    }
+
+    for (const FHealthEvent& Event : PendingEvents)
+    {
+        const int32 Slot = Registry.FindSlot(Event.EntityID);
+        if (Slot != INDEX_NONE)
+        {
+            Accumulate(Slot, Event.Damage, Event.Heal);
+        }
+    }
+    PendingEvents.Reset();
+
+    // Dead entities take nothing, invulnerable ones only healing
+    for (int32 Slot : TouchedSlots)
+    {
+        if (!State.Alive[Slot])
+        {
+            DamageAccum[Slot] = 0.0f;
+            HealAccum[Slot] = 0.0f;
+        }
+        else if (State.Invulnerable[Slot])
+        {
+            DamageAccum[Slot] = 0.0f;
+        }
+    }
+
+    // Health: Health = clamp(Health - Damage + Heal, 0, MaxHealth)
+    float* RESTRICT Health = State.Health.GetData();
+    const float* RESTRICT MaxHealth = State.MaxHealth.GetData();
+    const float* RESTRICT Damage = DamageAccum.GetData();
+    const float* RESTRICT Heal = HealAccum.GetData();
+
+    if (TouchedSlots.Num() >= NumSlots * DenseSweepThreshold)
+    {
+        // Untouched slots have zero accumulators, so sweeping them is harmless
+        const VectorRegister4Float Zero = VectorZeroFloat();
+        int32 Slot = 0;
+        for (; Slot + 4 <= NumSlots; Slot += 4)
+        {
+            VectorRegister4Float NewHealth = VectorAdd(VectorSubtract(VectorLoad(Health + Slot), VectorLoad(Damage + Slot)), VectorLoad(Heal + Slot));
+            NewHealth = VectorMin(VectorMax(NewHealth, Zero), VectorLoad(MaxHealth + Slot));
+            VectorStore(NewHealth, Health + Slot);
+        }
+        for (; Slot < NumSlots; ++Slot)
+        {
+            Health[Slot] = FMath::Clamp(Health[Slot] - Damage[Slot] + Heal[Slot], 0.0f, MaxHealth[Slot]);
+        }
+    }
+    else
+    {
+        for (int32 Slot : TouchedSlots)
+        {
+            Health[Slot] = FMath::Clamp(Health[Slot] - Damage[Slot] + Heal[Slot], 0.0f, MaxHealth[Slot]);
+        }
+    }
+
+    // Deaths can only happen where damage landed; write the state change now, notify afterwards
+    struct FDeath
+    {
+        UBaseEntity* Entity;
+        EEntityState OldState;
+    };
+    TArray<FDeath, TInlineAllocator<16>> Deaths;
+    const TArray<UBaseEntity*>& Entities = Registry.GetEntities();
+
+    for (int32 Slot : TouchedSlots)
+    {
+        if (State.Alive[Slot] && Damage[Slot] > 0.0f && Health[Slot] <= 0.0f)
+        {
+            const EEntityState OldState = State.States[Slot];
+            State.Alive[Slot] = false;
+            if (OldState != EEntityState::Dead)
+            {
+                State.PreviousStates[Slot] = OldState;
+                State.States[Slot] = EEntityState::Dead;
+                State.StateTimers[Slot] = 0.0f;
+            }
+            Deaths.Add({ Entities[Slot], OldState });
+        }
+    }
+
+    // Callbacks may register or unregister entities, so no slot indices past this point
+    for (const FDeath& Death : Deaths)
+    {
+        if (Death.OldState != EEntityState::Dead)
+        {
+            Death.Entity->OnEntityStateChanged(Death.OldState, EEntityState::Dead);
+        }
+        Death.Entity->OnEntityDeath();
+    }
+
+    LastDeathCount = Deaths.Num();
+    LastKernelTimeMs = (float)((FPlatformTime::Seconds() - KernelStartTime) * 1000.0);
+}
+
+void UEntityUpdateSubsystem::Accumulate(int32 Slot, float Damage, float Heal)
+{
+    if (!TouchedBits[Slot])
+    {
+        TouchedBits[Slot] = true;
+        TouchedSlots.Add(Slot);
+    }
+    DamageAccum[Slot] += Damage;
+    HealAccum[Slot] += Heal;
+}
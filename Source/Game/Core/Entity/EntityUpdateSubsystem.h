@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EntityUpdateSubsystem.generated.h"
+
+class UBaseEntity;
+class UEntityRegistrySubsystem;
+
+/**
+ * Entity Update Subsystem
+ * Per-frame batch kernel over the registry's SoA state columns. Each tick it:
+ *  - advances the state timer of every spawned, active entity in one linear sweep
+ *  - folds queued damage/heal events and running health effects (fire, poison, bleed, regen)
+ *    into per-slot damage and heal accumulators
+ *  - applies the net change to the health column with a 4-wide SIMD sweep (or a sparse pass when
+ *    only a few entities were hit)
+ *  - detects deaths, and only for those entities calls OnEntityStateChanged and OnEntityDeath
+ *
+ * Batched damage does not call OnEntityDamaged/OnEntityHealed per hit; use UBaseEntity::TakeDamage
+ * for discrete hits that need the per-hit callbacks. Game thread only.
+ */
+UCLASS()
+class GAME_API UEntityUpdateSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UEntityUpdateSubsystem();
+
+    // UTickableWorldSubsystem interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // === Health Events ===
+
+    /** Damage applied in the next kernel pass */
+    UFUNCTION(BlueprintCallable, Category = "Entity Update")
+    void QueueDamage(UBaseEntity* Entity, float DamageAmount);
+
+    /** Healing applied in the next kernel pass */
+    UFUNCTION(BlueprintCallable, Category = "Entity Update")
+    void QueueHeal(UBaseEntity* Entity, float HealAmount);
+
+    // === Health Effects ===
+
+    /**
+     * Continuous health change: positive DamagePerSecond damages, negative heals.
+     * Duration <= 0 runs until removed. Returns a handle for RemoveHealthEffect
+     */
+    UFUNCTION(BlueprintCallable, Category = "Entity Update")
+    int32 AddHealthEffect(UBaseEntity* Entity, float DamagePerSecond, float Duration);
+
+    UFUNCTION(BlueprintCallable, Category = "Entity Update")
+    void RemoveHealthEffect(int32 EffectHandle);
+
+    /** Remove every effect on an entity; returns the number removed */
+    int32 RemoveHealthEffects(UBaseEntity* Entity);
+
+    int32 GetNumHealthEffects() const { return HealthEffects.Num(); }
+
+    // === Stats ===
+
+    int32 GetLastDeathCount() const { return LastDeathCount; }
+
+    /** Wall time of the last kernel pass in milliseconds */
+    float GetLastKernelTimeMs() const { return LastKernelTimeMs; }
+
+    /** Above this fraction of hit entities the health pass sweeps every slot instead of just the hit ones */
+    UPROPERTY(EditAnywhere, Category = "Entity Update")
+    float DenseSweepThreshold;
+
+private:
+    struct FHealthEvent
+    {
+        int32 EntityID;
+        float Damage;
+        float Heal;
+    };
+
+    struct FHealthEffect
+    {
+        int32 Handle;
+        int32 EntityID;
+        float DamagePerSecond;
+        /** Seconds left; negative for effects without a duration */
+        float RemainingTime;
+    };
+
+    void RunKernel(UEntityRegistrySubsystem& Registry, float DeltaTime);
+
+    /** Add to a slot's accumulators and remember it was touched */
+    void Accumulate(int32 Slot, float Damage, float Heal);
+
+    TArray<FHealthEvent> PendingEvents;
+    TArray<FHealthEffect> HealthEffects;
+    int32 NextEffectHandle;
+
+    // Per-frame scratch, reused to avoid allocation
+    TArray<float> DamageAccum;
+    TArray<float> HealAccum;
+    TBitArray<> TouchedBits;
+    TArray<int32> TouchedSlots;
+
+    int32 LastDeathCount;
+    float LastKernelTimeMs;
+};
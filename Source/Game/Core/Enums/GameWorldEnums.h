@@ -419,6 +419,14 @@ enum class ETurnDirection : uint8
     Full360         UMETA(DisplayName = "Full 360")
 };
 
+UENUM(BlueprintType)
+enum class EPedAnimationUpdateTier : uint8
+{
+    Full            UMETA(DisplayName = "Full (every frame)"),
+    Reduced         UMETA(DisplayName = "Reduced (nearby, on screen)"),
+    Minimal         UMETA(DisplayName = "Minimal (distant or off screen)")
+};
+
 // ========== WORLD OBJECT ENUMERATIONS ==========
 
 UENUM(BlueprintType)
@@ -0,0 +1,228 @@
+#include "AIUpdateScheduler.h"
+#include "GameFramework/Actor.h"
+
+FAIUpdateScheduler::FAIUpdateScheduler()
+{
+    ClassifyCursor = 0;
+    LastTickTime = -1.0;
+    UpdatesLastFrame = 0;
+
+    for (int32 TierIndex = 0; TierIndex < NumAILODTiers; ++TierIndex)
+    {
+        Tiers[TierIndex].Stats.Tier = (ELODLevel)TierIndex;
+    }
+}
+
+void FAIUpdateScheduler::Add(AActor* Actor)
+{
+    if (Actor && !EntryIndices.Contains(Actor) && !PendingAdds.Contains(Actor))
+    {
+        PendingAdds.Add(Actor);
+    }
+}
+
+void FAIUpdateScheduler::Remove(AActor* Actor)
+{
+    if (PendingAdds.RemoveSingleSwap(Actor, EAllowShrinking::No) > 0)
+    {
+        return;
+    }
+
+    int32 EntryIndex = INDEX_NONE;
+    if (!EntryIndices.RemoveAndCopyValue(Actor, EntryIndex))
+    {
+        return;
+    }
+
+    RemoveFromTier(EntryIndex);
+
+    // Move the last entry into the hole and repoint its tier slot
+    const int32 LastIndex = Entries.Num() - 1;
+    if (EntryIndex != LastIndex)
+    {
+        Entries[EntryIndex] = Entries[LastIndex];
+        const FEntry& Moved = Entries[EntryIndex];
+        Tiers[Moved.Tier].Members[Moved.IndexInTier] = EntryIndex;
+        EntryIndices.Add(Moved.Actor, EntryIndex);
+    }
+    Entries.Pop(EAllowShrinking::No);
+}
+
+void FAIUpdateScheduler::Empty()
+{
+    Entries.Empty();
+    EntryIndices.Empty();
+    PendingAdds.Empty();
+    FrameUpdates.Empty();
+
+    for (FTier& Tier : Tiers)
+    {
+        const ELODLevel Level = Tier.Stats.Tier;
+        Tier = FTier();
+        Tier.Stats.Tier = Level;
+    }
+
+    ClassifyCursor = 0;
+    UpdatesLastFrame = 0;
+}
+
+ELODLevel FAIUpdateScheduler::GetTier(const AActor* Actor) const
+{
+    const int32* EntryIndex = EntryIndices.Find(Actor);
+    return EntryIndex ? (ELODLevel)Entries[*EntryIndex].Tier : ELODLevel::INVALID;
+}
+
+void FAIUpdateScheduler::Tick(double WorldTime, const FVector& ViewLocation, const FAIUpdateSchedulerSettings& Settings,
+                              TFunctionRef<void(AActor*, float)> UpdateActor)
+{
+    const float DeltaTime = LastTickTime >= 0.0 ? (float)(WorldTime - LastTickTime) : 0.0f;
+    LastTickTime = WorldTime;
+
+    // Place actors added since the last frame
+    for (AActor* Actor : PendingAdds)
+    {
+        const int32 EntryIndex = Entries.AddUninitialized();
+        FEntry& Entry = Entries[EntryIndex];
+        Entry.Actor = Actor;
+        Entry.LastUpdateTime = WorldTime;
+        Entry.Tier = Classify(Actor, ViewLocation, Settings);
+        Entry.IndexInTier = Tiers[Entry.Tier].Members.Add(EntryIndex);
+        EntryIndices.Add(Actor, EntryIndex);
+    }
+    PendingAdds.Reset();
+
+    // Re-evaluate a slice of tier assignments
+    const int32 NumToClassify = FMath::Min(Settings.ClassificationsPerFrame, Entries.Num());
+    for (int32 Count = 0; Count < NumToClassify; ++Count)
+    {
+        if (ClassifyCursor >= Entries.Num())
+        {
+            ClassifyCursor = 0;
+        }
+        SetTier(ClassifyCursor, Classify(Entries[ClassifyCursor].Actor, ViewLocation, Settings));
+        ++ClassifyCursor;
+    }
+
+    // Updates each tier is owed this frame; what the budget defers carries over
+    int32 Wanted[NumAILODTiers];
+    int32 NumTiersWanting = 0;
+    for (int32 TierIndex = 0; TierIndex < NumAILODTiers; ++TierIndex)
+    {
+        FTier& Tier = Tiers[TierIndex];
+        const int32 NumMembers = Tier.Members.Num();
+        const float Interval = Settings.GetTier((ELODLevel)TierIndex).UpdateInterval;
+
+        if (NumMembers == 0)
+        {
+            Tier.Owed = 0.0f;
+        }
+        else if (Interval <= 0.0f)
+        {
+            Tier.Owed = NumMembers;
+        }
+        else
+        {
+            Tier.Owed = FMath::Min(Tier.Owed + NumMembers * DeltaTime / Interval, (float)NumMembers);
+        }
+
+        Wanted[TierIndex] = FMath::FloorToInt32(Tier.Owed);
+        NumTiersWanting += Wanted[TierIndex] > 0 ? 1 : 0;
+    }
+
+    // Serve the nearest tier first, keeping one slot back for each tier still to come
+    int32 Budget = FMath::Max(Settings.MaxUpdatesPerFrame, 0);
+    FrameUpdates.Reset();
+
+    for (int32 TierIndex = 0; TierIndex < NumAILODTiers; ++TierIndex)
+    {
+        FTier& Tier = Tiers[TierIndex];
+        FAILODTierStats& Stats = Tier.Stats;
+        Stats.NumActors = Tier.Members.Num();
+        Stats.UpdatesLastFrame = 0;
+        Stats.MaxIntervalLastFrame = 0.0f;
+
+        if (Wanted[TierIndex] > 0)
+        {
+            --NumTiersWanting;
+            const int32 NumToUpdate = FMath::Clamp(Budget - NumTiersWanting, 1, Wanted[TierIndex]);
+            Budget = FMath::Max(Budget - NumToUpdate, 0);
+            Tier.Owed -= NumToUpdate;
+
+            for (int32 Count = 0; Count < NumToUpdate; ++Count)
+            {
+                if (Tier.Cursor >= Tier.Members.Num())
+                {
+                    Tier.Cursor = 0;
+                }
+
+                FEntry& Entry = Entries[Tier.Members[Tier.Cursor++]];
+                const float SinceLastUpdate = (float)(WorldTime - Entry.LastUpdateTime);
+                Entry.LastUpdateTime = WorldTime;
+                FrameUpdates.Emplace(Entry.Actor, SinceLastUpdate);
+
+                Stats.MaxIntervalLastFrame = FMath::Max(Stats.MaxIntervalLastFrame, SinceLastUpdate);
+                Stats.AverageInterval = Stats.AverageInterval > 0.0f ? FMath::Lerp(Stats.AverageInterval, SinceLastUpdate, 0.05f) : SinceLastUpdate;
+            }
+            Stats.UpdatesLastFrame = NumToUpdate;
+        }
+        Stats.Backlog = Tier.Owed;
+    }
+
+    UpdatesLastFrame = FrameUpdates.Num();
+
+    // Callbacks last: they may add or remove actors
+    for (const TPair<AActor*, float>& Update : FrameUpdates)
+    {
+        if (IsValid(Update.Key))
+        {
+            UpdateActor(Update.Key, Update.Value);
+        }
+    }
+}
+
+uint8 FAIUpdateScheduler::Classify(const AActor* Actor, const FVector& ViewLocation, const FAIUpdateSchedulerSettings& Settings) const
+{
+    const double DistanceSquared = FVector::DistSquared(Actor->GetActorLocation(), ViewLocation);
+
+    int32 TierIndex = NumAILODTiers - 1;
+    for (int32 Index = 0; Index < NumAILODTiers - 1; ++Index)
+    {
+        if (DistanceSquared <= FMath::Square((double)Settings.GetTier((ELODLevel)Index).MaxDistance))
+        {
+            TierIndex = Index;
+            break;
+        }
+    }
+
+    // Off-screen actors can afford one tier less
+    if (TierIndex < NumAILODTiers - 1 && !Actor->WasRecentlyRendered(Settings.VisibilityGraceTime))
+    {
+        ++TierIndex;
+    }
+    return (uint8)TierIndex;
+}
+
+void FAIUpdateScheduler::SetTier(int32 EntryIndex, uint8 NewTier)
+{
+    FEntry& Entry = Entries[EntryIndex];
+    if (Entry.Tier == NewTier)
+    {
+        return;
+    }
+
+    RemoveFromTier(EntryIndex);
+    Entry.Tier = NewTier;
+    Entry.IndexInTier = Tiers[NewTier].Members.Add(EntryIndex);
+}
+
+void FAIUpdateScheduler::RemoveFromTier(int32 EntryIndex)
+{
+    const FEntry& Entry = Entries[EntryIndex];
+    TArray<int32>& Members = Tiers[Entry.Tier].Members;
+
+    Members.RemoveAtSwap(Entry.IndexInTier, 1, EAllowShrinking::No);
+    if (Members.IsValidIndex(Entry.IndexInTier))
+    {
+        Entries[Members[Entry.IndexInTier]].IndexInTier = Entry.IndexInTier;
+    }
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/GameWorldEnums.h"
+#include "AIUpdateScheduler.generated.h"
+
+class AActor;
+
+static constexpr int32 NumAILODTiers = (int32)ELODLevel::INVALID;
+
+USTRUCT(BlueprintType)
+struct GAME_API FAILODTierSettings
+{
+    GENERATED_BODY()
+
+    /** Actors up to this distance (cm) from the viewer fall into the tier */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    float MaxDistance;
+
+    /** Target seconds between updates of one actor; 0 = every frame */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    float UpdateInterval;
+
+    FAILODTierSettings()
+    {
+        MaxDistance = 0.0f;
+        UpdateInterval = 0.0f;
+    }
+
+    FAILODTierSettings(float InMaxDistance, float InUpdateInterval)
+    {
+        MaxDistance = InMaxDistance;
+        UpdateInterval = InUpdateInterval;
+    }
+};
+
+USTRUCT(BlueprintType)
+struct GAME_API FAIUpdateSchedulerSettings
+{
+    GENERATED_BODY()
+
+    /** One entry per ELODLevel, read through GetTier(); distances must increase from HD to SLOD */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    FAILODTierSettings HDTier;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    FAILODTierSettings HighTier;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    FAILODTierSettings MediumTier;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    FAILODTierSettings LowTier;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    FAILODTierSettings SLODTier;
+
+    /**
+     * Soft cap on actor updates per frame. Tiers are served nearest first, but every tier with an
+     * actor due still gets one update a frame, so distant tiers can't starve
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    int32 MaxUpdatesPerFrame;
+
+    /** Actors whose tier is re-evaluated per frame, round robin */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    int32 ClassificationsPerFrame;
+
+    /** Actors not rendered within this many seconds drop one tier */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    float VisibilityGraceTime;
+
+    FAIUpdateSchedulerSettings()
+    {
+        HDTier = FAILODTierSettings(5000.0f, 0.0f);
+        HighTier = FAILODTierSettings(15000.0f, 0.1f);
+        MediumTier = FAILODTierSettings(40000.0f, 0.25f);
+        LowTier = FAILODTierSettings(80000.0f, 0.5f);
+        SLODTier = FAILODTierSettings(TNumericLimits<float>::Max(), 2.0f);
+        MaxUpdatesPerFrame = 64;
+        ClassificationsPerFrame = 128;
+        VisibilityGraceTime = 0.5f;
+    }
+
+    /** Settings of a tier; INVALID falls back to SLOD */
+    const FAILODTierSettings& GetTier(ELODLevel Tier) const
+    {
+        switch (Tier)
+        {
+            case ELODLevel::HD:
+                return HDTier;
+            case ELODLevel::HIGH:
+                return HighTier;
+            case ELODLevel::MEDIUM:
+                return MediumTier;
+            case ELODLevel::LOW:
+                return LowTier;
+            default:
+                return SLODTier;
+        }
+    }
+};
+
+USTRUCT(BlueprintType)
+struct GAME_API FAILODTierStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI LOD")
+    ELODLevel Tier;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI LOD")
+    int32 NumActors;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI LOD")
+    int32 UpdatesLastFrame;
+
+    /** Updates owed to the tier but deferred by the frame budget */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI LOD")
+    float Backlog;
+
+    /** Smoothed seconds between two updates of the same actor */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI LOD")
+    float AverageInterval;
+
+    /** Longest gap between two updates of one actor in the last frame */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI LOD")
+    float MaxIntervalLastFrame;
+
+    FAILODTierStats()
+    {
+        Tier = ELODLevel::INVALID;
+        NumActors = 0;
+        UpdatesLastFrame = 0;
+        Backlog = 0.0f;
+        AverageInterval = 0.0f;
+        MaxIntervalLastFrame = 0.0f;
+    }
+};
+
+/**
+ * AI Update Scheduler
+ * Time-slices AI behaviour updates over a large population. Actors are sorted into ELODLevel tiers by
+ * distance to the viewer (dropping one tier while off screen), each tier has a target update interval,
+ * and every frame each tier is owed Members * DeltaTime / Interval updates. Owed updates are served
+ * round robin within the tier, nearest tier first, up to the frame budget; anything the budget defers
+ * carries over to the next frame. Tier membership is itself re-evaluated a slice at a time.
+ *
+ * Holds raw actor pointers: owners must Remove actors when they end play. Game thread only.
+ */
+class GAME_API FAIUpdateScheduler
+{
+public:
+    FAIUpdateScheduler();
+
+    void Add(AActor* Actor);
+    void Remove(AActor* Actor);
+    void Empty();
+
+    int32 Num() const { return Entries.Num() + PendingAdds.Num(); }
+
+    /** Current tier of a scheduled actor, INVALID otherwise */
+    ELODLevel GetTier(const AActor* Actor) const;
+
+    /**
+     * Run one frame: reclassify a slice of actors, then call UpdateActor(Actor, SecondsSinceItsLastUpdate)
+     * for each actor picked. Callbacks run after selection, so they may add or remove actors
+     */
+    void Tick(double WorldTime, const FVector& ViewLocation, const FAIUpdateSchedulerSettings& Settings,
+              TFunctionRef<void(AActor*, float)> UpdateActor);
+
+    const FAILODTierStats& GetTierStats(ELODLevel Tier) const { return Tiers[(int32)Tier].Stats; }
+
+    int32 GetUpdatesLastFrame() const { return UpdatesLastFrame; }
+
+private:
+    struct FEntry
+    {
+        AActor* Actor;
+        double LastUpdateTime;
+        int32 IndexInTier;
+        uint8 Tier;
+    };
+
+    struct FTier
+    {
+        /** Entry indices */
+        TArray<int32> Members;
+        int32 Cursor = 0;
+        /** Fractional updates owed, carried between frames */
+        float Owed = 0.0f;
+        FAILODTierStats Stats;
+    };
+
+    uint8 Classify(const AActor* Actor, const FVector& ViewLocation, const FAIUpdateSchedulerSettings& Settings) const;
+    void SetTier(int32 EntryIndex, uint8 NewTier);
+    void RemoveFromTier(int32 EntryIndex);
+
+    TArray<FEntry> Entries;
+    TMap<const AActor*, int32> EntryIndices;
+
+    /** Added since the last tick; classified and placed in a tier at the start of the next one */
+    TArray<AActor*> PendingAdds;
+
+    FTier Tiers[NumAILODTiers];
+
+    int32 ClassifyCursor;
+    double LastTickTime;
+    int32 UpdatesLastFrame;
+
+    /** Actors picked this frame; kept to reuse its allocation */
+    TArray<TPair<AActor*, float>> FrameUpdates;
+};
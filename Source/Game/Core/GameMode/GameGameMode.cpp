@@ -5,9 +5,11 @@
 #include "../../Peds/Locomotion/PedInputComponent.h"
 #include "../../Tasks/TaskFactory.h"
 #include "../../Tasks/TaskManager.h"
+#include "../../Tasks/Graph/TaskGraph.h"
 #include "../../Core/Utils/GameLogger.h"
 #include "../../Animation/AnimationGroupsLoader.h"
 #include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
 #include "Engine/SkeletalMesh.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Materials/MaterialInterface.h"
@@ -41,8 +43,8 @@ AGameGameMode::AGameGameMode()
 
     // AI settings
     MaxAIPeds = 10;
-    AIUpdateInterval = 0.5f;
     AISpawnRadius = 2000.0f;
+    bValidateTrackedActors = false;
 
     // Asset path defaults
     CharacterBasePath = TEXT("/Game/Characters");
@@ -81,9 +83,6 @@ void AGameGameMode::BeginPlay()
     // Set initial game state
     SetGameState(EGameState::Starting);
 
-    // Start cleanup timer
-    GetWorldTimerManager().SetTimer(CleanupTimer, this, &AGameGameMode::CleanupInvalidActors, 5.0f, true);
-
     // Start the game setup
     FTimerHandle StartupTimer;
     GetWorldTimerManager().SetTimer(StartupTimer, [this]()
@@ -97,9 +96,8 @@ void AGameGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
     SetGameState(EGameState::Ending);
 
     // Clear all timers
-    GetWorldTimerManager().ClearTimer(AIUpdateTimer);
     GetWorldTimerManager().ClearTimer(GameStateTimer);
-    GetWorldTimerManager().ClearTimer(CleanupTimer);
+    AIScheduler.Empty();
 
     Super::EndPlay(EndPlayReason);
 }
@@ -111,6 +109,7 @@ void AGameGameMode::Tick(float DeltaTime)
     if (IsGameInProgress())
     {
         UpdateGameTime(DeltaTime);
+        UpdateAIBehaviors();
     }
 }
 
@@ -135,17 +134,8 @@ void AGameGameMode::SetGameState(EGameState NewState)
             break;
 
         case EGameState::InProgress:
+            // AI updates run from Tick while the game is in progress
             bGameHasStarted = true;
-            // Start AI update timer
-            GetWorldTimerManager().SetTimer(AIUpdateTimer, this, &AGameGameMode::UpdateAIBehaviors, AIUpdateInterval, true);
-            break;
-
-        case EGameState::Paused:
-            GetWorldTimerManager().PauseTimer(AIUpdateTimer);
-            break;
-
-        case EGameState::Ending:
-            GetWorldTimerManager().ClearTimer(AIUpdateTimer);
             break;
 
         default:
@@ -233,7 +223,7 @@ ACharacter* AGameGameMode::SpawnModularCharacter(const FVector& SpawnLocation, c
         }
         else
         {
-            AICharacters.Add(NewCharacter);
+            TrackAICharacter(NewCharacter);
         }
 
         // Broadcast character spawned event
@@ -470,20 +460,70 @@ void AGameGameMode::GivePlayerControl(ACharacter* Character)
 // ========== AI MANAGEMENT ==========
 void AGameGameMode::UpdateAIBehaviors()
 {
-    // Clean up invalid AI characters
-    AICharacters.RemoveAll([](ACharacter* Character) {
-        return !IsValid(Character);
+    // Tracked actors leave the scheduler when they end play, so everything it hands back is live
+    AIScheduler.Tick(GetWorld()->GetTimeSeconds(), GetAIViewLocation(), AIScheduling, [this](AActor* Actor, float DeltaTime)
+        {
+            UpdateAIBehavior(static_cast<ACharacter*>(Actor), DeltaTime);
         });
 
-    // Update AI behaviors here
-    for (ACharacter* AICharacter : AICharacters)
+#if !UE_BUILD_SHIPPING
+    if (bValidateTrackedActors)
     {
-        if (IsValid(AICharacter))
-        {
-            // Add AI behavior logic here
-            // This could involve task assignment, movement, etc.
-        }
+        ensureMsgf(ValidateTrackedActors(), TEXT("GameGameMode: Tracked actor arrays are inconsistent"));
+    }
+#endif
+}
+
+void AGameGameMode::UpdateAIBehavior(ACharacter* Character, float DeltaTime)
+{
+    // Add AI behavior logic here
+    // This could involve task assignment, movement, etc.
+}
+
+TArray<FAILODTierStats> AGameGameMode::GetAILODTierStats() const
+{
+    TArray<FAILODTierStats> Stats;
+    for (int32 Tier = 0; Tier < NumAILODTiers; ++Tier)
+    {
+        Stats.Add(AIScheduler.GetTierStats((ELODLevel)Tier));
+    }
+    return Stats;
+}
+
+FVector AGameGameMode::GetAIViewLocation() const
+{
+    if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
+    {
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        return ViewLocation;
+    }
+    return PlayerCharacter ? PlayerCharacter->GetActorLocation() : PlayerSpawnLocation;
+}
+
+void AGameGameMode::TrackAICharacter(ACharacter* Character)
+{
+    if (!IsValid(Character) || AICharacterIndices.Contains(Character))
+    {
+        return;
+    }
+
+    AICharacterIndices.Add(Character, AICharacters.Add(Character));
+    AIScheduler.Add(Character);
+    Character->OnEndPlay.AddUniqueDynamic(this, &AGameGameMode::HandleTrackedActorEndPlay);
+}
+
+void AGameGameMode::TrackAIPed(APed* Ped)
+{
+    if (!IsValid(Ped) || AIPedIndices.Contains(Ped))
+    {
+        return;
     }
+
+    AIPedIndices.Add(Ped, AIPeds.Add(Ped));
+    AIScheduler.Add(Ped);
+    Ped->OnEndPlay.AddUniqueDynamic(this, &AGameGameMode::HandleTrackedActorEndPlay);
 }
 
 void AGameGameMode::SpawnAIPed(const FVector& Location, const FString& PedName)
@@ -516,15 +556,90 @@ FVector AGameGameMode::GetRandomSpawnLocation() const
 
 void AGameGameMode::CleanupInvalidActors()
 {
-    // Clean up AI characters
-    AICharacters.RemoveAll([](ACharacter* Character) {
-        return !IsValid(Character);
-        });
+    // Walk backwards so swap-removal never skips an element
+    for (int32 Index = AICharacters.Num() - 1; Index >= 0; --Index)
+    {
+        if (!IsValid(AICharacters[Index]))
+        {
+            AIScheduler.Remove(AICharacters[Index]);
+            RemoveTrackedActor(AICharacters, AICharacterIndices, AICharacters[Index]);
+        }
+    }
 
-    // Clean up AI Peds
-    AIPeds.RemoveAll([](APed* Ped) {
-        return !IsValid(Ped);
-        });
+    for (int32 Index = AIPeds.Num() - 1; Index >= 0; --Index)
+    {
+        if (!IsValid(AIPeds[Index]))
+        {
+            AIScheduler.Remove(AIPeds[Index]);
+            RemoveTrackedActor(AIPeds, AIPedIndices, AIPeds[Index]);
+        }
+    }
+}
+
+bool AGameGameMode::ValidateTrackedActors() const
+{
+    bool bValid = true;
+
+    auto ValidateArray = [&bValid](const TCHAR* ArrayName, const auto& Actors, const TMap<AActor*, int32>& Indices)
+    {
+        if (Actors.Num() != Indices.Num())
+        {
+            UE_LOG(LogTemp, Error, TEXT("GameGameMode: %s has %d actors but %d indices"), ArrayName, Actors.Num(), Indices.Num());
+            bValid = false;
+        }
+
+        for (int32 Index = 0; Index < Actors.Num(); ++Index)
+        {
+            AActor* Actor = Actors[Index];
+            const int32* StoredIndex = Indices.Find(Actor);
+            if (!StoredIndex || *StoredIndex != Index)
+            {
+                UE_LOG(LogTemp, Error, TEXT("GameGameMode: %s[%d] has stored index %d"), ArrayName, Index, StoredIndex ? *StoredIndex : INDEX_NONE);
+                bValid = false;
+            }
+            if (!IsValid(Actor))
+            {
+                UE_LOG(LogTemp, Error, TEXT("GameGameMode: %s[%d] is no longer valid"), ArrayName, Index);
+                bValid = false;
+            }
+        }
+    };
+
+    ValidateArray(TEXT("AICharacters"), AICharacters, AICharacterIndices);
+    ValidateArray(TEXT("AIPeds"), AIPeds, AIPedIndices);
+    return bValid;
+}
+
+// ========== ACTOR TRACKING ==========
+void AGameGameMode::HandleTrackedActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    RemoveTrackedActor(AICharacters, AICharacterIndices, Actor);
+    RemoveTrackedActor(AIPeds, AIPedIndices, Actor);
+    AIScheduler.Remove(Actor);
+
+    if (PlayerCharacter == Actor)
+    {
+        PlayerCharacter = nullptr;
+    }
+}
+
+template<typename ActorType>
+bool AGameGameMode::RemoveTrackedActor(TArray<ActorType*>& Actors, TMap<AActor*, int32>& Indices, AActor* Actor)
+{
+    int32 Index = INDEX_NONE;
+    if (!Indices.RemoveAndCopyValue(Actor, Index))
+    {
+        return false;
+    }
+
+    // The last actor moves into the hole; repoint its stored index
+    const int32 LastIndex = Actors.Num() - 1;
+    if (Index != LastIndex)
+    {
+        Indices.Add(Actors[LastIndex], Index);
+    }
+    Actors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    return true;
 }
 
 // ========== INTERNAL HELPERS ==========
@@ -547,6 +662,12 @@ void AGameGameMode::InitializeFactories()
         }
     }
 
+    // Compile data-driven task graphs before any task can request one
+    if (!UTaskGraphLibrary::LoadTaskGraphsFromXML())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No task graphs compiled - graph tasks will be unavailable"));
+    }
+
     // Create factories
     PedFactory = NewObject<UPedFactory>(this);
     TaskFactory = NewObject<UTaskFactory>(this);
@@ -5,6 +5,7 @@
 #include "Engine/TimerHandle.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "AIUpdateScheduler.h"
 #include "GameGameMode.generated.h"
 
 // Forward declarations
@@ -145,19 +146,35 @@ public:
     void GivePlayerControl(ACharacter* Character);
 
     // ========== AI MANAGEMENT ==========
+    /** Run one frame of the AI scheduler: updates the AI actors that are due, within the frame budget */
     UFUNCTION(BlueprintCallable, Category = "AI")
     void UpdateAIBehaviors();
 
+    /** Per-tier counts, update rates and backlog of the AI scheduler, indexed by ELODLevel */
+    UFUNCTION(BlueprintCallable, Category = "AI")
+    TArray<FAILODTierStats> GetAILODTierStats() const;
+
     UFUNCTION(BlueprintCallable, Category = "AI")
     void SpawnAIPed(const FVector& Location, const FString& PedName);
 
+    /** Add an AI character to AICharacters; it is removed again when it ends play */
+    void TrackAICharacter(ACharacter* Character);
+
+    /** Add an AI ped to AIPeds; it is removed again when it ends play */
+    void TrackAIPed(APed* Ped);
+
     // ========== UTILITY FUNCTIONS ==========
     UFUNCTION(BlueprintCallable, Category = "Utility")
     FVector GetRandomSpawnLocation() const;
 
+    /** Full sweep for actors that went away without ending play; tracked actors normally remove themselves */
     UFUNCTION(BlueprintCallable, Category = "Utility")
     void CleanupInvalidActors();
 
+    /** Check that the tracked actor arrays and their back-indices agree; logs and returns false on mismatch */
+    UFUNCTION(BlueprintCallable, Category = "Utility")
+    bool ValidateTrackedActors() const;
+
 protected:
     // ========== INITIALIZATION ==========
     void InitializeFactories();
@@ -169,6 +186,20 @@ protected:
     bool ValidateAssetPath(const FString& AssetPath) const;
     void LogCharacterSpawnInfo(ACharacter* Character, const FCharacterVariantConfig& Config) const;
 
+    /** Behaviour update of one AI actor; DeltaTime is the time since that actor's last update */
+    void UpdateAIBehavior(ACharacter* Character, float DeltaTime);
+
+    /** Where AI distance tiers are measured from: the local player's view, else the player spawn */
+    FVector GetAIViewLocation() const;
+
+    // ========== ACTOR TRACKING ==========
+    UFUNCTION()
+    void HandleTrackedActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+    /** Swap-remove Actor from Actors using its stored index; false if it wasn't tracked there */
+    template<typename ActorType>
+    static bool RemoveTrackedActor(TArray<ActorType*>& Actors, TMap<AActor*, int32>& Indices, AActor* Actor);
+
 protected:
     // ========== GAME STATE ==========
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game State")
@@ -214,12 +245,17 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Settings")
     int32 MaxAIPeds;
 
+    /** Distance tiers, update intervals and per-frame budget for AI behaviour updates */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Settings")
-    float AIUpdateInterval;
+    FAIUpdateSchedulerSettings AIScheduling;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Settings")
     float AISpawnRadius;
 
+    /** Run ValidateTrackedActors after every AI update (non-shipping builds) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Settings")
+    bool bValidateTrackedActors;
+
     // ========== ASSET PATHS ==========
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Asset Paths")
     FString CharacterBasePath;
@@ -240,8 +276,14 @@ protected:
     UPROPERTY()
     UAnimationGroupsLoader* AnimationLoader;
 
+    // ========== ACTOR TRACKING ==========
+    /** Index of each tracked actor in AICharacters / AIPeds */
+    TMap<AActor*, int32> AICharacterIndices;
+    TMap<AActor*, int32> AIPedIndices;
+
+    /** Time-slices UpdateAIBehavior over every tracked AI actor */
+    FAIUpdateScheduler AIScheduler;
+
     // ========== TIMERS ==========
-    FTimerHandle AIUpdateTimer;
     FTimerHandle GameStateTimer;
-    FTimerHandle CleanupTimer;
 };
@@ -0,0 +1,55 @@
+#include "Core/Utils/MappedFileView.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+
+FMappedFileView::FMappedFileView()
+{
+    Data = nullptr;
+    Size = 0;
+}
+
+FMappedFileView::~FMappedFileView()
+{
+    Close();
+}
+
+bool FMappedFileView::Open(const FString& FilePath)
+{
+    Close();
+
+    // Map the file; platforms without mapping support (and empty files, which can't be mapped) are read instead
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+    if (MappedResult.HasValue() && MappedResult.GetValue()->GetFileSize() > 0)
+    {
+        MappedFile = MappedResult.StealValue();
+        MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+    }
+
+    if (MappedRegion)
+    {
+        Data = MappedRegion->GetMappedPtr();
+        Size = MappedRegion->GetMappedSize();
+        return true;
+    }
+
+    MappedFile.Reset();
+    if (!FFileHelper::LoadFileToArray(FallbackData, *FilePath, FILEREAD_Silent))
+    {
+        return false;
+    }
+    Data = FallbackData.GetData();
+    Size = FallbackData.Num();
+    return true;
+}
+
+void FMappedFileView::Close()
+{
+    // The region must go before the handle it was mapped from
+    MappedRegion.Reset();
+    MappedFile.Reset();
+    FallbackData.Empty();
+    Data = nullptr;
+    Size = 0;
+}
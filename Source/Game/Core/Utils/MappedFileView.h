@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Mapped File View
+ * Read-only bytes of a whole file: memory-mapped where the platform supports it, read into memory in
+ * one go otherwise. Shared by the binary format readers and the text source parsers. The data stays
+ * valid until Close() or destruction.
+ */
+class GAME_API FMappedFileView
+{
+public:
+    FMappedFileView();
+    ~FMappedFileView();
+
+    /** Map or read the file; false if it can't be opened */
+    bool Open(const FString& FilePath);
+    void Close();
+
+    /** False for an empty file even after a successful Open, as there is nothing to point at */
+    bool IsOpen() const { return Data != nullptr; }
+    bool IsMemoryMapped() const { return MappedRegion != nullptr; }
+
+    const uint8* GetData() const { return Data; }
+    int64 GetSize() const { return Size; }
+
+private:
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TArray64<uint8> FallbackData;
+
+    const uint8* Data;
+    int64 Size;
+};
@@ -0,0 +1,127 @@
+#include "Core/Utils/SectionedFile.h"
+#include "HAL/FileManager.h"
+
+// === FSectionedFileWriter ===
+
+FSectionedFileWriter::FSectionedFileWriter(int64 InHeaderSize, int64 InAlignment)
+{
+    HeaderSize = InHeaderSize;
+    Alignment = InAlignment;
+}
+
+void FSectionedFileWriter::BeginSection(uint32 Id)
+{
+    Sections.AddDefaulted();
+    FSectionedFileSection& Entry = SectionTable.AddZeroed_GetRef();
+    Entry.Id = Id;
+}
+
+void FSectionedFileWriter::AddChunk(const void* Ptr, int64 NumBytes)
+{
+    check(Sections.Num() > 0);
+    FPendingSection& Section = Sections.Last();
+    Section.Chunks.Emplace(Ptr, NumBytes);
+    Section.Size += NumBytes;
+}
+
+int64 FSectionedFileWriter::Layout()
+{
+    int64 Offset = HeaderSize + (int64)SectionTable.Num() * sizeof(FSectionedFileSection);
+    for (int32 Index = 0; Index < Sections.Num(); ++Index)
+    {
+        Offset = Align(Offset, Alignment);
+        SectionTable[Index].Offset = (uint64)Offset;
+        SectionTable[Index].Size = (uint64)Sections[Index].Size;
+        Offset += Sections[Index].Size;
+    }
+    return Offset;
+}
+
+bool FSectionedFileWriter::Write(const FString& FilePath, const void* Header, const TCHAR* LogName) const
+{
+    // Write to a temporary file and swap it in, so a failed write never clobbers the last good file
+    // and a reader never maps a half-written one
+    const FString TempPath = FilePath + TEXT(".tmp");
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
+    if (!Writer)
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s: Could not open '%s' for writing"), LogName, *TempPath);
+        return false;
+    }
+
+    static const uint8 Padding[64] = {};
+    check(Alignment <= (int64)sizeof(Padding));
+
+    Writer->Serialize(const_cast<void*>(Header), HeaderSize);
+    Writer->Serialize(const_cast<FSectionedFileSection*>(SectionTable.GetData()), (int64)SectionTable.Num() * sizeof(FSectionedFileSection));
+    for (int32 Index = 0; Index < Sections.Num(); ++Index)
+    {
+        Writer->Serialize(const_cast<uint8*>(Padding), (int64)SectionTable[Index].Offset - Writer->Tell());
+        for (const TPair<const void*, int64>& Chunk : Sections[Index].Chunks)
+        {
+            Writer->Serialize(const_cast<void*>(Chunk.Key), Chunk.Value);
+        }
+    }
+
+    const bool bWriteFailed = Writer->IsError() || !Writer->Close();
+    Writer.Reset();
+    if (bWriteFailed || !IFileManager::Get().Move(*FilePath, *TempPath, true, true))
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s: Failed to write '%s'"), LogName, *FilePath);
+        IFileManager::Get().Delete(*TempPath);
+        return false;
+    }
+    return true;
+}
+
+// === FSectionedFileReader ===
+
+bool FSectionedFileReader::Open(const FString& FilePath)
+{
+    Close();
+    return View.Open(FilePath);
+}
+
+void FSectionedFileReader::Close()
+{
+    View.Close();
+    Sections.Reset();
+}
+
+bool FSectionedFileReader::ReadSectionTable(int64 HeaderSize, int32 NumSections, uint32 NumKnownIds, int64 Alignment)
+{
+    Sections.Reset();
+    Sections.SetNumZeroed(NumKnownIds);
+
+    const uint8* Data = View.GetData();
+    const int64 DataSize = View.GetSize();
+    const int64 TableEnd = HeaderSize + (int64)NumSections * sizeof(FSectionedFileSection);
+    if (!Data || NumSections < 0 || TableEnd > DataSize)
+    {
+        return false;
+    }
+
+    const FSectionedFileSection* Table = (const FSectionedFileSection*)(Data + HeaderSize);
+    for (int32 Index = 0; Index < NumSections; ++Index)
+    {
+        const FSectionedFileSection& Entry = Table[Index];
+        if (Entry.Offset % Alignment != 0 || Entry.Offset < (uint64)TableEnd ||
+            Entry.Offset > (uint64)DataSize || Entry.Size > (uint64)DataSize - Entry.Offset)
+        {
+            return false;
+        }
+        if (Entry.Id < NumKnownIds)
+        {
+            Sections[Entry.Id] = &Entry;
+        }
+    }
+
+    for (const FSectionedFileSection* Entry : Sections)
+    {
+        if (!Entry)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Utils/MappedFileView.h"
+
+/** Section table entry shared by the sectioned binary formats (entity snapshots, compiled Onim dictionaries) */
+struct FSectionedFileSection
+{
+    uint32 Id;
+    uint32 Reserved;
+    uint64 Offset;
+    uint64 Size;
+};
+
+static_assert(sizeof(FSectionedFileSection) == 24, "Section table layout changed; bump the version of every sectioned format");
+
+/**
+ * Sectioned File Writer
+ * Writes a file laid out as
+ *
+ *   format header (HeaderSize bytes)
+ *   FSectionedFileSection[NumSections]
+ *   sections, each starting on an Alignment boundary
+ *
+ * Sections are gathered as pointers to the caller's data and nothing is copied. Layout() fixes every
+ * offset up front so the caller can fill in its header, then Write() streams the file out in one pass
+ * to a temporary file that replaces FilePath only once it is complete.
+ */
+class GAME_API FSectionedFileWriter
+{
+public:
+    FSectionedFileWriter(int64 InHeaderSize, int64 InAlignment);
+
+    /** Start a section; chunks added until the next BeginSection are written back to back */
+    void BeginSection(uint32 Id);
+    void AddChunk(const void* Ptr, int64 NumBytes);
+
+    template<typename T>
+    void AddArray(uint32 Id, const TArray<T>& Array)
+    {
+        BeginSection(Id);
+        AddChunk(Array.GetData(), (int64)Array.Num() * (int64)sizeof(T));
+    }
+
+    int32 NumSections() const { return Sections.Num(); }
+
+    /** Assign every section its offset; returns the total file size */
+    int64 Layout();
+
+    /** Write Header (HeaderSize bytes), the section table and the sections. Layout() must have run */
+    bool Write(const FString& FilePath, const void* Header, const TCHAR* LogName) const;
+
+private:
+    struct FPendingSection
+    {
+        TArray<TPair<const void*, int64>, TInlineAllocator<2>> Chunks;
+        int64 Size = 0;
+    };
+
+    int64 HeaderSize;
+    int64 Alignment;
+    TArray<FPendingSection> Sections;
+    TArray<FSectionedFileSection> SectionTable;
+};
+
+/**
+ * Sectioned File Reader
+ * Opens a sectioned file through FMappedFileView (mapped where the platform allows) and checks its
+ * section table, then hands out bounds- and alignment-checked views straight into the data. The
+ * format's own header and cross-references are left to the caller. Views stay valid until Close().
+ */
+class GAME_API FSectionedFileReader
+{
+public:
+    /** Map or read the file; false if it can't be opened */
+    bool Open(const FString& FilePath);
+    void Close();
+
+    bool IsOpen() const { return View.IsOpen(); }
+    bool IsMemoryMapped() const { return View.IsMemoryMapped(); }
+
+    const uint8* GetData() const { return View.GetData(); }
+    int64 GetSize() const { return View.GetSize(); }
+
+    /** The format header at the start of the file, nullptr if the file is too small to hold one */
+    template<typename T>
+    const T* GetHeader() const
+    {
+        return View.GetSize() >= (int64)sizeof(T) ? (const T*)View.GetData() : nullptr;
+    }
+
+    /**
+     * Check the NumSections-entry table after a HeaderSize-byte header: every section aligned and inside
+     * the file. Ids below NumKnownIds are indexed and must all be present; unknown ids are skipped so
+     * newer writers can append sections
+     */
+    bool ReadSectionTable(int64 HeaderSize, int32 NumSections, uint32 NumKnownIds, int64 Alignment);
+
+    const FSectionedFileSection* FindSection(uint32 Id) const { return Id < (uint32)Sections.Num() ? Sections[Id] : nullptr; }
+
+    /** View of Count elements of T after a HeaderBytes prefix; the section may hold more */
+    template<typename T>
+    bool GetSectionView(uint32 Id, int64 Count, TArrayView<const T>& OutView, int64 HeaderBytes = 0) const
+    {
+        const FSectionedFileSection* Entry = FindSection(Id);
+        if (!Entry || Count < 0 || Count > MAX_int32 || (int64)Entry->Size < HeaderBytes + Count * (int64)sizeof(T))
+        {
+            return false;
+        }
+
+        const uint8* Ptr = View.GetData() + Entry->Offset + HeaderBytes;
+        if (!IsAligned(Ptr, alignof(T)))
+        {
+            return false;
+        }
+
+        OutView = MakeArrayView((const T*)Ptr, (int32)Count);
+        return true;
+    }
+
+    /** View of the whole section; fails unless its size is a whole number of T */
+    template<typename T>
+    bool GetSectionView(uint32 Id, TArrayView<const T>& OutView) const
+    {
+        const FSectionedFileSection* Entry = FindSection(Id);
+        if (!Entry || Entry->Size % sizeof(T) != 0)
+        {
+            return false;
+        }
+        return GetSectionView(Id, (int64)(Entry->Size / sizeof(T)), OutView);
+    }
+
+private:
+    FMappedFileView View;
+
+    TArray<const FSectionedFileSection*, TInlineAllocator<16>> Sections;
+};
@@ -12,6 +12,9 @@ public class Game : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new string[] { "EnhancedInput", "Slate", "SlateCore", "TinyXML2" });
 
+		// Header-only scripting interop interfaces (TaskSystemInterop.h, EntityQueryInterop.h); no link dependency on the plugin
+		PrivateIncludePathModuleNames.Add("DotNetScripting");
+
 				PublicIncludePaths.AddRange(new string[] {
             ModuleDirectory ,
 			System.IO.Path.Combine(ModuleDirectory, "Animation"),
@@ -2,6 +2,11 @@
 
 #include "Game.h"
 #include "Modules/ModuleManager.h"
+#include "Features/IModularFeatures.h"
+#include "Tasks/Interop/GameTaskSystemInterop.h"
+#include "Tasks/Interop/GameEntityQueryInterop.h"
+#include "Core/Entity/EntityIDManager.h"
+#include "Misc/CoreDelegates.h"
 // #include "Test/PedTestConsoleCommands.h" // Removed - file doesn't exist
 
 class FGameModule : public FDefaultGameModuleImpl
@@ -14,6 +19,13 @@ public:
         // Register console commands
         // FPedTestConsoleCommands::RegisterCommands(); // Removed - class doesn't exist
         
+        // Expose the task system and entity queries to the scripting plugin
+        IModularFeatures::Get().RegisterModularFeature(ITaskSystemInterop::GetModularFeatureName(), &TaskSystemInterop);
+        IModularFeatures::Get().RegisterModularFeature(IEntityQueryInterop::GetModularFeatureName(), &EntityQueryInterop);
+        
+        // Entity IDs released during a frame become reusable once it ends
+        EntityIDReclaimHandle = FCoreDelegates::OnEndFrame.AddRaw(&FEntityIDAllocator::Get(), &FEntityIDAllocator::ReclaimReleasedIDs);
+        
         UE_LOG(LogTemp, Log, TEXT("Game Module: Started"));
     }
 
@@ -22,10 +34,19 @@ public:
         // Unregister console commands
         // FPedTestConsoleCommands::UnregisterCommands(); // Removed - class doesn't exist
         
+        IModularFeatures::Get().UnregisterModularFeature(ITaskSystemInterop::GetModularFeatureName(), &TaskSystemInterop);
+        IModularFeatures::Get().UnregisterModularFeature(IEntityQueryInterop::GetModularFeatureName(), &EntityQueryInterop);
+        FCoreDelegates::OnEndFrame.Remove(EntityIDReclaimHandle);
+        
         FDefaultGameModuleImpl::ShutdownModule();
         
         UE_LOG(LogTemp, Log, TEXT("Game Module: Shutdown"));
     }
+
+private:
+    FGameTaskSystemInterop TaskSystemInterop;
+    FGameEntityQueryInterop EntityQueryInterop;
+    FDelegateHandle EntityIDReclaimHandle;
 };
 
 IMPLEMENT_PRIMARY_GAME_MODULE(FGameModule, Game, "Game");
\ No newline at end of file
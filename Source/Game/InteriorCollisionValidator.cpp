@@ -2,12 +2,13 @@
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 #include "GameFramework/Character.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
-#include "Kismet/GameplayStatics.h"
 #include "Components/CapsuleComponent.h"
+#include "Core/Entity/EntitySpatialSubsystem.h"
 
 AInteriorCollisionValidator::AInteriorCollisionValidator()
 {
@@ -31,6 +32,7 @@ AInteriorCollisionValidator::AInteriorCollisionValidator()
     bEnforceDoorEntry = true;
     bLogViolations = true;
     MaxViolationsBeforeKick = 3;
+    PawnTrackingRadius = 5000.0f;
     
     // Mission/Admin settings
     bAllowMissionTeleports = true;
@@ -64,9 +66,33 @@ void AInteriorCollisionValidator::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
     
-    // Update player positions for teleport detection
+    // Update player positions for teleport detection. Player pawns are always tracked, wherever they are
+    // and whether or not they are registered entities; the spatial index only narrows the NPC checks
+    // to entities near the interior
     TArray<AActor*> FoundPawns;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), FoundPawns);
+    if (UEntitySpatialSubsystem* SpatialIndex = UEntitySpatialSubsystem::Get(this))
+    {
+        SpatialIndex->FindActorsInRadius(GetActorLocation(), PawnTrackingRadius, FoundPawns);
+    }
+
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr)
+        {
+            FoundPawns.AddUnique(PlayerPawn);
+        }
+    }
+
+    // Pawns not seen this tick lose their history, so a pawn re-entering range isn't measured against a stale position
+    for (TMap<APawn*, FVector>::TIterator It = PlayerPreviousPositions.CreateIterator(); It; ++It)
+    {
+        if (!FoundPawns.Contains(It.Key()))
+        {
+            PlayerLastValidationTime.Remove(It.Key());
+            It.RemoveCurrent();
+        }
+    }
     
     for (AActor* Actor : FoundPawns)
     {
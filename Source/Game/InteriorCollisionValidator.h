@@ -118,6 +118,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation")
     int32 MaxViolationsBeforeKick;
 
+    /** NPC pawns within this distance of the interior are tracked for teleport detection; player pawns always are */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation")
+    float PawnTrackingRadius;
+
     // ========== MISSION/ADMIN SETTINGS ==========
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mission")
     bool bAllowMissionTeleports;
@@ -1,5 +1,6 @@
 #include "BaseTask.h"
 #include "../Peds/Ped.h"
+#include "TaskHandleRegistry.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 
@@ -22,6 +23,16 @@ UBaseTask::UBaseTask()
     
     bIsInitialized = false;
     bHasTimeout = true;
+    RegistryHandle = 0;
+}
+
+UWorld* UBaseTask::GetWorld() const
+{
+    if (HasAnyFlags(RF_ClassDefaultObject))
+    {
+        return nullptr;
+    }
+    return OwnerPed ? OwnerPed->GetWorld() : Super::GetWorld();
 }
 
 bool UBaseTask::StartTask()
@@ -32,6 +43,13 @@ bool UBaseTask::StartTask()
         return false;
     }
 
+    // Traces, timers and world subsystems all go through GetWorld(); an unassigned task has none
+    if (!GetWorld())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Task %s: Cannot start task - no world (task has no owner ped)"), *TaskName);
+        return false;
+    }
+
     if (!CanStartTask())
     {
         UE_LOG(LogTemp, Warning, TEXT("Task %s: Cannot start task - conditions not met"), *TaskName);
@@ -176,6 +194,11 @@ void UBaseTask::SetTaskState(ETaskState NewState)
     ETaskState OldState = CurrentState;
     CurrentState = NewState;
 
+    if (RegistryHandle != 0)
+    {
+        FTaskHandleRegistry::Get().MirrorState(RegistryHandle, NewState);
+    }
+
     UE_LOG(LogTemp, VeryVerbose, TEXT("Task %s: State changed from %d to %d"), *TaskName, (int32)OldState, (int32)NewState);
 
     // Broadcast state change
@@ -78,6 +78,9 @@ class GAME_API UBaseTask : public UObject
 public:
     UBaseTask();
 
+    /** The owning ped's world; tasks may be outered to the transient package (e.g. created by scripts before assignment) */
+    virtual UWorld* GetWorld() const override;
+
     // Core task functions
     UFUNCTION(BlueprintCallable, Category = "Task")
     virtual bool StartTask();
@@ -216,6 +219,12 @@ protected:
     bool bIsInitialized;
     bool bHasTimeout;
 
+private:
+    friend class FTaskHandleRegistry;
+
+    /** Scripting handle (see FTaskHandleRegistry), 0 while the task has never been handed out */
+    int32 RegistryHandle;
+
 public:
     // Task factory function
     UFUNCTION(BlueprintCallable, Category = "Task Factory", meta = (DeterminesOutputType = "TaskClass"))
@@ -0,0 +1,393 @@
+#include "TaskGraph.h"
+#include "../Peds/Complex/ComplexTask.h"
+#include "../TaskTypeRegistry.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "tinyxml2.h"
+
+// Initialize static variables
+TMap<FName, TSharedPtr<const FCompiledTaskGraph>> UTaskGraphLibrary::CompiledGraphs;
+bool UTaskGraphLibrary::bDefaultGraphsLoaded = false;
+
+namespace TaskGraphCompiler
+{
+    FString GetAttr(const tinyxml2::XMLElement* Element, const char* Name)
+    {
+        const char* Value = Element->Attribute(Name);
+        return Value ? FString(UTF8_TO_TCHAR(Value)) : FString();
+    }
+
+    FVector ParseOffset(const tinyxml2::XMLElement* Element)
+    {
+        FVector Offset = FVector::ZeroVector;
+        const FString OffsetString = GetAttr(Element, "Offset");
+        TArray<FString> Parts;
+        OffsetString.ParseIntoArrayWS(Parts);
+        for (int32 i = 0; i < Parts.Num() && i < 3; ++i)
+        {
+            Offset[i] = FCString::Atof(*Parts[i]);
+        }
+        return Offset;
+    }
+
+    bool ParseStage(const FString& StageString, EComplexTaskPhase& OutPhase)
+    {
+        if (StageString.IsEmpty() || StageString == TEXT("Execution"))
+        {
+            OutPhase = EComplexTaskPhase::Execution;
+        }
+        else if (StageString == TEXT("Preparation"))
+        {
+            OutPhase = EComplexTaskPhase::Preparation;
+        }
+        else if (StageString == TEXT("Completion"))
+        {
+            OutPhase = EComplexTaskPhase::Completion;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    /** Per-graph compile state: symbol tables plus jump fix-ups resolved after the last phase */
+    struct FCompileContext
+    {
+        FCompiledTaskGraph& Graph;
+        TMap<FName, int32> Labels;
+        TArray<TPair<int32, FName>> PendingJumps;
+        bool bHasError = false;
+
+        explicit FCompileContext(FCompiledTaskGraph& InGraph) : Graph(InGraph) {}
+
+        void Error(const FString& Message)
+        {
+            UE_LOG(LogTemp, Error, TEXT("TaskGraphLibrary: Graph '%s': %s"), *Graph.GraphName.ToString(), *Message);
+            bHasError = true;
+        }
+
+        int32 FindPoint(const FString& PointName)
+        {
+            const int32 Slot = Graph.PointNames.IndexOfByKey(FName(*PointName));
+            if (Slot == INDEX_NONE)
+            {
+                Error(FString::Printf(TEXT("Unknown point '%s'"), *PointName));
+            }
+            return Slot;
+        }
+
+        int32 FindOrAddPoint(const FString& PointName)
+        {
+            if (PointName.IsEmpty())
+            {
+                Error(TEXT("Point without a Name"));
+                return INDEX_NONE;
+            }
+
+            const FName Name(*PointName);
+            int32 Slot = Graph.PointNames.IndexOfByKey(Name);
+            if (Slot != INDEX_NONE)
+            {
+                return Slot;
+            }
+            if (Graph.PointNames.Num() >= FCompiledTaskGraph::MaxPoints)
+            {
+                Error(FString::Printf(TEXT("Too many points (max %d)"), FCompiledTaskGraph::MaxPoints));
+                return INDEX_NONE;
+            }
+            return Graph.PointNames.Add(Name);
+        }
+
+        int32 AddString(const FString& Value)
+        {
+            const int32 Existing = Graph.Strings.IndexOfByKey(Value);
+            return Existing != INDEX_NONE ? Existing : Graph.Strings.Add(Value);
+        }
+
+        FTaskGraphInstruction& Emit(ETaskGraphOp Op)
+        {
+            FTaskGraphInstruction& Instruction = Graph.Instructions.AddDefaulted_GetRef();
+            Instruction.Op = Op;
+            return Instruction;
+        }
+
+        void EmitJump(ETaskGraphOp Op, const FString& LabelName, uint8 Slot = 0, float Radius = 0.0f)
+        {
+            if (LabelName.IsEmpty())
+            {
+                Error(TEXT("Jump without a target label"));
+                return;
+            }
+            FTaskGraphInstruction& Instruction = Emit(Op);
+            Instruction.A = Slot;
+            Instruction.F[0] = Radius;
+            PendingJumps.Add(TPair<int32, FName>(Graph.Instructions.Num() - 1, FName(*LabelName)));
+        }
+
+        void CompileInstruction(const tinyxml2::XMLElement* Element)
+        {
+            const FString Type = UTF8_TO_TCHAR(Element->Name());
+
+            if (Type == TEXT("Point"))
+            {
+                const FString From = GetAttr(Element, "From");
+                const FVector Offset = ParseOffset(Element);
+
+                FTaskGraphInstruction Instruction;
+                Instruction.Op = ETaskGraphOp::SetPoint;
+                if (From.IsEmpty() || From == TEXT("Self"))
+                {
+                    Instruction.B = (uint8)ETaskGraphAnchor::Self;
+                }
+                else if (From == TEXT("Target"))
+                {
+                    Instruction.B = (uint8)ETaskGraphAnchor::Target;
+                }
+                else
+                {
+                    const int32 SourceSlot = FindPoint(From);
+                    Instruction.B = (uint8)ETaskGraphAnchor::Point;
+                    Instruction.C = (uint8)FMath::Max(SourceSlot, 0);
+                }
+
+                const int32 Slot = FindOrAddPoint(GetAttr(Element, "Name"));
+                Instruction.A = (uint8)FMath::Max(Slot, 0);
+                Instruction.F[0] = Offset.X;
+                Instruction.F[1] = Offset.Y;
+                Instruction.F[2] = Offset.Z;
+                Graph.Instructions.Add(Instruction);
+            }
+            else if (Type == TEXT("TraceGround"))
+            {
+                FTaskGraphInstruction& Instruction = Emit(ETaskGraphOp::TraceGround);
+                Instruction.A = (uint8)FMath::Max(FindPoint(GetAttr(Element, "Point")), 0);
+                Instruction.F[0] = Element->FloatAttribute("Up", 300.0f);
+                Instruction.F[1] = Element->FloatAttribute("Down", 50.0f);
+                Instruction.F[2] = Element->FloatAttribute("Lift", 0.0f);
+            }
+            else if (Type == TEXT("MoveTo"))
+            {
+                FTaskGraphInstruction& Instruction = Emit(ETaskGraphOp::MoveTo);
+                Instruction.A = (uint8)FMath::Max(FindPoint(GetAttr(Element, "Point")), 0);
+                Instruction.F[0] = Element->FloatAttribute("Speed", 100.0f);
+                Instruction.F[1] = Element->FloatAttribute("Radius", 10.0f);
+            }
+            else if (Type == TEXT("SnapTo"))
+            {
+                FTaskGraphInstruction& Instruction = Emit(ETaskGraphOp::SnapTo);
+                Instruction.A = (uint8)FMath::Max(FindPoint(GetAttr(Element, "Point")), 0);
+            }
+            else if (Type == TEXT("Wait"))
+            {
+                FTaskGraphInstruction& Instruction = Emit(ETaskGraphOp::Wait);
+                Instruction.F[0] = Element->FloatAttribute("Duration", 1.0f);
+            }
+            else if (Type == TEXT("Label"))
+            {
+                const FName LabelName(*GetAttr(Element, "Name"));
+                if (Labels.Contains(LabelName))
+                {
+                    Error(FString::Printf(TEXT("Duplicate label '%s'"), *LabelName.ToString()));
+                }
+                Labels.Add(LabelName, Graph.Instructions.Num());
+            }
+            else if (Type == TEXT("Goto"))
+            {
+                EmitJump(ETaskGraphOp::Jump, GetAttr(Element, "Label"));
+            }
+            else if (Type == TEXT("Branch"))
+            {
+                const FString When = GetAttr(Element, "When");
+                const FString Goto = GetAttr(Element, "Goto");
+                if (When == TEXT("NoTarget"))
+                {
+                    EmitJump(ETaskGraphOp::JumpIfNoTarget, Goto);
+                }
+                else if (When == TEXT("Near") || When == TEXT("Far"))
+                {
+                    const int32 Slot = FindPoint(GetAttr(Element, "Point"));
+                    EmitJump(When == TEXT("Near") ? ETaskGraphOp::JumpIfNear : ETaskGraphOp::JumpIfFar,
+                             Goto, (uint8)FMath::Max(Slot, 0), Element->FloatAttribute("Radius", 50.0f));
+                }
+                else
+                {
+                    Error(FString::Printf(TEXT("Unknown branch condition '%s'"), *When));
+                }
+            }
+            else if (Type == TEXT("SubTask"))
+            {
+                const FString TaskType = GetAttr(Element, "Type");
+                if (TaskType.IsEmpty())
+                {
+                    Error(TEXT("SubTask without a Type"));
+                    return;
+                }
+                const ETaskTypeId TypeId = FTaskTypeRegistry::FindTypeId(FName(*TaskType));
+                if (TypeId == ETaskTypeId::Invalid || TypeId == ETaskTypeId::Graph)
+                {
+                    Error(FString::Printf(TEXT("SubTask type '%s' is not a registered task type"), *TaskType));
+                    return;
+                }
+                FTaskGraphInstruction& Instruction = Emit(ETaskGraphOp::RunSubTask);
+                Instruction.A = Element->BoolAttribute("Optional", false) ? 1 : 0;
+                Instruction.Operand = (int32)TypeId;
+            }
+            else if (Type == TEXT("Log"))
+            {
+                Emit(ETaskGraphOp::Log).Operand = AddString(GetAttr(Element, "Message"));
+            }
+            else if (Type == TEXT("Succeed"))
+            {
+                Emit(ETaskGraphOp::Succeed);
+            }
+            else if (Type == TEXT("Fail"))
+            {
+                Emit(ETaskGraphOp::Fail).Operand = AddString(GetAttr(Element, "Reason"));
+            }
+            else
+            {
+                Error(FString::Printf(TEXT("Unknown instruction <%s>"), *Type));
+            }
+        }
+
+        void ResolveJumps()
+        {
+            for (const TPair<int32, FName>& Jump : PendingJumps)
+            {
+                const int32* Target = Labels.Find(Jump.Value);
+                if (!Target)
+                {
+                    Error(FString::Printf(TEXT("Unknown label '%s'"), *Jump.Value.ToString()));
+                    continue;
+                }
+                Graph.Instructions[Jump.Key].Operand = *Target;
+            }
+        }
+    };
+}
+
+UTaskGraphLibrary::UTaskGraphLibrary()
+{
+    // Constructor
+}
+
+bool UTaskGraphLibrary::LoadTaskGraphsFromXML(const FString& XMLFilePath)
+{
+    FString FilePath = XMLFilePath;
+    if (FilePath.IsEmpty())
+    {
+        // Default path to TaskGraphs.xml in the project root Data folder
+        FilePath = FPaths::ProjectDir() + TEXT("Data/Tasks/TaskGraphs.xml");
+        bDefaultGraphsLoaded = true;
+    }
+
+    FString XMLContent;
+    if (!FFileHelper::LoadFileToString(XMLContent, *FilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("TaskGraphLibrary: Failed to load XML file from %s"), *FilePath);
+        return false;
+    }
+
+    tinyxml2::XMLDocument Doc;
+    if (Doc.Parse(TCHAR_TO_UTF8(*XMLContent)) != tinyxml2::XML_SUCCESS || !Doc.RootElement())
+    {
+        UE_LOG(LogTemp, Error, TEXT("TaskGraphLibrary: Failed to parse %s"), *FilePath);
+        return false;
+    }
+
+    int32 CompiledCount = 0;
+    for (const tinyxml2::XMLElement* GraphElement = Doc.RootElement()->FirstChildElement("TaskGraph"); GraphElement != nullptr; GraphElement = GraphElement->NextSiblingElement("TaskGraph"))
+    {
+        TSharedPtr<FCompiledTaskGraph> Graph = CompileGraph(GraphElement);
+        if (Graph.IsValid())
+        {
+            CompiledGraphs.Add(Graph->GraphName, Graph);
+            ++CompiledCount;
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("TaskGraphLibrary: Compiled %d task graphs from %s"), CompiledCount, *FilePath);
+    return CompiledCount > 0;
+}
+
+TSharedPtr<FCompiledTaskGraph> UTaskGraphLibrary::CompileGraph(const tinyxml2::XMLElement* GraphElement)
+{
+    using namespace TaskGraphCompiler;
+
+    TSharedPtr<FCompiledTaskGraph> Graph = MakeShared<FCompiledTaskGraph>();
+    Graph->GraphName = FName(*GetAttr(GraphElement, "Name"));
+    Graph->TimeoutDuration = GraphElement->FloatAttribute("Timeout", 30.0f);
+    Graph->bRequiresTarget = GraphElement->BoolAttribute("RequiresTarget", false);
+
+    if (Graph->GraphName.IsNone())
+    {
+        UE_LOG(LogTemp, Error, TEXT("TaskGraphLibrary: <TaskGraph> without a Name"));
+        return nullptr;
+    }
+
+    FCompileContext Context(*Graph);
+    for (const tinyxml2::XMLElement* PhaseElement = GraphElement->FirstChildElement("Phase"); PhaseElement != nullptr; PhaseElement = PhaseElement->NextSiblingElement("Phase"))
+    {
+        EComplexTaskPhase Stage;
+        const FString StageString = GetAttr(PhaseElement, "Stage");
+        if (!ParseStage(StageString, Stage))
+        {
+            Context.Error(FString::Printf(TEXT("Unknown stage '%s'"), *StageString));
+            continue;
+        }
+
+        FTaskGraphInstruction& Begin = Context.Emit(ETaskGraphOp::BeginPhase);
+        Begin.A = (uint8)Stage;
+        Begin.F[0] = PhaseElement->FloatAttribute("Timeout", 0.0f);
+
+        for (const tinyxml2::XMLElement* Element = PhaseElement->FirstChildElement(); Element != nullptr; Element = Element->NextSiblingElement())
+        {
+            Context.CompileInstruction(Element);
+        }
+    }
+
+    // Falling off the end of the last phase completes the task; this also backs any trailing label
+    Context.Emit(ETaskGraphOp::Succeed);
+    Context.ResolveJumps();
+
+    if (Context.bHasError)
+    {
+        UE_LOG(LogTemp, Error, TEXT("TaskGraphLibrary: Graph '%s' rejected"), *Graph->GraphName.ToString());
+        return nullptr;
+    }
+
+    Graph->Instructions.Shrink();
+    UE_LOG(LogTemp, Log, TEXT("TaskGraphLibrary: Compiled graph '%s' (%d instructions, %d points)"),
+           *Graph->GraphName.ToString(), Graph->Instructions.Num(), Graph->PointNames.Num());
+    return Graph;
+}
+
+TSharedPtr<const FCompiledTaskGraph> UTaskGraphLibrary::FindGraph(FName GraphName)
+{
+    if (!bDefaultGraphsLoaded)
+    {
+        LoadTaskGraphsFromXML();
+    }
+
+    if (const TSharedPtr<const FCompiledTaskGraph>* Graph = CompiledGraphs.Find(GraphName))
+    {
+        return *Graph;
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("TaskGraphLibrary: Graph '%s' not found"), *GraphName.ToString());
+    return nullptr;
+}
+
+TArray<FName> UTaskGraphLibrary::GetGraphNames()
+{
+    TArray<FName> Names;
+    CompiledGraphs.GetKeys(Names);
+    return Names;
+}
+
+void UTaskGraphLibrary::ClearGraphs()
+{
+    CompiledGraphs.Empty();
+    bDefaultGraphsLoaded = false;
+}
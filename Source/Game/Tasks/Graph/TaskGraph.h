@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "TaskGraph.generated.h"
+
+namespace tinyxml2
+{
+    class XMLElement;
+}
+
+/** Opcodes understood by the task graph interpreter (see UTask_Graph) */
+enum class ETaskGraphOp : uint8
+{
+    BeginPhase,     // A = EComplexTaskPhase, F[0] = phase timeout
+    SetPoint,       // A = dest slot, B = ETaskGraphAnchor, C = source slot, F = local offset
+    TraceGround,    // A = slot, F[0] = trace up, F[1] = trace down, F[2] = lift above hit
+    MoveTo,         // A = slot, F[0] = interp speed, F[1] = accept radius (blocking)
+    SnapTo,         // A = slot
+    Wait,           // F[0] = duration (blocking)
+    JumpIfNear,     // A = slot, F[0] = radius, Operand = target instruction
+    JumpIfFar,      // A = slot, F[0] = radius, Operand = target instruction
+    JumpIfNoTarget, // Operand = target instruction
+    Jump,           // Operand = target instruction
+    RunSubTask,     // Operand = ETaskTypeId, A = optional (blocking)
+    Log,            // Operand = string index
+    Succeed,
+    Fail            // Operand = string index of reason
+};
+
+/** Where a SetPoint instruction reads its base transform from */
+enum class ETaskGraphAnchor : uint8
+{
+    Self,
+    Target,
+    Point
+};
+
+/**
+ * Single compiled task graph instruction
+ * Fixed 20-byte POD so a whole graph sits in a few cache lines
+ */
+struct FTaskGraphInstruction
+{
+    ETaskGraphOp Op = ETaskGraphOp::Succeed;
+    uint8 A = 0;
+    uint8 B = 0;
+    uint8 C = 0;
+    int32 Operand = INDEX_NONE;
+    float F[3] = { 0.0f, 0.0f, 0.0f };
+};
+
+/**
+ * Compiled Task Graph - immutable execution plan shared by every ped running it
+ */
+struct FCompiledTaskGraph
+{
+    static constexpr int32 MaxPoints = 8;
+
+    FName GraphName;
+    float TimeoutDuration = 30.0f;
+    bool bRequiresTarget = false;
+
+    TArray<FTaskGraphInstruction> Instructions;
+    TArray<FString> Strings;        // Task types, log messages and failure reasons
+    TArray<FName> PointNames;       // Debug names for point slots
+};
+
+/**
+ * Task Graph Library
+ * Loads Data/Tasks/TaskGraphs.xml and compiles each <TaskGraph> into a flat instruction array
+ */
+UCLASS()
+class GAME_API UTaskGraphLibrary : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UTaskGraphLibrary();
+
+    /** Load and compile every graph in the given file (defaults to Data/Tasks/TaskGraphs.xml) */
+    static bool LoadTaskGraphsFromXML(const FString& XMLFilePath = TEXT(""));
+
+    /** Find a compiled graph by name, loading the default file on first use */
+    static TSharedPtr<const FCompiledTaskGraph> FindGraph(FName GraphName);
+
+    /** Names of all compiled graphs */
+    static TArray<FName> GetGraphNames();
+
+    /** Drop all compiled graphs */
+    static void ClearGraphs();
+
+private:
+    /** Compile one <TaskGraph> element, returns nullptr and logs on any error */
+    static TSharedPtr<FCompiledTaskGraph> CompileGraph(const tinyxml2::XMLElement* GraphElement);
+
+    static TMap<FName, TSharedPtr<const FCompiledTaskGraph>> CompiledGraphs;
+    static bool bDefaultGraphsLoaded;
+};
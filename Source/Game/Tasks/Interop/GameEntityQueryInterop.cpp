@@ -0,0 +1,26 @@
+#include "GameEntityQueryInterop.h"
+#include "../../Core/Entity/EntitySpatialSubsystem.h"
+#include "../../Core/Entity/BaseEntity.h"
+#include "Engine/World.h"
+
+int32 FGameEntityQueryInterop::GetPedsInRange(UWorld* World, const FVector& Center, float Radius, AActor** OutPeds, int32 MaxCount)
+{
+    UEntitySpatialSubsystem* SpatialIndex = World ? World->GetSubsystem<UEntitySpatialSubsystem>() : nullptr;
+    if (!SpatialIndex || !OutPeds || MaxCount <= 0 || Radius <= 0.0f)
+    {
+        return 0;
+    }
+
+    TArray<UBaseEntity*> NearbyPeds;
+    SpatialIndex->FindNearestEntities(Center, MaxCount, NearbyPeds, Radius, EEntityType::Ped);
+
+    int32 NumWritten = 0;
+    for (UBaseEntity* Entity : NearbyPeds)
+    {
+        if (AActor* Actor = Entity->GetOwnerActor())
+        {
+            OutPeds[NumWritten++] = Actor;
+        }
+    }
+    return NumWritten;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EntityQueryInterop.h"
+
+/**
+ * Game-side implementation of IEntityQueryInterop, registered by the game module on startup
+ */
+class GAME_API FGameEntityQueryInterop : public IEntityQueryInterop
+{
+public:
+    // IEntityQueryInterop interface
+    virtual int32 GetPedsInRange(UWorld* World, const FVector& Center, float Radius, AActor** OutPeds, int32 MaxCount) override;
+};
@@ -0,0 +1,225 @@
+#include "GameTaskSystemInterop.h"
+#include "../TaskFactory.h"
+#include "../TaskManager.h"
+#include "../TaskTypeRegistry.h"
+#include "../TaskHandleRegistry.h"
+#include "../../Peds/Ped.h"
+#include "UObject/Package.h"
+
+static_assert((int32)EInteropTaskState::Idle == (int32)ETaskState::Idle &&
+              (int32)EInteropTaskState::Running == (int32)ETaskState::Running &&
+              (int32)EInteropTaskState::Completed == (int32)ETaskState::Completed &&
+              (int32)EInteropTaskState::Interrupted == (int32)ETaskState::Interrupted,
+              "EInteropTaskState must match ETaskState");
+
+int32 FGameTaskSystemInterop::GetTaskTypeCount() const
+{
+    return FTaskTypeRegistry::GetTypeCount();
+}
+
+const char* FGameTaskSystemInterop::GetTaskTypeName(int32 TypeId) const
+{
+    return FTaskTypeRegistry::GetTypeNameUTF8((ETaskTypeId)TypeId);
+}
+
+int32 FGameTaskSystemInterop::FindTaskTypeId(const char* TypeName) const
+{
+    if (!TypeName)
+    {
+        return INDEX_NONE;
+    }
+
+    const ETaskTypeId TypeId = FTaskTypeRegistry::FindTypeId(FName(UTF8_TO_TCHAR(TypeName)));
+    return TypeId == ETaskTypeId::Invalid ? INDEX_NONE : (int32)TypeId;
+}
+
+bool FGameTaskSystemInterop::GiveTaskById(AActor* Ped, int32 TypeId, const FVector& Location)
+{
+    APed* OwnerPed = Cast<APed>(Ped);
+    if (!IsValid(OwnerPed) || !FTaskTypeRegistry::IsValidId(TypeId))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("TaskSystemInterop: GiveTaskById rejected (ped valid: %d, type id: %d)"), 
+               IsValid(OwnerPed) ? 1 : 0, TypeId);
+        return false;
+    }
+
+    // Graph tasks need a graph name, which the id path can't carry
+    if ((ETaskTypeId)TypeId == ETaskTypeId::Graph)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("TaskSystemInterop: Graph tasks can't be created by id alone"));
+        return false;
+    }
+
+    UBaseTask* Task = UTaskFactory::CreateTaskById((ETaskTypeId)TypeId, OwnerPed);
+    if (!Task)
+    {
+        return false;
+    }
+
+    // Location-driven task types take the mod-supplied location
+    const FVector ToLocation = Location - OwnerPed->GetActorLocation();
+    switch ((ETaskTypeId)TypeId)
+    {
+        case ETaskTypeId::Turn:
+            Cast<UTask_Turn>(Task)->SetTargetDirection(ToLocation.GetSafeNormal2D());
+            break;
+        case ETaskTypeId::Shimmy:
+            Cast<UTask_Shimmy>(Task)->SetShimmyDirection(ToLocation.GetSafeNormal2D());
+            break;
+        case ETaskTypeId::Jump:
+            Cast<UTask_Jump>(Task)->SetJumpTarget(Location);
+            break;
+        case ETaskTypeId::MoveTowards:
+            Cast<UTask_MoveTowards>(Task)->SetTargetLocation(Location);
+            break;
+        default:
+            break;
+    }
+
+    UTaskManager* TaskManager = FindOrCreateTaskManager(OwnerPed);
+    return TaskManager && TaskManager->AddTask(Task);
+}
+
+int32 FGameTaskSystemInterop::CreateTask(int32 TypeId, int32 Priority)
+{
+    if (!FTaskTypeRegistry::IsValidId(TypeId) || (ETaskTypeId)TypeId == ETaskTypeId::Graph)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("TaskSystemInterop: CreateTask rejected type id %d"), TypeId);
+        return 0;
+    }
+
+    // Unassigned tasks live in the transient package; the handle registry keeps them alive until they finish
+    UBaseTask* Task = FTaskTypeRegistry::Construct((ETaskTypeId)TypeId, GetTransientPackage());
+    if (!Task)
+    {
+        return 0;
+    }
+
+    Task->SetPriority((ETaskPriority)FMath::Clamp(Priority, (int32)ETaskPriority::Lowest, (int32)ETaskPriority::Emergency));
+    return FTaskHandleRegistry::Get().GetOrCreateHandle(Task);
+}
+
+void FGameTaskSystemInterop::ReleaseTask(int32 TaskHandle)
+{
+    FTaskHandleRegistry::Get().Release(TaskHandle);
+}
+
+bool FGameTaskSystemInterop::AssignTask(AActor* Ped, int32 TaskHandle)
+{
+    APed* OwnerPed = Cast<APed>(Ped);
+    UBaseTask* Task = FTaskHandleRegistry::Get().Resolve(TaskHandle);
+    if (!IsValid(OwnerPed) || !Task)
+    {
+        return false;
+    }
+
+    Task->Initialize(OwnerPed, Task->GetTaskTarget());
+
+    UTaskManager* TaskManager = FindOrCreateTaskManager(OwnerPed);
+    return TaskManager && TaskManager->AddTask(Task);
+}
+
+bool FGameTaskSystemInterop::RemoveTask(AActor* Ped, int32 TaskHandle)
+{
+    APed* OwnerPed = Cast<APed>(Ped);
+    UTaskManager* TaskManager = OwnerPed ? OwnerPed->FindComponentByClass<UTaskManager>() : nullptr;
+    UBaseTask* Task = FTaskHandleRegistry::Get().Resolve(TaskHandle);
+    return TaskManager && Task && TaskManager->StopTask(Task);
+}
+
+void FGameTaskSystemInterop::ClearAllTasks(AActor* Ped)
+{
+    if (UTaskManager* TaskManager = Ped ? Ped->FindComponentByClass<UTaskManager>() : nullptr)
+    {
+        TaskManager->ClearAllTasks();
+    }
+}
+
+bool FGameTaskSystemInterop::InterruptCurrentTask(AActor* Ped)
+{
+    UTaskManager* TaskManager = Ped ? Ped->FindComponentByClass<UTaskManager>() : nullptr;
+    return TaskManager && TaskManager->InterruptCurrentTask();
+}
+
+int32 FGameTaskSystemInterop::GetTaskState(int32 TaskHandle) const
+{
+    return FTaskHandleRegistry::Get().GetState(TaskHandle);
+}
+
+void FGameTaskSystemInterop::GetTaskStates(const int32* TaskHandles, int32* OutStates, int32 Count) const
+{
+    FTaskHandleRegistry::Get().GetStates(TaskHandles, OutStates, Count);
+}
+
+int32 FGameTaskSystemInterop::GetTaskTypeId(int32 TaskHandle) const
+{
+    const ETaskTypeId TypeId = FTaskHandleRegistry::Get().GetTypeId(TaskHandle);
+    return TypeId == ETaskTypeId::Invalid ? INDEX_NONE : (int32)TypeId;
+}
+
+int32 FGameTaskSystemInterop::GetTaskPriority(int32 TaskHandle) const
+{
+    const UBaseTask* Task = FTaskHandleRegistry::Get().Resolve(TaskHandle);
+    return Task ? (int32)Task->GetTaskPriority() : -1;
+}
+
+int32 FGameTaskSystemInterop::GetActiveTaskCount(AActor* Ped) const
+{
+    const UTaskManager* TaskManager = Ped ? Ped->FindComponentByClass<UTaskManager>() : nullptr;
+    return TaskManager ? TaskManager->GetTaskCount() : 0;
+}
+
+int32 FGameTaskSystemInterop::GetCurrentTask(AActor* Ped)
+{
+    const UTaskManager* TaskManager = Ped ? Ped->FindComponentByClass<UTaskManager>() : nullptr;
+    return TaskManager ? FTaskHandleRegistry::Get().GetOrCreateHandle(TaskManager->GetCurrentTask()) : 0;
+}
+
+int32 FGameTaskSystemInterop::GetActiveTasks(AActor* Ped, int32* OutTaskHandles, int32 MaxCount)
+{
+    const UTaskManager* TaskManager = Ped ? Ped->FindComponentByClass<UTaskManager>() : nullptr;
+    if (!TaskManager || !OutTaskHandles || MaxCount <= 0)
+    {
+        return 0;
+    }
+
+    FTaskHandleRegistry& Registry = FTaskHandleRegistry::Get();
+    int32 Count = 0;
+    if (UBaseTask* CurrentTask = TaskManager->GetCurrentTask())
+    {
+        OutTaskHandles[Count++] = Registry.GetOrCreateHandle(CurrentTask);
+    }
+    for (UBaseTask* PendingTask : TaskManager->GetPendingTasks())
+    {
+        if (Count >= MaxCount)
+        {
+            break;
+        }
+        if (PendingTask)
+        {
+            OutTaskHandles[Count++] = Registry.GetOrCreateHandle(PendingTask);
+        }
+    }
+    return Count;
+}
+
+UObject* FGameTaskSystemInterop::GetTaskManager(AActor* Ped)
+{
+    return FindOrCreateTaskManager(Cast<APed>(Ped));
+}
+
+UTaskManager* FGameTaskSystemInterop::FindOrCreateTaskManager(APed* Ped)
+{
+    if (!Ped)
+    {
+        return nullptr;
+    }
+
+    UTaskManager* TaskManager = Ped->FindComponentByClass<UTaskManager>();
+    if (!TaskManager)
+    {
+        TaskManager = NewObject<UTaskManager>(Ped, TEXT("TaskManager"));
+        TaskManager->RegisterComponent();
+    }
+    return TaskManager;
+}
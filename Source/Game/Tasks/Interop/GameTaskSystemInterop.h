@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TaskSystemInterop.h"
+
+class APed;
+class UTaskManager;
+
+/**
+ * Game-side implementation of ITaskSystemInterop, registered by the game module on startup
+ */
+class GAME_API FGameTaskSystemInterop : public ITaskSystemInterop
+{
+public:
+    // ITaskSystemInterop interface
+    virtual int32 GetTaskTypeCount() const override;
+    virtual const char* GetTaskTypeName(int32 TypeId) const override;
+    virtual int32 FindTaskTypeId(const char* TypeName) const override;
+    virtual bool GiveTaskById(AActor* Ped, int32 TypeId, const FVector& Location) override;
+    virtual int32 CreateTask(int32 TypeId, int32 Priority) override;
+    virtual void ReleaseTask(int32 TaskHandle) override;
+    virtual bool AssignTask(AActor* Ped, int32 TaskHandle) override;
+    virtual bool RemoveTask(AActor* Ped, int32 TaskHandle) override;
+    virtual void ClearAllTasks(AActor* Ped) override;
+    virtual bool InterruptCurrentTask(AActor* Ped) override;
+    virtual int32 GetTaskState(int32 TaskHandle) const override;
+    virtual void GetTaskStates(const int32* TaskHandles, int32* OutStates, int32 Count) const override;
+    virtual int32 GetTaskTypeId(int32 TaskHandle) const override;
+    virtual int32 GetTaskPriority(int32 TaskHandle) const override;
+    virtual int32 GetActiveTaskCount(AActor* Ped) const override;
+    virtual int32 GetCurrentTask(AActor* Ped) override;
+    virtual int32 GetActiveTasks(AActor* Ped, int32* OutTaskHandles, int32 MaxCount) override;
+    virtual UObject* GetTaskManager(AActor* Ped) override;
+
+    /** The ped's task manager, created and registered on first use */
+    static UTaskManager* FindOrCreateTaskManager(APed* Ped);
+};
@@ -1,6 +1,7 @@
 #include "ComplexTask.h"
 #include "../../../Peds/Ped.h"
 #include "../../../Core/Utils/RaycastUtils.h"
+#include "../../TaskFactory.h"
 #include "Engine/World.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -703,3 +704,273 @@ bool UTask_ClimbLadder::ValidateTaskConditions() const
 
     return TargetLadder && IsValid(TargetLadder);
 }
+
+// =====================================================
+// UTask_Graph Implementation
+// =====================================================
+
+UTask_Graph::UTask_Graph()
+{
+    TaskName = TEXT("Graph");
+    TaskDescription = TEXT("Run a data-driven task graph");
+    bRequiresTarget = false;
+    bRequiresPreparation = false;
+    PhaseTimeout = 0.0f;
+    MaxInstructionsPerTick = 64;
+    ActiveSubTask = nullptr;
+    ProgramCounter = 0;
+    WaitTime = 0.0f;
+}
+
+bool UTask_Graph::SetGraph(FName InGraphName)
+{
+    Graph = UTaskGraphLibrary::FindGraph(InGraphName);
+    if (!Graph.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Task_Graph: Unknown graph '%s'"), *InGraphName.ToString());
+        return false;
+    }
+
+    GraphName = InGraphName;
+    TaskName = InGraphName.ToString();
+    TimeoutDuration = Graph->TimeoutDuration;
+    bRequiresTarget = Graph->bRequiresTarget;
+    return true;
+}
+
+bool UTask_Graph::ExecuteTask()
+{
+    if (!Graph.IsValid() && !SetGraph(GraphName))
+    {
+        return false;
+    }
+
+    if (Graph->bRequiresTarget && !TaskTarget)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Task_Graph %s: Graph requires a target"), *TaskName);
+        return false;
+    }
+
+    ProgramCounter = 0;
+    WaitTime = 0.0f;
+    ActiveSubTask = nullptr;
+    for (FVector& Point : Points)
+    {
+        Point = FVector::ZeroVector;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Task_Graph %s: Started (%d instructions)"), *TaskName, Graph->Instructions.Num());
+    return true;
+}
+
+void UTask_Graph::UpdateTask(float DeltaTime)
+{
+    // Skip UComplexTask::UpdateTask - phases are driven by BeginPhase instructions, not virtual ExecutePhase calls
+    UBaseTask::UpdateTask(DeltaTime);
+
+    PhaseTime += DeltaTime;
+    if (PhaseTimeout > 0.0f && PhaseTime >= PhaseTimeout)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Task_Graph %s: Phase timed out at instruction %d"), *TaskName, ProgramCounter);
+        CompleteTask(false, TEXT("Phase timed out"));
+        return;
+    }
+
+    RunInterpreter(DeltaTime);
+}
+
+void UTask_Graph::CleanupTask()
+{
+    if (ActiveSubTask && ActiveSubTask->IsTaskActive())
+    {
+        ActiveSubTask->StopTask();
+    }
+    ActiveSubTask = nullptr;
+
+    Super::CleanupTask();
+}
+
+void UTask_Graph::RunInterpreter(float DeltaTime)
+{
+    if (!OwnerPed || !Graph.IsValid())
+    {
+        CompleteTask(false, TEXT("Graph has no owner"));
+        return;
+    }
+
+    const TArray<FTaskGraphInstruction>& Instructions = Graph->Instructions;
+
+    for (int32 Budget = MaxInstructionsPerTick; Budget > 0; --Budget)
+    {
+        if (!Instructions.IsValidIndex(ProgramCounter))
+        {
+            CompleteTask(true, TEXT("Task graph completed"));
+            return;
+        }
+
+        const FTaskGraphInstruction& Instruction = Instructions[ProgramCounter];
+
+        switch (Instruction.Op)
+        {
+            case ETaskGraphOp::BeginPhase:
+                SetCurrentPhase((EComplexTaskPhase)Instruction.A);
+                PhaseTime = 0.0f;
+                PhaseTimeout = Instruction.F[0];
+                break;
+
+            case ETaskGraphOp::SetPoint:
+            {
+                FTransform Base;
+                switch ((ETaskGraphAnchor)Instruction.B)
+                {
+                    case ETaskGraphAnchor::Self:
+                        Base = OwnerPed->GetActorTransform();
+                        break;
+
+                    case ETaskGraphAnchor::Target:
+                        if (!IsValid(TaskTarget))
+                        {
+                            CompleteTask(false, TEXT("Graph point needs a target"));
+                            return;
+                        }
+                        Base = TaskTarget->GetActorTransform();
+                        break;
+
+                    case ETaskGraphAnchor::Point:
+                        Base = FTransform(OwnerPed->GetActorRotation(), Points[Instruction.C]);
+                        break;
+                }
+
+                const FVector LocalOffset(Instruction.F[0], Instruction.F[1], Instruction.F[2]);
+                Points[Instruction.A] = Base.GetLocation() + Base.GetRotation().RotateVector(LocalOffset);
+                break;
+            }
+
+            case ETaskGraphOp::TraceGround:
+            {
+                FHitResult HitResult;
+                const FVector TraceStart = Points[Instruction.A] + FVector(0, 0, Instruction.F[0]);
+                const FVector TraceEnd = Points[Instruction.A] - FVector(0, 0, Instruction.F[1]);
+
+                if (GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_WorldStatic))
+                {
+                    Points[Instruction.A] = HitResult.Location + FVector(0, 0, Instruction.F[2]);
+                }
+                break;
+            }
+
+            case ETaskGraphOp::MoveTo:
+            {
+                const FVector CurrentLocation = OwnerPed->GetActorLocation();
+                if (FVector::Dist(CurrentLocation, Points[Instruction.A]) > Instruction.F[1])
+                {
+                    FVector NewLocation = FMath::VInterpTo(CurrentLocation, Points[Instruction.A], DeltaTime, Instruction.F[0]);
+                    OwnerPed->SetActorLocation(NewLocation);
+                    return;
+                }
+                break;
+            }
+
+            case ETaskGraphOp::SnapTo:
+                OwnerPed->SetActorLocation(Points[Instruction.A]);
+                break;
+
+            case ETaskGraphOp::Wait:
+                WaitTime += DeltaTime;
+                if (WaitTime < Instruction.F[0])
+                {
+                    return;
+                }
+                WaitTime = 0.0f;
+                break;
+
+            case ETaskGraphOp::JumpIfNear:
+                if (FVector::Dist(OwnerPed->GetActorLocation(), Points[Instruction.A]) <= Instruction.F[0])
+                {
+                    ProgramCounter = Instruction.Operand;
+                    continue;
+                }
+                break;
+
+            case ETaskGraphOp::JumpIfFar:
+                if (FVector::Dist(OwnerPed->GetActorLocation(), Points[Instruction.A]) > Instruction.F[0])
+                {
+                    ProgramCounter = Instruction.Operand;
+                    continue;
+                }
+                break;
+
+            case ETaskGraphOp::JumpIfNoTarget:
+                if (!IsValid(TaskTarget))
+                {
+                    ProgramCounter = Instruction.Operand;
+                    continue;
+                }
+                break;
+
+            case ETaskGraphOp::Jump:
+                ProgramCounter = Instruction.Operand;
+                continue;
+
+            case ETaskGraphOp::RunSubTask:
+                if (!ActiveSubTask)
+                {
+                    const ETaskTypeId SubTaskType = (ETaskTypeId)Instruction.Operand;
+                    ActiveSubTask = UTaskFactory::CreateTaskById(SubTaskType, OwnerPed, TaskTarget);
+                    if (!ActiveSubTask || !ActiveSubTask->StartTask())
+                    {
+                        ActiveSubTask = nullptr;
+                        if (Instruction.A == 0)
+                        {
+                            CompleteTask(false, FString::Printf(TEXT("Sub-task %s failed to start"), *FTaskTypeRegistry::GetTypeName(SubTaskType).ToString()));
+                            return;
+                        }
+                        break;
+                    }
+                    return;
+                }
+                if (!UpdateSubTask(DeltaTime, Instruction.A != 0))
+                {
+                    return;
+                }
+                break;
+
+            case ETaskGraphOp::Log:
+                UE_LOG(LogTemp, Log, TEXT("Task_Graph %s: %s"), *TaskName, *Graph->Strings[Instruction.Operand]);
+                break;
+
+            case ETaskGraphOp::Succeed:
+                CompleteTask(true, TEXT("Task graph completed"));
+                return;
+
+            case ETaskGraphOp::Fail:
+                CompleteTask(false, Graph->Strings[Instruction.Operand]);
+                return;
+        }
+
+        ++ProgramCounter;
+    }
+}
+
+bool UTask_Graph::UpdateSubTask(float DeltaTime, bool bOptional)
+{
+    ActiveSubTask->TickTask(DeltaTime);
+
+    const ETaskState SubTaskState = ActiveSubTask->GetTaskState();
+    if (SubTaskState == ETaskState::Running || SubTaskState == ETaskState::Paused)
+    {
+        return false;
+    }
+
+    const bool bSubTaskSucceeded = SubTaskState == ETaskState::Completed;
+    const FString SubTaskName = ActiveSubTask->GetTaskName();
+    ActiveSubTask = nullptr;
+
+    if (!bSubTaskSucceeded && !bOptional)
+    {
+        CompleteTask(false, FString::Printf(TEXT("Sub-task %s failed"), *SubTaskName));
+        return false;
+    }
+
+    return true;
+}
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "../../BaseTask.h"
+#include "../../Graph/TaskGraph.h"
 #include "ComplexTask.generated.h"
 
 UENUM(BlueprintType)
@@ -229,3 +230,49 @@ private:
     float ClimbProgress;
     float LadderHeight;
 };
+
+/**
+ * Task_Graph - Runs a data-driven task graph compiled from Data/Tasks/TaskGraphs.xml
+ * A single switch-based interpreter walks the flat instruction array, so one class covers every graph
+ */
+UCLASS()
+class GAME_API UTask_Graph : public UComplexTask
+{
+    GENERATED_BODY()
+
+public:
+    UTask_Graph();
+
+    /** Bind the compiled graph to run; must be called before StartTask */
+    bool SetGraph(FName InGraphName);
+
+    FName GetGraphName() const { return GraphName; }
+
+protected:
+    virtual bool ExecuteTask() override;
+    virtual void UpdateTask(float DeltaTime) override;
+    virtual void CleanupTask() override;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Graph Config")
+    FName GraphName;
+
+    /** Upper bound on non-blocking instructions executed per tick (guards against Goto loops) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Graph Config")
+    int32 MaxInstructionsPerTick;
+
+    /** Sub-task currently blocking the graph, if any */
+    UPROPERTY()
+    UBaseTask* ActiveSubTask;
+
+private:
+    /** Run instructions until one blocks or the task finishes */
+    void RunInterpreter(float DeltaTime);
+
+    /** Tick the blocking sub-task; returns true when the graph may continue */
+    bool UpdateSubTask(float DeltaTime, bool bOptional);
+
+    TSharedPtr<const FCompiledTaskGraph> Graph;
+    FVector Points[FCompiledTaskGraph::MaxPoints];
+    int32 ProgramCounter;
+    float WaitTime;
+};
@@ -1,6 +1,8 @@
 #include "WildComplexTask.h"
 #include "../../../Peds/Ped.h"
 #include "../../../Core/Utils/RaycastUtils.h"
+#include "../../../Core/Entity/EntitySpatialSubsystem.h"
+#include "WildComplexTaskScheduler.h"
 #include "Engine/World.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -25,12 +27,24 @@ UWildComplexTask::UWildComplexTask()
     LastAnalysisTime = 0.0f;
     LastPlanningTime = 0.0f;
     bSystemsInitialized = false;
+    bUsesBatchedAnalysis = false;
+    bLastAnalysisSucceeded = true;
 }
 
 bool UWildComplexTask::ExecuteTask()
 {
     SetWildComplexState(EWildComplexTaskState::Initializing);
-    return InitializeComplexSystems();
+    if (!InitializeComplexSystems())
+    {
+        return false;
+    }
+
+    // Hand analysis to the world scheduler so it can run alongside every other fighting ped
+    UWorld* World = GetWorld();
+    UWildComplexTaskScheduler* Scheduler = World ? World->GetSubsystem<UWildComplexTaskScheduler>() : nullptr;
+    bUsesBatchedAnalysis = Scheduler && Scheduler->RegisterTask(this);
+    bLastAnalysisSucceeded = true;
+    return true;
 }
 
 void UWildComplexTask::UpdateTask(float DeltaTime)
@@ -53,15 +67,7 @@ void UWildComplexTask::UpdateTask(float DeltaTime)
             break;
 
         case EWildComplexTaskState::Analyzing:
-            if (ExecutionTime - LastAnalysisTime >= AnalysisUpdateRate)
-            {
-                bStateSuccess = AnalyzeSituation(DeltaTime);
-                LastAnalysisTime = ExecutionTime;
-            }
-            else
-            {
-                bStateSuccess = true;
-            }
+            bStateSuccess = RunAnalysisIfDue(DeltaTime);
             
             if (StateTime >= 1.0f) // Move to planning after 1 second of analysis
             {
@@ -90,11 +96,7 @@ void UWildComplexTask::UpdateTask(float DeltaTime)
             bStateSuccess = ExecuteComplexActions(DeltaTime);
             
             // Continuous analysis during execution
-            if (ExecutionTime - LastAnalysisTime >= AnalysisUpdateRate)
-            {
-                AnalyzeSituation(DeltaTime);
-                LastAnalysisTime = ExecutionTime;
-            }
+            RunAnalysisIfDue(DeltaTime);
             
             // Check if adaptation is needed
             if (bEnableDynamicAdaptation && ShouldTransitionState())
@@ -130,6 +132,18 @@ void UWildComplexTask::UpdateTask(float DeltaTime)
 
 void UWildComplexTask::CleanupTask()
 {
+    if (bUsesBatchedAnalysis)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            if (UWildComplexTaskScheduler* Scheduler = World->GetSubsystem<UWildComplexTaskScheduler>())
+            {
+                Scheduler->UnregisterTask(this);
+            }
+        }
+        bUsesBatchedAnalysis = false;
+    }
+
     Super::CleanupTask();
     SetWildComplexState(EWildComplexTaskState::Finalizing);
 }
@@ -147,6 +161,55 @@ void UWildComplexTask::SetWildComplexState(EWildComplexTaskState NewState)
     }
 }
 
+bool UWildComplexTask::AnalyzeSituation(float DeltaTime)
+{
+    if (!GatherAnalysisInputs())
+    {
+        return false;
+    }
+
+    ComputeAnalysis();
+    return ApplyAnalysis();
+}
+
+bool UWildComplexTask::RunAnalysisIfDue(float DeltaTime)
+{
+    if (bUsesBatchedAnalysis)
+    {
+        // The scheduler already ran this frame's analysis; report its outcome
+        return bLastAnalysisSucceeded;
+    }
+
+    if (ExecutionTime - LastAnalysisTime >= AnalysisUpdateRate)
+    {
+        bLastAnalysisSucceeded = AnalyzeSituation(DeltaTime);
+        LastAnalysisTime = ExecutionTime;
+    }
+
+    return bLastAnalysisSucceeded;
+}
+
+bool UWildComplexTask::IsAnalysisDue() const
+{
+    if (!IsTaskActive() || !bSystemsInitialized)
+    {
+        return false;
+    }
+
+    if (CurrentWildState != EWildComplexTaskState::Analyzing && CurrentWildState != EWildComplexTaskState::Executing)
+    {
+        return false;
+    }
+
+    return ExecutionTime - LastAnalysisTime >= AnalysisUpdateRate;
+}
+
+void UWildComplexTask::FinishBatchedAnalysis(bool bSucceeded)
+{
+    bLastAnalysisSucceeded = bSucceeded;
+    LastAnalysisTime = ExecutionTime;
+}
+
 bool UWildComplexTask::ShouldTransitionState() const
 {
     // Implement adaptive logic here
@@ -182,6 +245,11 @@ UTask_FightAgainst::UTask_FightAgainst()
     bOpponentIsBlocking = false;
     bOpponentIsTired = false;
     OpponentSpeed = 0.0f;
+
+    SnapshotPedLocation = FVector::ZeroVector;
+    SnapshotOpponentLocation = FVector::ZeroVector;
+    SnapshotInterval = 0.0f;
+    LastSnapshotTime = 0.0f;
 }
 
 bool UTask_FightAgainst::InitializeComplexSystems()
@@ -238,13 +306,22 @@ bool UTask_FightAgainst::InitializeComplexSystems()
     return true;
 }
 
-bool UTask_FightAgainst::AnalyzeSituation(float DeltaTime)
+bool UTask_FightAgainst::GatherAnalysisInputs()
 {
     if (!Opponent || !OwnerPed)
     {
         return false;
     }
 
+    SnapshotPedLocation = OwnerPed->GetActorLocation();
+    SnapshotOpponentLocation = Opponent->GetActorLocation();
+    SnapshotInterval = FMath::Max(ExecutionTime - LastSnapshotTime, GetWorld()->GetDeltaSeconds());
+    LastSnapshotTime = ExecutionTime;
+    return true;
+}
+
+void UTask_FightAgainst::ComputeAnalysis()
+{
     UpdateCombatAnalysis();
     
     // Update combat intensity based on various factors
@@ -253,8 +330,6 @@ bool UTask_FightAgainst::AnalyzeSituation(float DeltaTime)
     float StaminaFactor = CurrentStamina / 100.0f;
     
     CombatIntensity = (DistanceFactor + (1.0f - HealthFactor) + StaminaFactor) / 3.0f;
-
-    return true;
 }
 
 bool UTask_FightAgainst::PlanActions(float DeltaTime)
@@ -340,20 +415,16 @@ bool UTask_FightAgainst::ValidateTaskConditions() const
 
 void UTask_FightAgainst::UpdateCombatAnalysis()
 {
-    if (!Opponent || !OwnerPed)
-    {
-        return;
-    }
-
-    FVector CurrentOpponentLocation = Opponent->GetActorLocation();
-    FVector PedLocation = OwnerPed->GetActorLocation();
+    // Runs off the game thread when batched - only the snapshot may be read here
+    const FVector& CurrentOpponentLocation = SnapshotOpponentLocation;
+    const FVector& PedLocation = SnapshotPedLocation;
 
     // Update distance
     OpponentDistance = FVector::Dist(PedLocation, CurrentOpponentLocation);
 
     // Update movement analysis
     OpponentMovementDirection = (CurrentOpponentLocation - LastKnownOpponentLocation).GetSafeNormal();
-    OpponentSpeed = FVector::Dist(CurrentOpponentLocation, LastKnownOpponentLocation) / GetWorld()->GetDeltaSeconds();
+    OpponentSpeed = FVector::Dist(CurrentOpponentLocation, LastKnownOpponentLocation) / FMath::Max(SnapshotInterval, KINDA_SMALL_NUMBER);
     LastKnownOpponentLocation = CurrentOpponentLocation;
 
     // Analyze opponent behavior (simplified)
@@ -453,6 +524,7 @@ UTask_CombatTargets::UTask_CombatTargets()
     
     PrimaryTarget = nullptr;
     SecondaryTarget = nullptr;
+    bPrimaryTargetChanged = false;
     bInCover = false;
     SuppressiveFire = 0.0f;
     ActiveTargets = 0;
@@ -464,6 +536,8 @@ UTask_CombatTargets::UTask_CombatTargets()
     bIsReloading = false;
     AmmoCount = 30;
     WeaponRange = 500.0f;
+
+    SnapshotPedLocation = FVector::ZeroVector;
 }
 
 bool UTask_CombatTargets::InitializeComplexSystems()
@@ -473,6 +547,12 @@ bool UTask_CombatTargets::InitializeComplexSystems()
         return false;
     }
 
+    // No explicit targets: engage whoever is nearby
+    if (CombatTargets.Num() == 0)
+    {
+        AcquireTargetsInRange();
+    }
+
     // Initialize target database
     TargetDatabase.Empty();
     for (AActor* Target : CombatTargets)
@@ -504,17 +584,46 @@ bool UTask_CombatTargets::InitializeComplexSystems()
     return true;
 }
 
-bool UTask_CombatTargets::AnalyzeSituation(float DeltaTime)
+bool UTask_CombatTargets::GatherAnalysisInputs()
 {
     if (!OwnerPed)
     {
         return false;
     }
 
+    SnapshotPedLocation = OwnerPed->GetActorLocation();
+    const float WorldTime = GetWorld()->GetTimeSeconds();
+
+    for (FTargetInfo& Info : TargetDatabase)
+    {
+        if (!Info.Target || !IsValid(Info.Target))
+        {
+            Info.bIsAlive = false;
+            continue;
+        }
+
+        Info.LastKnownPosition = Info.Target->GetActorLocation();
+        Info.LastSeenTime = WorldTime;
+    }
+
+    return true;
+}
+
+void UTask_CombatTargets::ComputeAnalysis()
+{
     UpdateTargetDatabase();
     SelectPrimaryTarget();
     DetermineOptimalStrategy();
-    
+}
+
+bool UTask_CombatTargets::ApplyAnalysis()
+{
+    if (bPrimaryTargetChanged && PrimaryTarget)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Task_CombatTargets: New primary target selected: %s"), *PrimaryTarget->GetName());
+    }
+    bPrimaryTargetChanged = false;
+
     return true;
 }
 
@@ -641,26 +750,19 @@ bool UTask_CombatTargets::ValidateTaskConditions() const
 
 void UTask_CombatTargets::UpdateTargetDatabase()
 {
-    if (!OwnerPed)
-    {
-        return;
-    }
-
+    // Runs off the game thread when batched - positions and liveness come from GatherAnalysisInputs
     ActiveTargets = 0;
-    FVector PedLocation = OwnerPed->GetActorLocation();
+    const FVector& PedLocation = SnapshotPedLocation;
 
     for (FTargetInfo& Info : TargetDatabase)
     {
-        if (!Info.Target || !IsValid(Info.Target))
+        if (!Info.bIsAlive)
         {
-            Info.bIsAlive = false;
             continue;
         }
 
-        // Update distance and position
-        Info.LastKnownPosition = Info.Target->GetActorLocation();
+        // Update distance
         Info.Distance = FVector::Dist(PedLocation, Info.LastKnownPosition);
-        Info.LastSeenTime = GetWorld()->GetTimeSeconds();
 
         // Update threat level based on distance and behavior
         if (Info.Distance <= EngagementRange)
@@ -693,11 +795,7 @@ void UTask_CombatTargets::SelectPrimaryTarget()
     {
         SecondaryTarget = PrimaryTarget; // Demote current primary
         PrimaryTarget = BestTarget;
-        
-        if (PrimaryTarget)
-        {
-            UE_LOG(LogTemp, Log, TEXT("Task_CombatTargets: New primary target selected: %s"), *PrimaryTarget->GetName());
-        }
+        bPrimaryTargetChanged = true; // Logged in ApplyAnalysis on the game thread
     }
 }
 
@@ -811,6 +909,28 @@ bool UTask_CombatTargets::ShouldAdvance() const
     return ActiveTargets <= 1 && PrimaryTarget != nullptr;
 }
 
+void UTask_CombatTargets::AcquireTargetsInRange()
+{
+    UEntitySpatialSubsystem* SpatialIndex = UEntitySpatialSubsystem::Get(OwnerPed);
+    if (!SpatialIndex)
+    {
+        return;
+    }
+
+    TArray<UBaseEntity*> NearbyPeds;
+    SpatialIndex->FindNearestEntities(OwnerPed->GetActorLocation(), MaxSimultaneousTargets, NearbyPeds, EngagementRange,
+                                      EEntityType::Ped, OwnerPed->GetBaseEntityComponent());
+
+    for (UBaseEntity* Entity : NearbyPeds)
+    {
+        AActor* Actor = Entity->GetOwnerActor();
+        if (Actor && Entity->IsAlive())
+        {
+            CombatTargets.Add(Actor);
+        }
+    }
+}
+
 void UTask_CombatTargets::SetTargets(const TArray<APed*>& Targets)
 {
     CombatTargets.Reset();
@@ -45,6 +45,8 @@ class GAME_API UWildComplexTask : public UBaseTask
 {
     GENERATED_BODY()
 
+    friend class UWildComplexTaskScheduler;
+
 public:
     UWildComplexTask();
 
@@ -55,12 +57,22 @@ protected:
 
     // WildComplex specific functions
     virtual bool InitializeComplexSystems() { return true; }
-    virtual bool AnalyzeSituation(float DeltaTime) { return true; }
+    virtual bool AnalyzeSituation(float DeltaTime);
     virtual bool PlanActions(float DeltaTime) { return true; }
     virtual bool ExecuteComplexActions(float DeltaTime) { return true; }
     virtual bool AdaptToChanges(float DeltaTime) { return true; }
     virtual bool FinalizeExecution() { return true; }
 
+    // Situation analysis, split so UWildComplexTaskScheduler can batch it across all tasks:
+    // Gather copies actor state on the game thread, Compute may run on a worker thread and must
+    // only touch this task's own fields, Apply runs back on the game thread
+    virtual bool GatherAnalysisInputs() { return true; }
+    virtual void ComputeAnalysis() {}
+    virtual bool ApplyAnalysis() { return true; }
+
+    /** Run analysis inline unless the scheduler is batching it for us */
+    bool RunAnalysisIfDue(float DeltaTime);
+
     // State management
     void SetWildComplexState(EWildComplexTaskState NewState);
     bool ShouldTransitionState() const;
@@ -90,8 +102,15 @@ protected:
     bool bSystemsInitialized;
 
 private:
+    bool IsAnalysisDue() const;
+    void FinishBatchedAnalysis(bool bSucceeded);
+
     float LastAnalysisTime;
     float LastPlanningTime;
+
+    /** Set while registered with the world's UWildComplexTaskScheduler */
+    bool bUsesBatchedAnalysis;
+    bool bLastAnalysisSucceeded;
 };
 
 /**
@@ -110,7 +129,8 @@ public:
 
 protected:
     virtual bool InitializeComplexSystems() override;
-    virtual bool AnalyzeSituation(float DeltaTime) override;
+    virtual bool GatherAnalysisInputs() override;
+    virtual void ComputeAnalysis() override;
     virtual bool PlanActions(float DeltaTime) override;
     virtual bool ExecuteComplexActions(float DeltaTime) override;
     virtual bool AdaptToChanges(float DeltaTime) override;
@@ -158,6 +178,12 @@ private:
     FVector OpponentMovementDirection;
     float OpponentSpeed;
 
+    // Analysis snapshot (written by GatherAnalysisInputs)
+    FVector SnapshotPedLocation;
+    FVector SnapshotOpponentLocation;
+    float SnapshotInterval;
+    float LastSnapshotTime;
+
     // Internal functions
     void UpdateCombatAnalysis();
     void SelectBestAction();
@@ -182,12 +208,15 @@ public:
 
 protected:
     virtual bool InitializeComplexSystems() override;
-    virtual bool AnalyzeSituation(float DeltaTime) override;
+    virtual bool GatherAnalysisInputs() override;
+    virtual void ComputeAnalysis() override;
+    virtual bool ApplyAnalysis() override;
     virtual bool PlanActions(float DeltaTime) override;
     virtual bool ExecuteComplexActions(float DeltaTime) override;
     virtual bool AdaptToChanges(float DeltaTime) override;
     virtual bool ValidateTaskConditions() const override;
 
+    /** Left empty, the nearest peds within EngagementRange are picked up when the task starts */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat Config")
     TArray<AActor*> CombatTargets;
 
@@ -226,6 +255,10 @@ private:
     TArray<FTargetInfo> TargetDatabase;
     AActor* PrimaryTarget;
     AActor* SecondaryTarget;
+    bool bPrimaryTargetChanged;
+
+    // Analysis snapshot (written by GatherAnalysisInputs)
+    FVector SnapshotPedLocation;
     
     // Combat state
     FVector CurrentCoverPosition;
@@ -245,6 +278,7 @@ private:
     float WeaponRange;
 
     // Internal functions
+    void AcquireTargetsInRange();
     void UpdateTargetDatabase();
     void SelectPrimaryTarget();
     void DetermineOptimalStrategy();
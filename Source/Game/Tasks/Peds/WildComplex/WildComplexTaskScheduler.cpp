@@ -0,0 +1,88 @@
+#include "WildComplexTaskScheduler.h"
+#include "WildComplexTask.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+UWildComplexTaskScheduler::UWildComplexTaskScheduler()
+{
+    MinParallelBatchSize = 4;
+    LastBatchSize = 0;
+    LastBatchTimeMs = 0.0f;
+}
+
+void UWildComplexTaskScheduler::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (RegisteredTasks.Num() > 0)
+    {
+        RunAnalysisBatch();
+    }
+}
+
+TStatId UWildComplexTaskScheduler::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UWildComplexTaskScheduler, STATGROUP_Tickables);
+}
+
+bool UWildComplexTaskScheduler::RegisterTask(UWildComplexTask* Task)
+{
+    if (!Task)
+    {
+        return false;
+    }
+
+    RegisteredTasks.AddUnique(Task);
+    return true;
+}
+
+void UWildComplexTaskScheduler::UnregisterTask(UWildComplexTask* Task)
+{
+    RegisteredTasks.RemoveSingleSwap(Task);
+}
+
+void UWildComplexTaskScheduler::RunAnalysisBatch()
+{
+    const double BatchStartTime = FPlatformTime::Seconds();
+
+    // Gather: game thread only, every actor read happens here
+    AnalysisBatch.Reset();
+    for (int32 i = RegisteredTasks.Num() - 1; i >= 0; --i)
+    {
+        UWildComplexTask* Task = RegisteredTasks[i].Get();
+        if (!Task)
+        {
+            RegisteredTasks.RemoveAtSwap(i);
+            continue;
+        }
+
+        if (!Task->IsAnalysisDue())
+        {
+            continue;
+        }
+
+        if (Task->GatherAnalysisInputs())
+        {
+            AnalysisBatch.Add(Task);
+        }
+        else
+        {
+            Task->FinishBatchedAnalysis(false);
+        }
+    }
+
+    // Analyse: each task only reads its own snapshot and writes its own analysis fields
+    ParallelFor(AnalysisBatch.Num(), [this](int32 Index)
+        {
+            AnalysisBatch[Index]->ComputeAnalysis();
+        }, AnalysisBatch.Num() < MinParallelBatchSize);
+
+    // Apply: back on the game thread, in batch order
+    for (UWildComplexTask* Task : AnalysisBatch)
+    {
+        Task->FinishBatchedAnalysis(Task->ApplyAnalysis());
+    }
+
+    LastBatchSize = AnalysisBatch.Num();
+    LastBatchTimeMs = (float)((FPlatformTime::Seconds() - BatchStartTime) * 1000.0);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WildComplexTaskScheduler.generated.h"
+
+class UWildComplexTask;
+
+/**
+ * WildComplex Task Scheduler
+ * Runs the situation analysis of every active wild-complex task as one batch per frame:
+ * inputs are gathered serially on the game thread, the read-only analysis runs in a ParallelFor,
+ * and results are applied serially. Planning and execution stay in each task's UpdateTask.
+ */
+UCLASS()
+class GAME_API UWildComplexTaskScheduler : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UWildComplexTaskScheduler();
+
+    // UTickableWorldSubsystem interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // === Registration ===
+
+    /** Add a task to the batched analysis; returns false if it must analyse itself */
+    bool RegisterTask(UWildComplexTask* Task);
+
+    void UnregisterTask(UWildComplexTask* Task);
+
+    int32 GetRegisteredTaskCount() const { return RegisteredTasks.Num(); }
+
+    // === Stats ===
+
+    /** Number of tasks analysed in the last batch */
+    int32 GetLastBatchSize() const { return LastBatchSize; }
+
+    /** Wall time spent in the last batch (gather + parallel analysis + apply) in milliseconds */
+    float GetLastBatchTimeMs() const { return LastBatchTimeMs; }
+
+    /** Batches smaller than this run on the game thread; thread dispatch costs more than it saves */
+    UPROPERTY(EditAnywhere, Category = "WildComplex Scheduler")
+    int32 MinParallelBatchSize;
+
+private:
+    void RunAnalysisBatch();
+
+    TArray<TWeakObjectPtr<UWildComplexTask>> RegisteredTasks;
+
+    /** Reused between frames to avoid per-frame allocation */
+    TArray<UWildComplexTask*> AnalysisBatch;
+
+    int32 LastBatchSize;
+    float LastBatchTimeMs;
+};
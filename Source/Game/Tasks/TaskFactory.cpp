@@ -2,16 +2,8 @@
 #include "Peds/Ped.h"
 #include "Engine/World.h"
 
-// Initialize static variables
-TMap<FString, TSubclassOf<UBaseTask>> UTaskFactory::CachedTaskClasses;
-
 UTaskFactory::UTaskFactory()
 {
-    // Initialize cached task classes on first use
-    if (CachedTaskClasses.Num() == 0)
-    {
-        InitializeCachedTaskClasses();
-    }
 }
 
 // === OneShot Task Creation ===
@@ -274,6 +266,30 @@ UTask_ClimbLadder* UTaskFactory::CreateClimbLadderTask(APed* OwnerPed, AActor* L
     return ClimbLadderTask;
 }
 
+UTask_Graph* UTaskFactory::CreateGraphTask(APed* OwnerPed, FName GraphName, AActor* Target)
+{
+    if (!OwnerPed)
+    {
+        UE_LOG(LogTemp, Error, TEXT("CreateGraphTask: Invalid OwnerPed"));
+        return nullptr;
+    }
+
+    UTask_Graph* GraphTask = NewObject<UTask_Graph>(OwnerPed);
+    if (GraphTask)
+    {
+        SetCommonTaskProperties(GraphTask, OwnerPed, Target);
+        if (!GraphTask->SetGraph(GraphName))
+        {
+            return nullptr;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Created Graph task '%s' for ped: %s"), 
+               *GraphName.ToString(), *OwnerPed->GetCharacterName());
+    }
+    
+    return GraphTask;
+}
+
 // === WildComplex Task Creation ===
 
 UTask_FightAgainst* UTaskFactory::CreateFightAgainstTask(APed* OwnerPed, APed* Enemy, float FightDuration)
@@ -341,6 +357,35 @@ UBaseTask* UTaskFactory::CreateTaskOfClass(TSubclassOf<UBaseTask> TaskClass, APe
     return NewTask;
 }
 
+UBaseTask* UTaskFactory::CreateTaskById(ETaskTypeId TypeId, APed* OwnerPed, AActor* Target)
+{
+    if (!FTaskTypeRegistry::IsValidId((int32)TypeId) || !OwnerPed)
+    {
+        UE_LOG(LogTemp, Error, TEXT("CreateTaskById: Invalid task type id %d or OwnerPed"), (int32)TypeId);
+        return nullptr;
+    }
+
+    UBaseTask* NewTask = FTaskTypeRegistry::Construct(TypeId, OwnerPed);
+    if (NewTask)
+    {
+        SetCommonTaskProperties(NewTask, OwnerPed, Target);
+    }
+    
+    return NewTask;
+}
+
+TSubclassOf<UBaseTask> UTaskFactory::FindTaskClassByName(const FString& TaskName)
+{
+    const ETaskTypeId TypeId = FTaskTypeRegistry::FindTypeId(FName(*TaskName));
+    if (TypeId == ETaskTypeId::Invalid)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("TaskFactory: Task type '%s' is not registered"), *TaskName);
+        return nullptr;
+    }
+
+    return FTaskTypeRegistry::GetTypeClass(TypeId);
+}
+
 bool UTaskFactory::CanPedExecuteTask(APed* OwnerPed, TSubclassOf<UBaseTask> TaskClass, AActor* Target)
 {
     if (!OwnerPed || !TaskClass)
@@ -375,11 +420,12 @@ TArray<TSubclassOf<UBaseTask>> UTaskFactory::GetAvailableTaskClasses(APed* Owner
     }
 
     // Add task classes based on ped's current state and capabilities
-    for (auto& ClassPair : CachedTaskClasses)
+    for (int32 TypeId = 0; TypeId < FTaskTypeRegistry::GetTypeCount(); ++TypeId)
     {
-        if (CanPedExecuteTask(OwnerPed, ClassPair.Value, nullptr))
+        UClass* TaskClass = FTaskTypeRegistry::GetTypeClass((ETaskTypeId)TypeId);
+        if (CanPedExecuteTask(OwnerPed, TaskClass, nullptr))
         {
-            AvailableClasses.Add(ClassPair.Value);
+            AvailableClasses.Add(TaskClass);
         }
     }
     
@@ -543,36 +589,3 @@ void UTaskFactory::ConfigureTaskSpecificProperties(UBaseTask* Task, const TMap<F
                *PropertyPair.Key, *PropertyPair.Value, *Task->GetTaskName());
     }
 }
-
-// === Private Helper Functions ===
-
-void UTaskFactory::InitializeCachedTaskClasses()
-{
-    // Cache commonly used task classes for performance
-    CachedTaskClasses.Add(TEXT("Aim"), UTask_Aim::StaticClass());
-    CachedTaskClasses.Add(TEXT("LookAt"), UTask_LookAt::StaticClass());
-    CachedTaskClasses.Add(TEXT("Turn"), UTask_Turn::StaticClass());
-    CachedTaskClasses.Add(TEXT("Shimmy"), UTask_Shimmy::StaticClass());
-    CachedTaskClasses.Add(TEXT("DropDown"), UTask_DropDown::StaticClass());
-    
-    CachedTaskClasses.Add(TEXT("Climb"), UTask_Climb::StaticClass());
-    CachedTaskClasses.Add(TEXT("EnterVehicle"), UTask_EnterVehicle::StaticClass());
-    CachedTaskClasses.Add(TEXT("GrabLedge"), UTask_GrabLedgeAndHold::StaticClass());
-    CachedTaskClasses.Add(TEXT("ClimbLadder"), UTask_ClimbLadder::StaticClass());
-    
-    CachedTaskClasses.Add(TEXT("FightAgainst"), UTask_FightAgainst::StaticClass());
-    CachedTaskClasses.Add(TEXT("CombatTargets"), UTask_CombatTargets::StaticClass());
-
-    UE_LOG(LogTemp, Log, TEXT("TaskFactory: Cached %d task classes"), CachedTaskClasses.Num());
-}
-
-TSubclassOf<UBaseTask> UTaskFactory::GetCachedTaskClass(const FString& TaskName)
-{
-    if (CachedTaskClasses.Contains(TaskName))
-    {
-        return CachedTaskClasses[TaskName];
-    }
-    
-    UE_LOG(LogTemp, Warning, TEXT("TaskFactory: Task class '%s' not found in cache"), *TaskName);
-    return nullptr;
-}
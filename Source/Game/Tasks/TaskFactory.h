@@ -4,6 +4,7 @@
 #include "UObject/NoExportTypes.h"
 #include "Engine/World.h"
 #include "BaseTask.h"
+#include "TaskTypeRegistry.h"
 #include "Peds/OneShot/OneShotTask.h"
 #include "Peds/Complex/ComplexTask.h"
 #include "Peds/WildComplex/WildComplexTask.h"
@@ -63,6 +64,9 @@ public:
     /** Create a Climb Ladder task for the specified ped */
     static UTask_ClimbLadder* CreateClimbLadderTask(APed* OwnerPed, AActor* LadderActor, bool bClimbUp = true);
 
+    /** Create a task that runs a data-driven graph from Data/Tasks/TaskGraphs.xml */
+    static UTask_Graph* CreateGraphTask(APed* OwnerPed, FName GraphName, AActor* Target = nullptr);
+
     // === WildComplex Task Creation ===
 
     /** Create a Fight Against task for the specified ped */
@@ -76,6 +80,12 @@ public:
     /** Create a task of any type using class reference */
     static UBaseTask* CreateTaskOfClass(TSubclassOf<UBaseTask> TaskClass, APed* OwnerPed, AActor* Target = nullptr);
 
+    /** Create a task from its registry id (see FTaskTypeRegistry) */
+    static UBaseTask* CreateTaskById(ETaskTypeId TypeId, APed* OwnerPed, AActor* Target = nullptr);
+
+    /** Look up a registered task class by its short name (e.g. "Turn", "Climb") */
+    static TSubclassOf<UBaseTask> FindTaskClassByName(const FString& TaskName);
+
     /** Validate if a ped can execute a specific task type */
     static bool CanPedExecuteTask(APed* OwnerPed, TSubclassOf<UBaseTask> TaskClass, AActor* Target = nullptr);
 
@@ -107,14 +117,4 @@ protected:
 
     /** Internal helper to configure task-specific properties */
     static void ConfigureTaskSpecificProperties(UBaseTask* Task, const TMap<FString, FString>& Properties);
-
-private:
-    /** Cached task class references for performance */
-    static TMap<FString, TSubclassOf<UBaseTask>> CachedTaskClasses;
-
-    /** Initialize cached task classes */
-    static void InitializeCachedTaskClasses();
-
-    /** Get task class by name from cache */
-    static TSubclassOf<UBaseTask> GetCachedTaskClass(const FString& TaskName);
 };
@@ -0,0 +1,174 @@
+#include "TaskHandleRegistry.h"
+#include "../Peds/Ped.h"
+#include "Engine/World.h"
+
+FTaskHandleRegistry& FTaskHandleRegistry::Get()
+{
+    static FTaskHandleRegistry Registry;
+    return Registry;
+}
+
+FTaskHandleRegistry::FTaskHandleRegistry()
+{
+    FirstFree = INDEX_NONE;
+    NumHandles = 0;
+    Slots.Reserve(256);
+
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FTaskHandleRegistry::OnWorldCleanup);
+}
+
+FTaskHandleRegistry::~FTaskHandleRegistry()
+{
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+}
+
+int32 FTaskHandleRegistry::GetOrCreateHandle(UBaseTask* Task)
+{
+    if (!Task)
+    {
+        return 0;
+    }
+
+    if (IsValidHandle(Task->RegistryHandle))
+    {
+        return Task->RegistryHandle;
+    }
+
+    int32 SlotIndex = FirstFree;
+    if (SlotIndex != INDEX_NONE)
+    {
+        FirstFree = Slots[SlotIndex].NextFree;
+    }
+    else
+    {
+        if (Slots.Num() >= IndexMask)
+        {
+            UE_LOG(LogTemp, Error, TEXT("TaskHandleRegistry: Out of task handles (%d live)"), NumHandles);
+            return 0;
+        }
+        SlotIndex = Slots.AddDefaulted();
+    }
+
+    FSlot& Slot = Slots[SlotIndex];
+    Slot.Task = Task;
+    Slot.State = Task->GetTaskState();
+    Slot.KeepAlive = IsTerminalState(Slot.State) ? nullptr : Task;
+    Slot.TypeId = FTaskTypeRegistry::FindTypeIdForClass(Task->GetClass());
+    Slot.NextFree = INDEX_NONE;
+    Slot.bInUse = true;
+    ++NumHandles;
+
+    Task->RegistryHandle = MakeHandle(SlotIndex, Slot.Generation);
+    return Task->RegistryHandle;
+}
+
+void FTaskHandleRegistry::Release(int32 Handle)
+{
+    FSlot* Slot = FindSlot(Handle);
+    if (!Slot)
+    {
+        return;
+    }
+
+    if (UBaseTask* Task = Slot->Task.Get())
+    {
+        Task->RegistryHandle = 0;
+    }
+
+    const int32 SlotIndex = (Handle & IndexMask) - 1;
+    Slot->KeepAlive = nullptr;
+    Slot->Task.Reset();
+    Slot->bInUse = false;
+    Slot->Generation = Slot->Generation >= MaxGeneration ? 1 : Slot->Generation + 1;
+    Slot->NextFree = FirstFree;
+    FirstFree = SlotIndex;
+    --NumHandles;
+}
+
+UBaseTask* FTaskHandleRegistry::Resolve(int32 Handle) const
+{
+    const FSlot* Slot = FindSlot(Handle);
+    return Slot ? Slot->Task.Get() : nullptr;
+}
+
+int32 FTaskHandleRegistry::GetState(int32 Handle) const
+{
+    const FSlot* Slot = FindSlot(Handle);
+    return Slot ? (int32)Slot->State : -1;
+}
+
+void FTaskHandleRegistry::GetStates(const int32* Handles, int32* OutStates, int32 Count) const
+{
+    if (!Handles || !OutStates)
+    {
+        return;
+    }
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        OutStates[i] = GetState(Handles[i]);
+    }
+}
+
+ETaskTypeId FTaskHandleRegistry::GetTypeId(int32 Handle) const
+{
+    const FSlot* Slot = FindSlot(Handle);
+    return Slot ? Slot->TypeId : ETaskTypeId::Invalid;
+}
+
+void FTaskHandleRegistry::MirrorState(int32 Handle, ETaskState NewState)
+{
+    FSlot* Slot = FindSlot(Handle);
+    if (!Slot)
+    {
+        return;
+    }
+
+    Slot->State = NewState;
+    if (IsTerminalState(NewState))
+    {
+        Slot->KeepAlive = nullptr;
+    }
+}
+
+void FTaskHandleRegistry::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    for (FSlot& Slot : Slots)
+    {
+        if (Slot.KeepAlive)
+        {
+            Collector.AddReferencedObject(Slot.KeepAlive);
+        }
+    }
+}
+
+const FTaskHandleRegistry::FSlot* FTaskHandleRegistry::FindSlot(int32 Handle) const
+{
+    const int32 SlotIndex = (Handle & IndexMask) - 1;
+    if (Handle <= 0 || !Slots.IsValidIndex(SlotIndex))
+    {
+        return nullptr;
+    }
+
+    const FSlot& Slot = Slots[SlotIndex];
+    return Slot.bInUse && MakeHandle(SlotIndex, Slot.Generation) == Handle ? &Slot : nullptr;
+}
+
+bool FTaskHandleRegistry::IsTerminalState(ETaskState State)
+{
+    return State == ETaskState::Completed || State == ETaskState::Failed ||
+           State == ETaskState::Cancelled || State == ETaskState::Interrupted;
+}
+
+void FTaskHandleRegistry::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    for (FSlot& Slot : Slots)
+    {
+        UBaseTask* Task = Slot.KeepAlive;
+        if (Task && Task->OwnerPed && Task->OwnerPed->GetWorld() == World)
+        {
+            Slot.KeepAlive = nullptr;
+            Slot.State = ETaskState::Cancelled;
+        }
+    }
+}
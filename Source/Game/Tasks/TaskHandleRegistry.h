@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "BaseTask.h"
+#include "TaskTypeRegistry.h"
+
+/**
+ * Task Handle Registry
+ * Slot map behind the integer task handles held by scripts. A handle packs a slot index and the
+ * slot's generation, so a handle to a released slot fails the generation check instead of aliasing
+ * whatever task reuses the slot. Registered tasks mirror every state change into their slot from
+ * UBaseTask::SetTaskState, so state queries are a bounds check and an array read.
+ *
+ * Unassigned and running tasks are kept alive by the registry; the reference is dropped once a task
+ * finishes, but its final state stays queryable until the handle is released.
+ * Game thread only.
+ */
+class GAME_API FTaskHandleRegistry : public FGCObject
+{
+public:
+    static FTaskHandleRegistry& Get();
+
+    FTaskHandleRegistry();
+    virtual ~FTaskHandleRegistry();
+
+    // === Handles ===
+
+    /** Handle for a task, registering it on first request. 0 for a null task */
+    int32 GetOrCreateHandle(UBaseTask* Task);
+
+    /** Free the handle's slot; the task itself is left alone */
+    void Release(int32 Handle);
+
+    bool IsValidHandle(int32 Handle) const { return FindSlot(Handle) != nullptr; }
+
+    /** Task behind a handle, nullptr if the handle is stale or the task has finished and been collected */
+    UBaseTask* Resolve(int32 Handle) const;
+
+    int32 GetNumHandles() const { return NumHandles; }
+
+    // === State Queries ===
+
+    /** Mirrored ETaskState of the task, -1 for an invalid handle */
+    int32 GetState(int32 Handle) const;
+
+    /** Bulk GetState; OutStates must hold Count entries */
+    void GetStates(const int32* Handles, int32* OutStates, int32 Count) const;
+
+    ETaskTypeId GetTypeId(int32 Handle) const;
+
+    /** Called by UBaseTask::SetTaskState for registered tasks */
+    void MirrorState(int32 Handle, ETaskState NewState);
+
+    // FGCObject interface
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual FString GetReferencerName() const override { return TEXT("FTaskHandleRegistry"); }
+
+private:
+    static constexpr int32 IndexBits = 20;
+    static constexpr int32 IndexMask = (1 << IndexBits) - 1;
+    static constexpr int32 MaxGeneration = (1 << (31 - IndexBits)) - 1;
+
+    struct FSlot
+    {
+        /** Strong reference while the task can still change state */
+        TObjectPtr<UBaseTask> KeepAlive = nullptr;
+        TWeakObjectPtr<UBaseTask> Task;
+        int32 NextFree = INDEX_NONE;
+        uint16 Generation = 1;
+        ETaskState State = ETaskState::Idle;
+        ETaskTypeId TypeId = ETaskTypeId::Invalid;
+        bool bInUse = false;
+    };
+
+    static int32 MakeHandle(int32 SlotIndex, uint16 Generation) { return ((int32)Generation << IndexBits) | (SlotIndex + 1); }
+
+    const FSlot* FindSlot(int32 Handle) const;
+    FSlot* FindSlot(int32 Handle) { return const_cast<FSlot*>(static_cast<const FTaskHandleRegistry*>(this)->FindSlot(Handle)); }
+
+    static bool IsTerminalState(ETaskState State);
+
+    /** Drop strong references to tasks owned by peds in a world that is going away */
+    void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+    TArray<FSlot> Slots;
+    int32 FirstFree;
+    int32 NumHandles;
+    FDelegateHandle WorldCleanupHandle;
+};
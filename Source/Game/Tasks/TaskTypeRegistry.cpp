@@ -0,0 +1,106 @@
+#include "TaskTypeRegistry.h"
+#include "BaseTask.h"
+#include "Peds/OneShot/OneShotTask.h"
+#include "Peds/Complex/ComplexTask.h"
+#include "Peds/WildComplex/WildComplexTask.h"
+
+namespace TaskTypeTables
+{
+    template<typename TaskType>
+    UBaseTask* ConstructTask(UObject* Outer)
+    {
+        return NewObject<TaskType>(Outer);
+    }
+
+    static const char* const NamesUTF8[] =
+    {
+#define GAME_TASK_TYPE_NAME(Name, Class) #Name,
+        GAME_TASK_TYPES(GAME_TASK_TYPE_NAME)
+#undef GAME_TASK_TYPE_NAME
+    };
+
+    static UClass* (*const StaticClasses[])() =
+    {
+#define GAME_TASK_TYPE_CLASS(Name, Class) &Class::StaticClass,
+        GAME_TASK_TYPES(GAME_TASK_TYPE_CLASS)
+#undef GAME_TASK_TYPE_CLASS
+    };
+
+    static const FTaskTypeRegistry::FConstructTaskFunc Constructors[] =
+    {
+#define GAME_TASK_TYPE_CONSTRUCTOR(Name, Class) &ConstructTask<Class>,
+        GAME_TASK_TYPES(GAME_TASK_TYPE_CONSTRUCTOR)
+#undef GAME_TASK_TYPE_CONSTRUCTOR
+    };
+
+    static_assert(UE_ARRAY_COUNT(NamesUTF8) == (int32)ETaskTypeId::Count, "Task type name table out of sync");
+    static_assert(UE_ARRAY_COUNT(StaticClasses) == (int32)ETaskTypeId::Count, "Task type class table out of sync");
+    static_assert(UE_ARRAY_COUNT(Constructors) == (int32)ETaskTypeId::Count, "Task type constructor table out of sync");
+    static_assert((int32)ETaskTypeId::Count < (int32)ETaskTypeId::Invalid, "Too many task types for ETaskTypeId");
+
+    /** FNames can't be built during static init, so the name tables are created on first use */
+    struct FNameTables
+    {
+        FName Names[(int32)ETaskTypeId::Count];
+        TMap<FName, ETaskTypeId> NameToId;
+
+        FNameTables()
+        {
+            NameToId.Reserve((int32)ETaskTypeId::Count);
+            for (int32 TypeId = 0; TypeId < (int32)ETaskTypeId::Count; ++TypeId)
+            {
+                Names[TypeId] = FName(UTF8_TO_TCHAR(NamesUTF8[TypeId]));
+                NameToId.Add(Names[TypeId], (ETaskTypeId)TypeId);
+            }
+        }
+    };
+
+    const FNameTables& GetNameTables()
+    {
+        static const FNameTables Tables;
+        return Tables;
+    }
+}
+
+FName FTaskTypeRegistry::GetTypeName(ETaskTypeId TypeId)
+{
+    return IsValidId((int32)TypeId) ? TaskTypeTables::GetNameTables().Names[(int32)TypeId] : NAME_None;
+}
+
+const char* FTaskTypeRegistry::GetTypeNameUTF8(ETaskTypeId TypeId)
+{
+    return IsValidId((int32)TypeId) ? TaskTypeTables::NamesUTF8[(int32)TypeId] : nullptr;
+}
+
+UClass* FTaskTypeRegistry::GetTypeClass(ETaskTypeId TypeId)
+{
+    return IsValidId((int32)TypeId) ? TaskTypeTables::StaticClasses[(int32)TypeId]() : nullptr;
+}
+
+ETaskTypeId FTaskTypeRegistry::FindTypeId(FName TypeName)
+{
+    const ETaskTypeId* TypeId = TaskTypeTables::GetNameTables().NameToId.Find(TypeName);
+    return TypeId ? *TypeId : ETaskTypeId::Invalid;
+}
+
+ETaskTypeId FTaskTypeRegistry::FindTypeIdForClass(const UClass* TaskClass)
+{
+    if (!TaskClass)
+    {
+        return ETaskTypeId::Invalid;
+    }
+
+    for (int32 TypeId = 0; TypeId < GetTypeCount(); ++TypeId)
+    {
+        if (TaskTypeTables::StaticClasses[TypeId]() == TaskClass)
+        {
+            return (ETaskTypeId)TypeId;
+        }
+    }
+    return ETaskTypeId::Invalid;
+}
+
+UBaseTask* FTaskTypeRegistry::Construct(ETaskTypeId TypeId, UObject* Outer)
+{
+    return IsValidId((int32)TypeId) ? TaskTypeTables::Constructors[(int32)TypeId](Outer) : nullptr;
+}
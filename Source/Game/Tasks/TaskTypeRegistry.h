@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBaseTask;
+
+/**
+ * Every task type that can be created by id: X(Name, Class)
+ * Ids are assigned in list order, so new types go at the end to keep ids already held by mods stable.
+ */
+#define GAME_TASK_TYPES(X) \
+    X(Aim,           UTask_Aim) \
+    X(LookAt,        UTask_LookAt) \
+    X(Turn,          UTask_Turn) \
+    X(Shimmy,        UTask_Shimmy) \
+    X(DropDown,      UTask_DropDown) \
+    X(Jump,          UTask_Jump) \
+    X(MoveTowards,   UTask_MoveTowards) \
+    X(Climb,         UTask_Climb) \
+    X(EnterVehicle,  UTask_EnterVehicle) \
+    X(GrabLedge,     UTask_GrabLedgeAndHold) \
+    X(ClimbLadder,   UTask_ClimbLadder) \
+    X(Graph,         UTask_Graph) \
+    X(FightAgainst,  UTask_FightAgainst) \
+    X(CombatTargets, UTask_CombatTargets)
+
+/** Dense task type id, generated from GAME_TASK_TYPES */
+enum class ETaskTypeId : uint8
+{
+#define GAME_TASK_TYPE_ENUM(Name, Class) Name,
+    GAME_TASK_TYPES(GAME_TASK_TYPE_ENUM)
+#undef GAME_TASK_TYPE_ENUM
+    Count,
+    Invalid = 0xFF
+};
+
+/**
+ * Task Type Registry
+ * Id-indexed name, class and constructor tables for every task type. Names are resolved to ids
+ * once (graph compile time, mod startup) and everything after that indexes the tables directly.
+ */
+struct GAME_API FTaskTypeRegistry
+{
+    typedef UBaseTask* (*FConstructTaskFunc)(UObject* Outer);
+
+    static constexpr int32 GetTypeCount() { return (int32)ETaskTypeId::Count; }
+
+    static bool IsValidId(int32 TypeId) { return TypeId >= 0 && TypeId < GetTypeCount(); }
+
+    /** Short type name (e.g. "Turn"), NAME_None for an invalid id */
+    static FName GetTypeName(ETaskTypeId TypeId);
+
+    /** UTF-8 type name for the interop layer; static storage, valid for the module lifetime */
+    static const char* GetTypeNameUTF8(ETaskTypeId TypeId);
+
+    static UClass* GetTypeClass(ETaskTypeId TypeId);
+
+    /** Resolve a type name (case-insensitive) to its id, ETaskTypeId::Invalid if unknown */
+    static ETaskTypeId FindTypeId(FName TypeName);
+
+    /** Reverse lookup for an exact task class, ETaskTypeId::Invalid if it is not registered */
+    static ETaskTypeId FindTypeIdForClass(const UClass* TaskClass);
+
+    /** Construct an uninitialised task of the given type */
+    static UBaseTask* Construct(ETaskTypeId TypeId, UObject* Outer);
+};